@@ -2,6 +2,7 @@
 
 #include <SimView/Model/PoneModel.hpp>
 #include <SimView/Util/ModelParser.hpp>
+#include <SimView/Window/FPSManager.hpp>
 #include <SimView/Window/Window.hpp>
 #include <memory>
 #include <string>
@@ -14,6 +15,7 @@ class PoneApp {
   inline static const char* WIN_TITLE = "Pone";
   inline static model::PoneModel_t model = nullptr;
   inline static GLFWwindow* window = nullptr;
+  inline static std::shared_ptr<window::FPSManager> fpsManager = nullptr;
   inline static const std::string DEFAULT_CONFIG_PATH = "../data/sample.json";
 
  public:
@@ -3,6 +3,7 @@
 #include <SimView/Model/ViewerModel.hpp>
 #include <SimView/OpenGL.hpp>
 #include <SimView/Util/ModelParser.hpp>
+#include <SimView/Window/FPSManager.hpp>
 #include <SimView/Window/Window.hpp>
 #include <memory>
 #include <string>
@@ -16,6 +17,7 @@ class ViewerApp {
   inline static const std::string DEFAULT_CONFIG_PATH = "../data/sample_bunny.json";
   inline static model::ViewerModel_t model = nullptr;
   inline static GLFWwindow* window = nullptr;
+  inline static std::shared_ptr<window::FPSManager> fpsManager = nullptr;
 
  public:
   ViewerApp(std::string configFilePath);
@@ -40,6 +40,8 @@ class ViewerGUIApp {
 
   // Manual update
 
+  /// @brief Frames are painted only on events. Request frames after changing the scene from outside.
+  void requestFrame() const;
   bool shouldUpdateWindow() const;
   void paint() const;
 };
@@ -2,7 +2,9 @@
 
 #include <SimView/OpenGL.hpp>
 #include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/GLResource.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
+#include <SimView/Util/VertexLayout.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,9 +16,10 @@ class AxisAlignedBoundingBox {
  private:
   glm::vec3 _minCoords;
   glm::vec3 _maxCoords;
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
+  util::VertexLayout _vertexLayout;
 
   inline static const glm::vec3 POSITIONS[8] = {
       glm::vec3(0.0f, 0.0f, 0.0f),  // 0
@@ -60,6 +63,9 @@ class AxisAlignedBoundingBox {
                          const glm::vec3& maxCoords);
   ~AxisAlignedBoundingBox();
   void draw() const;
+  const glm::vec3& getMinCoords() const { return _minCoords; };
+  const glm::vec3& getMaxCoords() const { return _maxCoords; };
+  const util::VertexLayout& getVertexLayout() const { return _vertexLayout; };
 };
 
 using AxisAlignedBoundingBox_t = std::shared_ptr<AxisAlignedBoundingBox>;
@@ -10,11 +10,14 @@ namespace model {
 
 class Background : public Primitive {
  private:
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
   GLuint _textureId;
 
+  // NOTE: Owner of the texture loaded from the file. A texture given to the constructor is owned by the caller.
+  util::GLTexture _loadedTexture;
+
   inline static const glm::vec3 positions[4] = {
       glm::vec3(1.0f, -1.0f, 1.0f),
       glm::vec3(1.0f, 1.0f, 1.0f),
@@ -21,10 +21,10 @@ class Box : public Primitive {
   float _scaleX;
   float _scaleY;
   float _scaleZ;
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
-  GLuint _textureId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
+  util::GLTexture _textureId;
 
   inline static const glm::vec3 positions[8] = {
       glm::vec3(-1.0f, -1.0f, -1.0f),
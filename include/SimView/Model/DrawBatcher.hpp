@@ -0,0 +1,140 @@
+#pragma once
+
+#include <SimView/Model/RenderingContext.hpp>
+#include <SimView/OpenGL.hpp>
+#include <SimView/Shader/DefaultShaders.hpp>
+#include <SimView/Shader/DepthShader.hpp>
+#include <SimView/Shader/ModelShader.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <SimView/Util/GpuBufferArena.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/VertexLayout.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace simview {
+namespace model {
+
+/// @brief Batched drawing of many small static objects.
+///
+/// [Buffers]
+///   Objects put their meshes into the shared 'util::GpuBufferArena' of their vertex layout,
+///   instead of creating their own VAO and buffers.
+///
+/// [Draw]
+///   In a pass, objects 'add' their draws instead of drawing themselves. 'paintGL' and 'drawGL' write the
+///   parameters of the draws into a shader storage buffer and their commands into an indirect buffer,
+///   and issue one 'glMultiDrawElementsIndirect' per arena and texture.
+///   Without 'SIMVIEW_WITH_MULTI_DRAW_INDIRECT', batching is disabled and objects draw their ranges of the arenas one by one.
+class DrawBatcher {
+ public:
+  /// @brief Parameters of a draw in the shader storage buffer (std430). See 'DefaultBatchedModelShader'.
+  struct DrawParams {
+    glm::vec4 translation;
+    glm::vec4 positionScale;
+    glm::vec4 positionOffset;
+    glm::vec4 material;  // (renderType, shadowMapping, hasTexture, octNormal)
+  };
+
+ private:
+  /// @brief The layout of 'glMultiDrawElementsIndirect'
+  struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+  };
+
+  struct Draw {
+    const util::GpuBufferArena* arena;
+    GLuint textureId;
+    util::GpuBufferArena::Range range;
+    DrawParams params;
+  };
+
+  bool _isEnabled;
+
+  std::vector<util::GpuBufferArena_t> _arenas;
+
+  shader::ModelShader_t _shader;
+  shader::DepthShader_t _depthShader;
+
+  util::GLBuffer _drawParamsBufferId;
+  util::GLBuffer _indirectBufferId;
+  size_t _drawParamsBufferSize;
+  size_t _indirectBufferSize;
+
+  std::vector<Draw> _draws;
+  std::vector<DrawParams> _drawParams;
+  std::vector<DrawElementsIndirectCommand> _commands;
+
+  size_t _nBatchedDraws;
+  size_t _nMultiDrawCalls;
+
+  /// @brief Sort the pending draws and upload their parameters and commands
+  void uploadDraws();
+
+  /// @brief Issue the uploaded commands, one multi-draw call per arena and texture
+  /// @param shader Shader to which the textures are attached. nullptr for the depth pass.
+  /// @param depthTextureId Depth map for shadow mapping
+  /// @return `nMultiDrawCalls` (`size_t`)
+  size_t issueDraws(const shader::ModelShader_t& shader, const GLuint depthTextureId);
+
+  static void reserveBuffer(const GLenum target, const GLuint bufferId, size_t& bufferSize, const size_t nBytes);
+
+ public:
+  DrawBatcher();
+  ~DrawBatcher() = default;
+
+  DrawBatcher(const DrawBatcher&) = delete;
+  DrawBatcher& operator=(const DrawBatcher&) = delete;
+
+  /// @brief Whether the GL version of the build supports batched drawing
+  static bool isSupported();
+
+  /// @brief Compile the batched shaders. Batching stays disabled until they are compiled.
+  void compileShaders();
+
+  /// @brief Release the batched shaders, e.g. when the model uses custom shaders which the batched ones would ignore
+  void releaseShaders();
+
+  /// @brief The arena of the vertex layout, created on the first call. Must be called on the GL thread.
+  util::GpuBufferArena_t getArena(const util::VertexLayout& vertexLayout);
+
+  /// @brief Add a draw to the current pass
+  /// @param arena Arena of the mesh
+  /// @param range Range of the mesh in the arena
+  /// @param textureId Ambient and diffuse texture, or 0
+  /// @param params Parameters of the draw
+  void add(const util::GpuBufferArena_t& arena,
+           const util::GpuBufferArena::Range& range,
+           const GLuint textureId,
+           const DrawParams& params);
+
+  /// @brief Draw the added draws with the batched model shader
+  void paintGL(const TransformationContext& transCtx,
+               const LightingContext& lightingCtx,
+               const RenderingContext& renderingCtx);
+
+  /// @brief Draw the added draws with the batched depth shader for the depth map
+  void drawGL(const glm::mat4& lightMvpMat);
+
+  /// @brief Whether objects should 'add' their draws instead of drawing themselves
+  bool getIsEnabled() const { return _isEnabled && _shader != nullptr; };
+  void setIsEnabled(const bool isEnabled) { _isEnabled = isEnabled; };
+
+  const std::vector<util::GpuBufferArena_t>& getArenas() const { return _arenas; };
+
+  /// @brief Draws and multi-draw calls of the last 'paintGL'
+  size_t getNumBatchedDraws() const { return _nBatchedDraws; };
+  size_t getNumMultiDrawCalls() const { return _nMultiDrawCalls; };
+};
+
+using DrawBatcher_t = std::shared_ptr<DrawBatcher>;
+
+}  // namespace model
+}  // namespace simview
@@ -10,9 +10,9 @@ class GridPlane : public Primitive {
   int _nDivs;
   glm::vec2 _minCoords;
   glm::vec2 _maxCoords;
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
 
  protected:
   // nothing
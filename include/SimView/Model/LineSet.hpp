@@ -12,9 +12,9 @@ class LineSet : public Primitive {
   float _lineWidth;
   glm::vec3 _color;
 
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
 
  protected:
   // nothing
@@ -2,6 +2,7 @@
 
 #include <SimView/Model/Primitives.hpp>
 #include <SimView/OpenGL.hpp>
+#include <SimView/Util/MeshClusters.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
 #include <SimView/Util/Texture.hpp>
 #include <iostream>
@@ -24,15 +25,15 @@ class MaterialObject : public Primitive {
           materialGroup(nullptr),
           wireFrame(nullptr){};
 
-    GLuint vaoId;
-    GLuint vertexBufferId;
-    GLuint indexBufferId;
+    util::GLVertexArray vaoId;
+    util::GLBuffer vertexBufferId;
+    util::GLBuffer indexBufferId;
     int indexBufferSize;
 
-    GLuint ambientTextureId;
-    GLuint diffuseTextureId;
-    GLuint specularTextureId;
-    GLuint bumpTextureId;
+    util::GLTexture ambientTextureId;
+    util::GLTexture diffuseTextureId;
+    util::GLTexture specularTextureId;
+    util::GLTexture bumpTextureId;
 
     bool enabledAmbientTexture;
     bool enabledDiffuseTexture;
@@ -42,6 +43,9 @@ class MaterialObject : public Primitive {
     MaterialGroup_t materialGroup;
 
     WireFrame_t wireFrame;
+
+    // NOTE: Empty unless the object is clustered
+    util::MeshClusters clusters;
   };
 
   using MaterialObjectBuffer_t = std::shared_ptr<MaterialObjectBuffer>;
@@ -51,6 +55,8 @@ class MaterialObject : public Primitive {
   std::string _filePath;
   glm::vec3 _offset;
   glm::vec3 _scale;
+  bool _isIndexed;
+  bool _isClustered;
 
   MaterialObjectBuffers_t _materialObjectBuffers = nullptr;
 
@@ -65,7 +71,11 @@ class MaterialObject : public Primitive {
  protected:
   // nothing
  public:
-  MaterialObject(const std::string& filePath, const glm::vec3 offset, const glm::vec3 scale);
+  MaterialObject(const std::string& filePath,
+                 const glm::vec3 offset,
+                 const glm::vec3 scale,
+                 const bool indexed = true,
+                 const bool clustered = false);
   ~MaterialObject();
   void update() override {};
   void initVAO() override;
@@ -1,15 +1,22 @@
 #pragma once
 
 #include <SimView/Model/Background.hpp>
+#include <SimView/Model/DrawBatcher.hpp>
+#include <SimView/Model/ObjectLoadTask.hpp>
 #include <SimView/Model/Primitives.hpp>
 #include <SimView/Model/RenderingContext.hpp>
+#include <SimView/Model/ResidencyManager.hpp>
 #include <SimView/OpenGL.hpp>
 #include <SimView/Shader/DefaultShaders.hpp>
 #include <SimView/Shader/ModelShader.hpp>
 #include <SimView/Shader/Shader.hpp>
 #include <SimView/Shader/ShaderCompiler.hpp>
+#include <SimView/Util/Culling.hpp>
 #include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -30,6 +37,7 @@ class Model {
  protected:
   Objects_t _objects = nullptr;
   Backgrounds_t _backgrounds = nullptr;
+  std::vector<ObjectLoadTask_t> _loadTasks;
   glm::vec4 _backgroundColor;
 
   String_t _modelVertMShaderPath = nullptr;
@@ -43,12 +51,47 @@ class Model {
   shader::ModelShader_t _shader = nullptr;
   shader::DepthShader_t _depthShader = nullptr;
 
+  // NOTE: Draws of small static objects, which are issued by one multi-draw call per pass
+  DrawBatcher_t _drawBatcher = nullptr;
+
+  // NOTE: Buffers of the objects within the VRAM budget
+  ResidencyManager _residencyManager;
+
   glm::vec4 _lightPosition;
   float _shininess;
   float _ambientIntensity;
   glm::vec3 _wireFrameColor;
   float _wireFrameWidth;
 
+  // ==================================================================================================
+  // Frustum culling
+  // ==================================================================================================
+  // NOTE: Objects per task when their bounds are gathered in parallel
+  inline static const int64_t CULLING_GRAIN_SIZE = 1024;
+
+  bool _isEnabledCulling;
+  util::BoundingVolumeHierarchy _objectBVH;
+
+  // NOTE: Objects in the hierarchy. It is rebuilt when they change, and refitted otherwise.
+  std::vector<int32_t> _boundedObjectIds;
+  std::vector<int32_t> _boundedObjectIdsBuffer;
+  std::vector<util::BoundingVolumeHierarchy::Box> _objectBounds;
+  std::vector<uint8_t> _hasObjectBounds;
+  std::vector<uint8_t> _isObjectInside;
+
+  // NOTE: Flags of the objects to draw in the current pass
+  std::vector<uint8_t> _isObjectDrawn;
+
+  size_t _nDrawnObjects;
+  size_t _nCulledObjects;
+  size_t _nDrawnShadowCasters;
+  size_t _nCulledShadowCasters;
+
+  /// @brief Set '_isObjectDrawn' to the objects which may be seen through `mvpMat`.
+  ///        Hidden objects are counted as neither drawn nor culled, and objects without bounding boxes are always drawn.
+  /// @param mvpMat Matrix including the model matrix of the renderer, since the bounds are in the model space of the scene
+  void cullObjects(const glm::mat4 &mvpMat, size_t &nDrawn, size_t &nCulled);
+
  public:
   // clang-format off
   inline static const std::string KEY_MODEL                      = "Model";
@@ -65,11 +108,8 @@ class Model {
                        ) = 0;
   virtual void tick(float time) = 0;
 
-  void drawGL(const glm::mat4 &lightMvpMat) {
-    for (const auto &object : *_objects) {
-      object->drawAllGL(lightMvpMat);
-    }
-  }
+  /// @brief Draw the objects in the light frustum for the depth map
+  void drawGL(const glm::mat4 &lightMvpMat);
 
   void compileShaders(const bool &isQuad = false);
 
@@ -89,6 +129,7 @@ class Model {
     try {
       object->setModelShader(getModelShader());
       object->setDepthShader(getDepthShader());
+      object->setDrawBatcher(getDrawBatcher());
       if (toInitializeVAO) {
         object->initVAO();
       }
@@ -99,6 +140,24 @@ class Model {
     }
   };
 
+  /// @brief Load the object in background. It is added to the objects when its upload is completed in 'processLoadTasks'.
+  ///        Objects which do not support asynchronous loading are added immediately.
+  /// @return `Task` (`ObjectLoadTask_t`): nullptr if the object was added immediately
+  ObjectLoadTask_t addObjectAsync(const Primitive_t &object,
+                                  util::TaskScheduler &scheduler = util::TaskScheduler::getInstance());
+
+  /// @brief Upload the loaded objects within the time budget, and add the completed ones. Must be called on the GL thread every frame.
+  /// @param timeBudget Time budget in seconds
+  void processLoadTasks(const double timeBudget);
+
+  const std::vector<ObjectLoadTask_t> &getLoadTasks() const { return _loadTasks; };
+
+  /// @brief Whether loaded data is waiting for 'processLoadTasks', i.e. frames are needed without any events
+  bool hasPendingUploads() const;
+
+  /// @brief Whether any object needs frames without any events, e.g. while streaming its data
+  bool needsFrame() const;
+
   void removeObject(const int index) {
     if (index >= 0 && index < getNumObjects()) {
       _objects->erase(_objects->begin() + index);
@@ -126,6 +185,10 @@ class Model {
 
   shader::DepthShader_t getDepthShader() const { return _depthShader; };
 
+  DrawBatcher_t getDrawBatcher() const { return _drawBatcher; };
+
+  ResidencyManager &getResidencyManager() { return _residencyManager; };
+
   Background_t getBackground(const int index) const {
     return (*_backgrounds)[index];
   };
@@ -164,6 +227,16 @@ class Model {
 
   float getWireFrameWidth() const { return _wireFrameWidth; };
 
+  bool getIsEnabledCulling() const { return _isEnabledCulling; };
+
+  size_t getNumDrawnObjects() const { return _nDrawnObjects; };
+
+  size_t getNumCulledObjects() const { return _nCulledObjects; };
+
+  size_t getNumDrawnShadowCasters() const { return _nDrawnShadowCasters; };
+
+  size_t getNumCulledShadowCasters() const { return _nCulledShadowCasters; };
+
   void setModelVertShaderPath(const String_t &vertShaderPath) {
     _modelVertMShaderPath = vertShaderPath;
   };
@@ -198,6 +271,8 @@ class Model {
 
   void setBackgroundIDtoDraw(const int index) { _backgroundIDtoDraw = index; };
 
+  void setIsEnabledCulling(const bool isEnabledCulling) { _isEnabledCulling = isEnabledCulling; };
+
   void resetRenderType();
 
   void setBackgroundColor(const float &r, const float &g, const float &b,
@@ -2,6 +2,7 @@
 
 #include <SimView/Model/Primitives.hpp>
 #include <SimView/OpenGL.hpp>
+#include <SimView/Util/MeshClusters.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
 #include <SimView/Util/Texture.hpp>
 #include <iostream>
@@ -20,11 +21,16 @@ class Object : public Primitive {
   float _offsetZ;
   float _scale;
   bool _autoScale;
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
-  GLuint _textureId;
-  GLuint _normalMapId;
+  bool _isIndexed;
+  bool _isClustered;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
+  util::GLTexture _textureId;
+  util::GLTexture _normalMapId;
+
+  // NOTE: Empty unless the object is clustered
+  util::MeshClusters _clusters;
 
  protected:
   // nothing
@@ -38,7 +44,8 @@ class Object : public Primitive {
   inline static const std::string KEY_MODEL_OBJECT_OFFSET = "Offset";
 
  private:
-  // nothing
+  void initBoundingVolumes(const VertexArray_t&,
+                           const IndexArray_t&);
  protected:
   // nothing
  public:
@@ -47,11 +54,16 @@ class Object : public Primitive {
          const float offsetY = 0.0f,
          const float offsetZ = 0.0f,
          const float scale = 1.0f,
-         const bool autoScale = false);
+         const bool autoScale = false,
+         const bool indexed = true,
+         const bool clustered = false);
   ~Object();
   void loadTexture(const std::string& filePath);
   void loadNormalMap(const std::string& filePath);
   void update() override{};
+  bool isAsyncLoadable() const override { return true; };
+  bool loadData() override;
+  float uploadData(const size_t maxBytes) override;
   void initVAO() override;
   void initVAO(const VertexArray_t&,
                const IndexArray_t&);
@@ -67,6 +79,17 @@ class Object : public Primitive {
   void drawGL(const int& index = 0) override;
   void drawAllGL(const glm::mat4& lightMvpMat) override;
 
+  bool getEvictableBuffers(util::GLVertexArray*& vaoId,
+                           util::GLBuffer*& vertexBufferId,
+                           util::GLBuffer*& indexBufferId) override {
+    vaoId = &_vaoId;
+    vertexBufferId = &_vertexBufferId;
+    indexBufferId = &_indexBufferId;
+    return true;
+  };
+
+  const util::MeshClusters& getClusters() const { return _clusters; };
+
   std::string getObjectType() override { return KEY_MODEL_OBJECT; };
 };
 
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SimView/Model/Primitives.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace simview {
+namespace model {
+
+/// @brief Background loading of a primitive.
+///        'Primitive::loadData' runs on a 'TaskScheduler' worker, and the loaded data is uploaded
+///        chunk by chunk by 'upload', which is called on the GL thread every frame with a time budget.
+class ObjectLoadTask : public std::enable_shared_from_this<ObjectLoadTask> {
+ public:
+  enum class State {
+    QUEUED,
+    LOADING,
+    UPLOADING,
+    DONE,
+    CANCELED,
+    FAILED
+  };
+
+ private:
+  // NOTE: Small enough to keep a frame responsive, large enough to keep the number of GL calls low
+  inline static const size_t UPLOAD_CHUNK_SIZE = 4 * 1024 * 1024;
+
+  Primitive_t _object;
+  std::atomic<State> _state;
+  std::atomic<bool> _isCancelRequested;
+  float _uploadProgress;
+
+  void load();
+
+ public:
+  ObjectLoadTask(const Primitive_t& object);
+  ~ObjectLoadTask();
+
+  /// @brief Enqueue loading to the scheduler
+  void start(util::TaskScheduler& scheduler);
+
+  /// @brief Upload the loaded data until the deadline. Must be called on the GL thread.
+  /// @param deadline At least one chunk is uploaded if the deadline has not passed yet
+  void upload(const std::chrono::steady_clock::time_point& deadline);
+
+  /// @brief Request cancellation. A running 'loadData' is not interrupted, but its result is discarded.
+  void cancel() { _isCancelRequested = true; };
+
+  State getState() const { return _state; };
+
+  /// @brief Uploaded fraction in [0, 1]
+  float getProgress() const { return _uploadProgress; };
+
+  bool isFinished() const;
+
+  const Primitive_t& getObject() const { return _object; };
+
+  static std::string getStateName(const State state);
+};
+
+using ObjectLoadTask_t = std::shared_ptr<ObjectLoadTask>;
+
+}  // namespace model
+}  // namespace simview
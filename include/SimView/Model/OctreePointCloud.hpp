@@ -0,0 +1,319 @@
+#pragma once
+
+#include <SimView/Model/Primitives.hpp>
+#include <SimView/Util/Culling.hpp>
+#include <SimView/Util/FileUtil.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/ObjectLoader.hpp>
+#include <SimView/Util/PlyFile.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace simview {
+namespace model {
+
+/// @brief Point cloud with a hierarchical level of detail, for clouds which do not fit in VRAM.
+///
+/// [Build]
+///   On the first load, the points are partitioned into an octree and written to a cache file next to the source
+///   ('<source>.octree', or the temporary directory if it is not writable). Each inner node keeps a subsample of
+///   at most one point per cell of a 'SAMPLING_GRID_SIZE'^3 grid, and the remaining points go down to its children,
+///   so every point is stored exactly once. Later loads only read the node table of the cache file.
+///
+///   The build is out of core, so clouds larger than the host memory can be indexed:
+///   LAS and PLY sources are streamed into a temporary file of packed points, which also counts them and finds their bounds.
+///   A node with more than 'MAX_IN_CORE_POINTS' points is then sampled while its file is streamed once, and the rest
+///   of the points are appended to one temporary bucket file per octant, which are partitioned in turn.
+///   Smaller nodes are read and built in memory. The points are written to the cache as soon as their node is built.
+///
+/// [Rendering]
+///   Every frame, the nodes in the view frustum are visited from the largest projected size, and selected while
+///   the total number of points is within the point budget. A node is drawn together with its ancestors.
+///   Selected nodes are read from the cache file on 'TaskScheduler' workers, uploaded on the GL thread, and the
+///   least recently used nodes are evicted when the resident points exceed the cache capacity.
+class OctreePointCloud : public Primitive {
+ private:
+  // NOTE: Packed record of a point in the cache file
+  struct PointRecord {
+    float position[3];
+    uint8_t color[4];
+  };
+
+  // NOTE: Record of a node in the cache file
+  struct NodeRecord {
+    float minCoords[3];
+    float size;
+    int32_t children[8];
+    uint64_t fileOffset;
+    uint32_t nPoints;
+    uint32_t depth;
+  };
+
+  struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t nNodes;
+    uint64_t nPoints;
+    float minCoords[3];
+    float maxCoords[3];
+
+    // NOTE: Identity of the source. The cache is rebuilt if any of them differs.
+    uint64_t sourceSize;
+    int64_t sourceWriteTime;
+    float offset[3];
+    float scale;
+    uint32_t autoScale;
+    uint32_t padding;
+
+    // NOTE: The node table follows the points
+    uint64_t nodeTableOffset;
+  };
+
+  // NOTE: Node of the octree under construction.
+  //       While it is built in memory, the points of a node are 'permutation[begin, begin + nPoints)'.
+  struct BuildNode {
+    glm::vec3 minCoords;
+    float size;
+    uint32_t depth;
+    uint32_t begin;
+    uint32_t nPoints;
+    uint64_t fileOffset;
+    std::array<std::unique_ptr<BuildNode>, 8> children;
+  };
+
+  /// @brief Transform from the source coordinates, which moves the center of the bounds to 'offset'
+  struct Placement {
+    glm::vec3 center;
+    float scale;
+    glm::vec3 offset;
+
+    glm::vec3 apply(const glm::vec3& position) const { return offset + scale * (position - center); };
+  };
+
+  /// @brief Points of a node read by a worker. Shared with the worker, so that the primitive can be destroyed while reading.
+  struct NodeChunk {
+    std::atomic<bool> isReady{false};
+    bool isFailed = false;
+    util::VertexLayout layout = util::VertexLayout::createPointCloud();
+    std::vector<uint8_t> packedVertices;
+  };
+
+  using NodeChunk_t = std::shared_ptr<NodeChunk>;
+
+  struct Node {
+    NodeRecord record;
+
+    // NOTE: Streaming state. Only touched on the GL thread.
+    NodeChunk_t chunk = nullptr;
+    bool isResident = false;
+    bool isFailed = false;
+    util::VertexLayout layout = util::VertexLayout::createPointCloud();
+    util::GLVertexArray vaoId;
+    util::GLBuffer vertexBufferId;
+    uint64_t lastUsedFrame = 0;
+    std::list<int32_t>::iterator lruIterator;
+  };
+
+  // ==================================================================================================
+  // Build parameters
+  // ==================================================================================================
+  inline static const char CACHE_MAGIC[8] = {'S', 'V', 'O', 'C', 'T', 'R', 'E', 'E'};
+  inline static const uint32_t CACHE_VERSION = 2;
+  inline static const std::string CACHE_EXTENSION = ".octree";
+
+  // NOTE: Nodes with fewer points are not split
+  inline static const uint32_t MAX_NODE_POINTS = 64 * 1024;
+
+  // NOTE: Inner nodes keep at most one point per cell of the grid
+  inline static const uint32_t SAMPLING_GRID_SIZE = 128;
+
+  // NOTE: Guard against clouds with many duplicated points
+  inline static const uint32_t MAX_DEPTH = 16;
+
+  // NOTE: Subtrees with fewer points are built on the calling thread
+  inline static const uint32_t PARALLEL_BUILD_THRESHOLD = 256 * 1024;
+
+  // NOTE: Nodes with more points are partitioned through bucket files. About 400 [MiB] of work space in memory.
+  inline static const uint64_t MAX_IN_CORE_POINTS = 16 * 1024 * 1024;
+
+  // NOTE: Points read from the source or a bucket file at once
+  inline static const size_t STREAM_CHUNK_SIZE = 1024 * 1024;
+
+  // ==================================================================================================
+  // Streaming parameters
+  // ==================================================================================================
+  // NOTE: Children are visited while the points of a node are more than this many pixels apart
+  inline static const float MAX_POINT_SPACING = 1.0f;
+
+  inline static const size_t MAX_LOADS_IN_FLIGHT = 8;
+  inline static const size_t MAX_UPLOAD_BYTES_PER_FRAME = 16 * 1024 * 1024;
+
+  std::string _filePath;
+  float _offsetX;
+  float _offsetY;
+  float _offsetZ;
+  float _scale;
+  float _pointSize;
+  bool _autoScale;
+
+  size_t _pointBudget;
+  size_t _cacheCapacity;
+
+  std::string _cacheFilePath;
+  std::vector<Node> _nodes;
+  glm::vec3 _minCoords;
+  glm::vec3 _maxCoords;
+
+  // NOTE: Resident nodes, most recently used first
+  std::list<int32_t> _lruNodes;
+  std::vector<int32_t> _loadingNodes;
+  std::vector<int32_t> _visibleNodes;
+  size_t _nResidentPoints;
+  size_t _nVisiblePoints;
+  uint64_t _frameIndex;
+  bool _isSelectionRefined;
+
+ protected:
+  // nothing
+ public:
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD = "Octree Point Cloud";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_NAME = "Name";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_OBJ_PATH = "ObjPath";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_OFFSET = "Offset";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_SCALE = "Scale";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_POINT_SIZE = "Point size";
+  inline static const std::string KEY_MODEL_OCTREE_POINT_CLOUD_POINT_BUDGET = "Point budget";
+
+  inline static const size_t DEFAULT_POINT_BUDGET = 5 * 1000 * 1000;
+
+ private:
+  std::vector<std::string> getCacheFilePaths() const;
+  CacheHeader createCacheHeader() const;
+  bool isCacheHeaderValid(const CacheHeader& header) const;
+
+  bool openCache();
+  bool buildCache();
+  bool buildCache(const std::string& cacheFilePath) const;
+
+  /// @brief Stream the source into a file of packed points in the source coordinates
+  /// @param nPoints Number of points
+  /// @param minCoords Min corner of the points
+  /// @param maxCoords Max corner of the points
+  /// @return `isSucceeded` (`bool`)
+  bool convertSource(const std::string& pointFilePath,
+                     uint64_t& nPoints,
+                     glm::vec3& minCoords,
+                     glm::vec3& maxCoords) const;
+
+  Placement createPlacement(const glm::vec3& minCoords, const glm::vec3& maxCoords) const;
+
+  /// @brief Build the subtree of the points in the file, and write their points to the cache file.
+  ///        The point file is removed when it has been read.
+  /// @param placement Transform applied to the points as they are read, or nullptr
+  /// @return `isSucceeded` (`bool`)
+  static bool partitionNode(const std::string& pointFilePath,
+                            const uint64_t nPoints,
+                            const Placement* placement,
+                            BuildNode& node,
+                            std::ofstream& cacheFile);
+
+  static bool buildNodeInCore(const std::string& pointFilePath,
+                              const uint64_t nPoints,
+                              const Placement* placement,
+                              BuildNode& node,
+                              std::ofstream& cacheFile);
+
+  static bool writeNodePoints(const std::vector<PointRecord>& points,
+                              const std::vector<uint32_t>& permutation,
+                              BuildNode& node,
+                              std::ofstream& cacheFile);
+
+  static bool writeNodeTable(std::ofstream& cacheFile,
+                             const BuildNode& root,
+                             CacheHeader& header);
+
+  static PointRecord toPointRecord(const glm::vec3& position, const glm::vec3& color);
+  static void placePoints(const Placement& placement, std::vector<PointRecord>& points);
+  static void expandBounds(const std::vector<PointRecord>& points, glm::vec3& minCoords, glm::vec3& maxCoords);
+
+  /// @brief Cell of the sampling grid of the node which the point falls in
+  static uint32_t toCellKey(const BuildNode& node, const PointRecord& point);
+
+  /// @brief Child of the node which the point falls in
+  static int toOctant(const BuildNode& node, const PointRecord& point);
+
+  static bool readPoints(std::ifstream& file, const size_t nPoints, std::vector<PointRecord>& points);
+  static bool writePoints(std::ofstream& file, const std::vector<PointRecord>& points);
+
+  void selectNodes(const glm::mat4& mvpMat, const glm::mat4& mvMat, const glm::mat4& projMat);
+  void requestNodes();
+  void uploadNodes();
+  void evictNodes();
+  void releaseNode(Node& node);
+
+  /// @brief Split a node. Points sampled for the node are moved to the head of its range, and the rest are sorted by octants.
+  /// @param buffer Work space of the same size as `permutation`
+  static void buildNode(const std::vector<PointRecord>& points,
+                        std::vector<uint32_t>& permutation,
+                        std::vector<uint32_t>& buffer,
+                        BuildNode& node,
+                        const uint32_t end);
+
+  static void readNode(const std::string& cacheFilePath, const NodeRecord& record, NodeChunk& chunk);
+
+ protected:
+  // nothing
+ public:
+  OctreePointCloud(const std::string& filePath = "",
+                   const float offsetX = 0.0f,
+                   const float offsetY = 0.0f,
+                   const float offsetZ = 0.0f,
+                   const float scale = 1.0f,
+                   const float pointSize = 0.1f,
+                   const bool autoScale = false,
+                   const size_t pointBudget = DEFAULT_POINT_BUDGET);
+  ~OctreePointCloud();
+
+  void update() override{};
+  bool isAsyncLoadable() const override { return true; };
+  bool loadData() override;
+  float uploadData(const size_t maxBytes) override;
+  bool needsFrame() const override;
+  void initVAO() override;
+  void paintGL(
+      const TransformationContext& transCtx,  // transCtx
+      const LightingContext& lightingCtx,     // lightingCtx
+      const RenderingContext& renderingCtx    // renderingCtx
+      ) override;
+  void drawGL(const int& index = 0) override;
+  void drawAllGL(const glm::mat4& lightMvpMat) override;
+
+  /// @brief Set the maximum number of points drawn in a frame. The cache keeps twice as many points resident.
+  void setPointBudget(const size_t pointBudget);
+  size_t getPointBudget() const { return _pointBudget; };
+
+  size_t getNumNodes() const { return _nodes.size(); };
+  size_t getNumVisibleNodes() const { return _visibleNodes.size(); };
+  size_t getNumVisiblePoints() const { return _nVisiblePoints; };
+  size_t getNumResidentPoints() const { return _nResidentPoints; };
+
+  std::string getObjectType() override { return KEY_MODEL_OCTREE_POINT_CLOUD; };
+};
+
+using OctreePointCloud_t = std::shared_ptr<OctreePointCloud>;
+
+}  // namespace model
+}  // namespace simview
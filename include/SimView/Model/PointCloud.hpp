@@ -17,9 +17,9 @@ class PointCloud : public Primitive {
   float _pointSize;
   bool _autoScale;
 
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
 
  protected:
   // nothing
@@ -46,6 +46,9 @@ class PointCloud : public Primitive {
   ~PointCloud() = default;
 
   void update() override{};
+  bool isAsyncLoadable() const override { return true; };
+  bool loadData() override;
+  float uploadData(const size_t maxBytes) override;
   void initVAO() override;
   void initVAO(const VertexArray_t&,
                const IndexArray_t&);
@@ -60,6 +63,15 @@ class PointCloud : public Primitive {
   void drawGL(const int& index = 0) override;
   void drawAllGL(const glm::mat4& lightMvpMat) override;
 
+  bool getEvictableBuffers(util::GLVertexArray*& vaoId,
+                           util::GLBuffer*& vertexBufferId,
+                           util::GLBuffer*& indexBufferId) override {
+    vaoId = &_vaoId;
+    vertexBufferId = &_vertexBufferId;
+    indexBufferId = &_indexBufferId;
+    return true;
+  };
+
   std::string getObjectType() override { return KEY_MODEL_POINT_CLOUD; };
 };
 
@@ -2,12 +2,28 @@
 
 #include <SimView/Model/Primitives.hpp>
 #include <SimView/Model/Sphere.hpp>
+#include <SimView/Shader/DefaultShaders.hpp>
+#include <SimView/Shader/DepthShader.hpp>
+#include <SimView/Shader/ModelShader.hpp>
+#include <SimView/Util/Math.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
 
 namespace simview {
 namespace model {
 
+/// @brief Point cloud drawn as spheres.
+///
+/// [Render modes]
+///   IMPOSTOR: One 20-byte record (center, color, radius) per point. Each sphere is an instanced quad,
+///             and its fragments are ray-cast, so the depth and shading are those of a true sphere.
+///   MESH    : A tessellated sphere per point. Supports the wire frame.
 class PointCloudPoly : public Primitive {
+ public:
+  enum class RenderMode {
+    IMPOSTOR,
+    MESH
+  };
+
  private:
   inline static const int NUM_DIVISIONS = 3;
 
@@ -19,10 +35,15 @@ class PointCloudPoly : public Primitive {
   float _pointSize;
   bool _isDoubled;
   bool _autoScale;
+  RenderMode _renderMode;
 
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
+
+  int _nSpheres;
+  shader::ModelShader_t _impostorShader;
+  shader::DepthShader_t _impostorDepthShader;
 
  protected:
   // nothing
@@ -36,7 +57,9 @@ class PointCloudPoly : public Primitive {
   inline static const std::string KEY_MODEL_POINT_CLOUD_POLY_POINT_SIZE = "Point size";
 
  private:
-  // nothing
+  void initImpostorVAO(const VertexArray_t& spheres);
+  void initMeshVAO(const VertexArray_t& spheres);
+
  protected:
   // nothing
  public:
@@ -47,11 +70,21 @@ class PointCloudPoly : public Primitive {
                  const float,
                  const float,
                  const bool,
-                 const bool autoScale = false);
+                 const bool autoScale = false,
+                 const RenderMode renderMode = RenderMode::IMPOSTOR);
   ~PointCloudPoly() = default;
 
   void update() override{};
   void initVAO() override;
+
+  /// @brief Create spheres from arrays
+  /// @param positions Centers
+  /// @param colors Colors. Black if nullptr.
+  /// @param radii Radii in the units of the positions. The point size is used if nullptr.
+  void initVAO(const std::shared_ptr<std::vector<vec3f_t>> positions,
+               const std::shared_ptr<std::vector<vec3f_t>> colors = nullptr,
+               const std::shared_ptr<std::vector<float>> radii = nullptr);
+
   void paintGL(
       const TransformationContext& transCtx,  // transCtx
       const LightingContext& lightingCtx,     // lightingCtx
@@ -60,10 +93,12 @@ class PointCloudPoly : public Primitive {
   void drawGL(const int& index = 0) override;
   void drawAllGL(const glm::mat4& lightMvpMat) override;
 
+  RenderMode getRenderMode() const { return _renderMode; };
+
   std::string getObjectType() override { return KEY_MODEL_POINT_CLOUD_POLY; };
 };
 
 using PointCloudPoly_t = std::shared_ptr<PointCloudPoly>;
 
 }  // namespace model
-}  // namespace simview
\ No newline at end of file
+}  // namespace simview
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SimView/Model/AxisAlignedBoundingBox.hpp>
+#include <SimView/Model/DrawBatcher.hpp>
 #include <SimView/Model/RenderingContext.hpp>
 #include <SimView/Model/WireFrame.hpp>
 #include <SimView/OpenGL.hpp>
@@ -8,10 +9,17 @@
 #include <SimView/Shader/DepthShader.hpp>
 #include <SimView/Shader/ModelShader.hpp>
 #include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <SimView/Util/GpuBufferArena.hpp>
 #include <SimView/Util/Logging.hpp>
 #include <SimView/Util/Math.hpp>
+#include <SimView/Util/VertexLayout.hpp>
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -75,9 +83,29 @@ class Primitive {
   glm::vec3 _vecocity = glm::vec3(0.0f, 0.0f, 0.0f);
   AxisAlignedBoundingBox_t _bbox = nullptr;
   WireFrame_t _wireFrame = nullptr;
+  util::VertexLayout _vertexLayout;
 
   int _indexBufferSize;
 
+  // NOTE: Data loaded by 'loadData' on a worker thread, waiting to be uploaded by 'uploadData'
+  VertexArray_t _loadedVertices = nullptr;
+  IndexArray_t _loadedIndices = nullptr;
+  std::vector<uint8_t> _packedVertices;
+  size_t _nUploadedBytes = 0;
+  bool _isUploadStarted = false;
+
+  // NOTE: Buffers shared with other objects, for batched drawing by 'DrawBatcher'
+  DrawBatcher_t _drawBatcher = nullptr;
+  util::GpuBufferArena_t _bufferArena = nullptr;
+  util::GpuBufferArena::Range _bufferRange;
+
+  // NOTE: Residency of the buffers returned by 'getEvictableBuffers'. See 'ResidencyManager'.
+  size_t _nEvictableBytes = 0;
+  bool _isEvicted = false;
+  std::chrono::steady_clock::time_point _lastUsedTime;
+  std::vector<uint8_t> _evictedVertices;
+  std::vector<uint8_t> _evictedIndices;
+
  public:
   // nothing
 
@@ -88,7 +116,153 @@ class Primitive {
   // nothing
 
  protected:
-  // nothing
+  /// @brief Keep the loaded data and pack the vertices into the vertex layout. No GL call is made.
+  /// @return `isLoaded` (`bool`): false if there is nothing to draw
+  inline bool setLoadedData(const VertexArray_t& vertices, const IndexArray_t& indices) {
+    _loadedVertices = vertices;
+    _loadedIndices = indices;
+    _packedVertices = _vertexLayout.encode(*vertices);
+    _nUploadedBytes = 0;
+    _isUploadStarted = false;
+
+    return !vertices->empty() && !indices->empty();
+  };
+
+  inline void clearLoadedData() {
+    _loadedVertices = nullptr;
+    _loadedIndices = nullptr;
+    std::vector<uint8_t>().swap(_packedVertices);
+    _nUploadedBytes = 0;
+    _isUploadStarted = false;
+  };
+
+  /// @brief Upload a chunk of the loaded data. The buffers are allocated on the first call and filled chunk by chunk.
+  /// @param vaoId VAO
+  /// @param vertexBufferId Vertex buffer
+  /// @param indexBufferId Index buffer
+  /// @param maxBytes Upper limit of bytes uploaded by this call
+  /// @return `progress` (`float`): Fraction of the uploaded bytes in [0, 1]
+  inline float uploadLoadedData(util::GLVertexArray& vaoId,
+                                util::GLBuffer& vertexBufferId,
+                                util::GLBuffer& indexBufferId,
+                                const size_t maxBytes) {
+    const size_t nVertexBytes = _packedVertices.size();
+    const size_t nIndexBytes = sizeof(uint32_t) * _loadedIndices->size();
+    const size_t nTotalBytes = nVertexBytes + nIndexBytes;
+
+    if (!_isUploadStarted) {
+      vaoId.create();
+      util::GLStateCache::getInstance().bindVertexArray(vaoId);
+
+      vertexBufferId.create();
+      glBindBuffer(GL_ARRAY_BUFFER, vertexBufferId);
+      glBufferData(GL_ARRAY_BUFFER, nVertexBytes, nullptr, GL_STATIC_DRAW);
+
+      _vertexLayout.setupAttributes();
+
+      indexBufferId.create();
+      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferId);
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER, nIndexBytes, nullptr, GL_STATIC_DRAW);
+
+      util::GLStateCache::getInstance().bindVertexArray(0);
+
+      _isUploadStarted = true;
+    }
+
+    // NOTE: Vertices first, then indices. One chunk never spans both buffers.
+    size_t nBytes = std::min(maxBytes, nTotalBytes - _nUploadedBytes);
+
+    if (_nUploadedBytes < nVertexBytes) {
+      nBytes = std::min(nBytes, nVertexBytes - _nUploadedBytes);
+
+      glBindBuffer(GL_ARRAY_BUFFER, vertexBufferId);
+      glBufferSubData(GL_ARRAY_BUFFER, _nUploadedBytes, nBytes, _packedVertices.data() + _nUploadedBytes);
+      glBindBuffer(GL_ARRAY_BUFFER, 0);
+    } else if (nBytes > 0) {
+      const size_t offset = _nUploadedBytes - nVertexBytes;
+
+      // NOTE: Bind to the copy target, so that the element buffer binding of the current VAO is not changed
+      glBindBuffer(GL_COPY_WRITE_BUFFER, indexBufferId);
+      glBufferSubData(GL_COPY_WRITE_BUFFER, offset, nBytes, reinterpret_cast<const uint8_t*>(_loadedIndices->data()) + offset);
+      glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    _nUploadedBytes += nBytes;
+
+    if (_nUploadedBytes >= nTotalBytes) {
+      _indexBufferSize = (int)_loadedIndices->size();
+      _nEvictableBytes = nTotalBytes;
+      return 1.0f;
+    }
+
+    return (float)_nUploadedBytes / (float)nTotalBytes;
+  };
+
+  /// @brief Copy the mesh into the buffer arena of the draw batcher, instead of creating own buffers
+  /// @return `isAllocated` (`bool`): false if the primitive has no draw batcher
+  inline bool allocateBatchedBuffers(const VertexArray_t& vertices, const IndexArray_t& indices) {
+    if (_drawBatcher == nullptr) {
+      return false;
+    }
+
+    releaseBatchedBuffers();
+
+    _bufferArena = _drawBatcher->getArena(_vertexLayout);
+    _bufferRange = _bufferArena->allocate(_vertexLayout.encode(*vertices), *indices);
+    _indexBufferSize = (int)_bufferRange.nIndices;
+
+    return true;
+  };
+
+  inline void releaseBatchedBuffers() {
+    if (_bufferArena != nullptr) {
+      _bufferArena->release(_bufferRange);
+      _bufferArena = nullptr;
+      _bufferRange = util::GpuBufferArena::Range();
+    }
+  };
+
+  inline bool isBatched() const {
+    return _bufferArena != nullptr;
+  };
+
+  /// @brief Draw the range of the buffer arena by itself, e.g. for the wire frame pass or without multi-draw support
+  inline void drawBatchedBuffers() const {
+    util::GLStateCache::getInstance().bindVertexArray(_bufferArena->getVaoId());
+    glDrawElementsBaseVertex(GL_TRIANGLES,
+                             (GLsizei)_bufferRange.nIndices,
+                             GL_UNSIGNED_INT,
+                             reinterpret_cast<const void*>(sizeof(uint32_t) * _bufferRange.firstIndex),
+                             (GLint)_bufferRange.baseVertex);
+  };
+
+  /// @brief Add the draw of the model pass to the draw batcher, instead of drawing
+  /// @param textureId Ambient and diffuse texture, or 0
+  /// @param hasTexture Whether the shader samples the texture
+  /// @return `isAdded` (`bool`): false if batched drawing is not available. The primitive must draw itself.
+  inline bool addToBatch(const GLuint textureId, const bool hasTexture) const {
+    if (!isBatched() || !_drawBatcher->getIsEnabled()) {
+      return false;
+    }
+
+    DrawBatcher::DrawParams params;
+    params.translation = glm::vec4(_position, 0.0f);
+    params.positionScale = glm::vec4(_vertexLayout.getPositionScale(), 0.0f);
+    params.positionOffset = glm::vec4(_vertexLayout.getPositionOffset(), 0.0f);
+    params.material = glm::vec4(getRenderType(),
+                                _isEnabledShadowMapping ? 1.0f : 0.0f,
+                                hasTexture ? 1.0f : 0.0f,
+                                _vertexLayout.isOctNormal() ? 1.0f : 0.0f);
+
+    _drawBatcher->add(_bufferArena, _bufferRange, textureId, params);
+    return true;
+  };
+
+  /// @brief Add the draw of the depth pass to the draw batcher, instead of drawing
+  /// @return `isAdded` (`bool`): false if batched drawing is not available. The primitive must draw itself.
+  inline bool addShadowCasterToBatch() const {
+    return addToBatch(0, false);
+  };
 
  public:
   Primitive()
@@ -107,10 +281,13 @@ class Primitive {
         _vecocity(0.0f),
         _bbox(),
         _wireFrame(),
+        _vertexLayout(util::VertexLayout::createDefault()),
         _indexBufferSize() {
   }
 
-  virtual ~Primitive() = default;
+  virtual ~Primitive() {
+    releaseBatchedBuffers();
+  };
 
   void setMaskMode(bool maskMode) {
     _maskMode = maskMode;
@@ -144,6 +321,11 @@ class Primitive {
     _depthShader = shader;
   };
 
+  /// @brief Draw batcher of the model. Must be set before 'initVAO' for the mesh to be put into its buffer arena.
+  void setDrawBatcher(DrawBatcher_t drawBatcher) {
+    _drawBatcher = drawBatcher;
+  };
+
   void setPosition(const glm::vec3& position) {
     _position = position;
   };
@@ -178,6 +360,22 @@ class Primitive {
     return &_isVisible;
   };
 
+  bool getIsVisible() const {
+    return _isVisible;
+  };
+
+  /// @brief Bounding box moved to the position, in the model space of the scene
+  /// @return `hasBounds` (`bool`): false if the primitive has no bounding box. Such primitives are never culled.
+  bool getBounds(glm::vec3& minCoords, glm::vec3& maxCoords) const {
+    if (_bbox == nullptr) {
+      return false;
+    }
+
+    minCoords = _bbox->getMinCoords() + _position;
+    maxCoords = _bbox->getMaxCoords() + _position;
+    return true;
+  };
+
   virtual std::string getObjectType() = 0;
 
   // ==================================================================================================
@@ -302,6 +500,27 @@ class Primitive {
     // ==================================================================================================
     _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_SHADOW_MAPPING, isEnabledShadowMapping);  // isEnabledShadowMapping
     _shader->setUniformTexture(shader::DefaultModelShader::UNIFORM_NAME_DEPTH_TEXTURE, depthTextureId);
+
+    // ==================================================================================================
+    // Transfer uniform variables for decoding vertices
+    // ==================================================================================================
+    setVertexLayoutUniforms(_vertexLayout);
+  };
+
+  /// @brief Transfer uniform variables which decode vertices of the layout. The model shader must be bound.
+  /// @param vertexLayout Vertex layout of the buffer to be drawn
+  inline void setVertexLayoutUniforms(const util::VertexLayout& vertexLayout) const {
+    _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_POSITION_SCALE, vertexLayout.getPositionScale());
+    _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_POSITION_OFFSET, vertexLayout.getPositionOffset());
+    _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_OCT_NORMAL, vertexLayout.isOctNormal());
+  };
+
+  /// @brief Transfer uniform variables of the depth shader. The depth shader must be bound.
+  /// @param lightMvpMat Light model view projection matrix
+  inline void setDepthShaderUniforms(const glm::mat4& lightMvpMat) const {
+    _depthShader->setUniformVariable(shader::DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvpMat);
+    _depthShader->setUniformVariable(shader::DefaultDepthShader::UNIFORM_NAME_POSITION_SCALE, _vertexLayout.getPositionScale());
+    _depthShader->setUniformVariable(shader::DefaultDepthShader::UNIFORM_NAME_POSITION_OFFSET, _vertexLayout.getPositionOffset());
   };
 
   inline void unbindShader() const {
@@ -317,6 +536,7 @@ class Primitive {
       _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_MVP_MAT, mvpMat);
       _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_NORM_MAT, normMat);
       _shader->setUniformVariable(shader::DefaultModelShader::UNIFORM_NAME_RENDER_TYPE, getRenderType(false, RenderType::COLOR));
+      setVertexLayoutUniforms(_bbox->getVertexLayout());
 
       _bbox->draw();
 
@@ -338,6 +558,116 @@ class Primitive {
     }
   };
 
+  // ==================================================================================================
+  // Residency
+  // Primitives which return their buffers from 'getEvictableBuffers' can be evicted by 'ResidencyManager'.
+  // The buffers are read back to the host memory, released, and uploaded again when the primitive is drawn.
+  // ==================================================================================================
+  /// @brief VAO, vertex buffer and index buffer which can be evicted. The vertex buffer is packed by '_vertexLayout'.
+  /// @return `isEvictable` (`bool`)
+  virtual bool getEvictableBuffers(util::GLVertexArray*& vaoId,
+                                   util::GLBuffer*& vertexBufferId,
+                                   util::GLBuffer*& indexBufferId) {
+    return false;
+  };
+
+  /// @brief Bytes of the evictable buffers, whether they are resident or not. 0 if the primitive is not evictable.
+  size_t getEvictableBytes() const { return _nEvictableBytes; };
+  bool getIsEvicted() const { return _isEvicted; };
+
+  std::chrono::steady_clock::time_point getLastUsedTime() const { return _lastUsedTime; };
+  void setLastUsedTime(const std::chrono::steady_clock::time_point time) { _lastUsedTime = time; };
+
+  /// @brief Read back the evictable buffers and release them. It waits for the GPU, so it is not called every frame.
+  /// @return `isEvicted` (`bool`): false if the primitive is not evictable or already evicted
+  inline bool evictBuffers() {
+    util::GLVertexArray* vaoId = nullptr;
+    util::GLBuffer* vertexBufferId = nullptr;
+    util::GLBuffer* indexBufferId = nullptr;
+
+    if (_isEvicted || !getEvictableBuffers(vaoId, vertexBufferId, indexBufferId) || !vertexBufferId->isValid()) {
+      return false;
+    }
+
+    readBackBuffer(*vertexBufferId, _evictedVertices);
+    readBackBuffer(*indexBufferId, _evictedIndices);
+
+    vaoId->reset();
+    vertexBufferId->reset();
+    indexBufferId->reset();
+
+    _isEvicted = true;
+    return true;
+  };
+
+  /// @brief Upload the buffers read back by 'evictBuffers' again
+  /// @return `isRestored` (`bool`): false if the primitive is not evicted
+  inline bool restoreBuffers() {
+    util::GLVertexArray* vaoId = nullptr;
+    util::GLBuffer* vertexBufferId = nullptr;
+    util::GLBuffer* indexBufferId = nullptr;
+
+    if (!_isEvicted || !getEvictableBuffers(vaoId, vertexBufferId, indexBufferId)) {
+      return false;
+    }
+
+    vaoId->create();
+    util::GLStateCache::getInstance().bindVertexArray(*vaoId);
+
+    vertexBufferId->create();
+    glBindBuffer(GL_ARRAY_BUFFER, *vertexBufferId);
+    glBufferData(GL_ARRAY_BUFFER, _evictedVertices.size(), _evictedVertices.data(), GL_STATIC_DRAW);
+
+    _vertexLayout.setupAttributes();
+
+    indexBufferId->create();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, *indexBufferId);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _evictedIndices.size(), _evictedIndices.data(), GL_STATIC_DRAW);
+
+    util::GLStateCache::getInstance().bindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    std::vector<uint8_t>().swap(_evictedVertices);
+    std::vector<uint8_t>().swap(_evictedIndices);
+
+    _isEvicted = false;
+    return true;
+  };
+
+  inline static void readBackBuffer(const GLuint bufferId, std::vector<uint8_t>& bytes) {
+    glBindBuffer(GL_COPY_READ_BUFFER, bufferId);
+
+    GLint64 nBytes = 0;
+    glGetBufferParameteri64v(GL_COPY_READ_BUFFER, GL_BUFFER_SIZE, &nBytes);
+
+    bytes.resize((size_t)nBytes);
+    glGetBufferSubData(GL_COPY_READ_BUFFER, 0, nBytes, bytes.data());
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  };
+
+  // ==================================================================================================
+  // Asynchronous loading
+  // 'initVAO' is split into 'loadData' on a worker thread and 'uploadData' on the GL thread.
+  // ==================================================================================================
+  /// @brief Whether the primitive implements 'loadData' and 'uploadData'
+  virtual bool isAsyncLoadable() const { return false; };
+
+  /// @brief Read and process the data. Called on a worker thread, so no GL call is allowed.
+  /// @return `isSucceeded` (`bool`)
+  virtual bool loadData() { return true; };
+
+  /// @brief Upload a part of the data loaded by 'loadData'. Called on the GL thread until it returns 1.
+  /// @param maxBytes Upper limit of bytes uploaded by this call
+  /// @return `progress` (`float`): Fraction of the uploaded data in [0, 1]
+  virtual float uploadData(const size_t maxBytes) {
+    initVAO();
+    return 1.0f;
+  };
+
+  /// @brief Whether the primitive needs more frames without any events, e.g. while streaming its data
+  virtual bool needsFrame() const { return false; };
+
   virtual void update() = 0;
   virtual void initVAO() = 0;
   virtual void paintGL(
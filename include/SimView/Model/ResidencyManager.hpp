@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SimView/Model/Primitives.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace simview {
+namespace model {
+
+/// @brief Keeps the GPU buffers of the objects within a budget.
+///
+/// [Accounting]
+///   Only the buffers of evictable primitives (see 'Primitive::getEvictableBuffers') are counted.
+///
+/// [Eviction]
+///   At the end of a frame, if the resident bytes exceed the budget, buffers are evicted until they fall below
+///   'EVICTION_TARGET_RATIO' of the budget, so that the next objects coming into view do not trigger another eviction at once:
+///   hidden objects first, then visible objects which were not drawn for 'MIN_IDLE_DURATION', the longest idle first.
+///   Visible objects drawn recently are never evicted even if they are out of the frusta now, since an eviction reads
+///   the buffers back synchronously and turning the camera back would upload them again.
+///   The budget may therefore be exceeded while they are all recently drawn.
+///   The evicted bytes are kept in the host memory until the object is restored.
+///
+/// [Restoration]
+///   'use' uploads the buffers of an evicted object again right before it is drawn.
+class ResidencyManager {
+ private:
+  size_t _budgetBytes;
+
+  size_t _nResidentBytes;
+  size_t _nEvictedBytes;
+  size_t _nEvictedObjects;
+
+  std::vector<Primitive*> _candidates;
+
+  // NOTE: Visible objects not drawn for this duration can be evicted. It is measured in time rather than frames,
+  //       since frames are only rendered on demand and their rate depends on the scene.
+  inline static const std::chrono::steady_clock::duration MIN_IDLE_DURATION = std::chrono::seconds(10);
+
+  // NOTE: Evictions go down to this ratio of the budget
+  inline static const double EVICTION_TARGET_RATIO = 0.9;
+
+ public:
+  // NOTE: 0 for no limit
+  inline static const size_t DEFAULT_BUDGET_BYTES = (size_t)2 * 1024 * 1024 * 1024;
+
+  ResidencyManager();
+
+  /// @brief Mark the object as drawn in this frame and restore its buffers if evicted. Must be called on the GL thread.
+  void use(Primitive& object);
+
+  /// @brief Evict buffers over the budget. Must be called on the GL thread once per frame, after drawing.
+  void endFrame(const std::vector<Primitive_t>& objects);
+
+  size_t getBudgetBytes() const { return _budgetBytes; };
+  void setBudgetBytes(const size_t budgetBytes) { _budgetBytes = budgetBytes; };
+
+  /// @brief Statistics of the last 'endFrame'
+  size_t getNumResidentBytes() const { return _nResidentBytes; };
+  size_t getNumEvictedBytes() const { return _nEvictedBytes; };
+  size_t getNumEvictedObjects() const { return _nEvictedObjects; };
+};
+
+}  // namespace model
+}  // namespace simview
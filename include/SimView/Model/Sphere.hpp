@@ -16,9 +16,9 @@ class Sphere : public Primitive {
   glm::vec3 _color;
   int _nDivs;
 
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
 
  protected:
   // nothing
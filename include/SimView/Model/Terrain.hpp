@@ -3,6 +3,7 @@
 #include <SimView/Model/Primitives.hpp>
 #include <SimView/OpenGL.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
 #include <SimView/Util/Texture.hpp>
 #include <fstream>
 #include <memory>
@@ -21,9 +22,9 @@ class Terrain : public Primitive {
   float _scaleX;
   float _scaleY;
   float _scaleH;
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
 
   // clang-format off
     inline static const glm::vec3 positions[4] = {
@@ -11,10 +11,10 @@ namespace model {
 
 class TextBox : public Primitive {
  private:
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
-  GLuint _textureId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
+  util::GLTexture _textureId;
 
   inline static const glm::vec3 positions[4] = {
       glm::vec3(1.0f, -1.0f, 1.0f),
@@ -2,7 +2,10 @@
 
 #include <SimView/OpenGL.hpp>
 #include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/GLResource.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,9 +15,9 @@ namespace model {
 
 class WireFrame {
  private:
-  GLuint _vaoId;
-  GLuint _vertexBufferId;
-  GLuint _indexBufferId;
+  util::GLVertexArray _vaoId;
+  util::GLBuffer _vertexBufferId;
+  util::GLBuffer _indexBufferId;
   int _indexBufferSize;
 
  protected:
@@ -31,6 +31,8 @@
 #define SIMVIEW_SHADER_VERSION "#version 460"
 #define SIMVIEW_OPENGL_VERSION_MAJOR 4
 #define SIMVIEW_OPENGL_VERSION_MINOR 6
+// NOTE: Shader storage buffers, indirect multi-draw and 'gl_BaseInstance' (OpenGL 4.6)
+#define SIMVIEW_WITH_MULTI_DRAW_INDIRECT
 #endif
 
 #define _INCLUDE_GL_
@@ -3,6 +3,8 @@
 #include <SimView/OpenGL.hpp>
 #include <SimView/Shader/DefaultShaders.hpp>
 #include <SimView/Shader/DepthShader.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
 #include <memory>
 
 namespace simview {
@@ -10,8 +12,8 @@ namespace renderer {
 
 class DepthRenderer {
  private:
-  GLuint _depthMap;
-  GLuint _depthMapFBO;
+  util::GLTexture _depthMap;
+  util::GLFramebuffer _depthMapFBO;
   shader::DepthShader_t _shader = nullptr;
 
  public:
@@ -1,17 +1,21 @@
 #pragma once
 
 #include <SimView/OpenGL.hpp>
+#include <SimView/Renderer/RenderTargetPool.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
 #include <SimView/Util/Logging.hpp>
 
-#define USE_MIP_MAP
-
 namespace simview {
 namespace renderer {
 
+/// @brief Offscreen frame of a renderer, backed by a target of 'RenderTargetPool'.
+///        Only the lower-left 'getWidth' x 'getHeight' region of the target is used, so the target is reallocated only
+///        when the size does not fit in it any more. Call 'resolve' after drawing to update 'getFrameTexture'.
 class FrameBuffer {
  public:
   FrameBuffer(){};
-  FrameBuffer(const float width, const float height);
+  FrameBuffer(const float width, const float height, const int nSamples = RenderTargetPool::DEFAULT_NUM_SAMPLES);
   ~FrameBuffer();
 
   unsigned int getFrameTexture();
@@ -19,6 +23,18 @@ class FrameBuffer {
   void bind() const;
   void unbind() const;
 
+  /// @brief Resolve the multisampled color to the frame texture
+  void resolve() const;
+
+  /// @brief Read the resolved color of the used region, as RGBA bytes from the bottom row
+  void readPixels(unsigned char *bytes) const;
+
+  int getWidth() const { return _width; };
+  int getHeight() const { return _height; };
+
+  /// @brief Texture coordinates of the upper-right corner of the used region
+  glm::vec2 getUVMax() const;
+
   void setPixelValue(const int &x,
                      const int &y,
                      const uint8_t &&r,
@@ -27,9 +43,10 @@ class FrameBuffer {
                      const uint8_t &&a);
 
  private:
-  GLuint _fbo;
-  GLuint _texture;
-  GLuint _rbo;
+  int _width = 0;
+  int _height = 0;
+  int _nSamples = 1;
+  RenderTarget_t _target = nullptr;
 };
 
 using FrameBuffer_t = std::shared_ptr<FrameBuffer>;
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <SimView/Renderer/FrameBuffer.hpp>
+#include <SimView/Renderer/ScreenCapture.hpp>
+#include <SimView/Util/FileUtil.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/StbAdapter.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace simview {
+namespace renderer {
+
+/// @brief Recording of the scene to a frame sequence or a video.
+///
+/// [Timestep]
+///   Frames are counted, not timed. Animations advance by a fixed step per rendered frame and every 'frameStep'-th frame
+///   is recorded, so the output plays back at 'frameRate' however fast or slow the frames were rendered.
+///
+/// [Backpressure]
+///   Frames are read back with 'ScreenCapture' and encoded on the threads of the recorder. At most 'MAX_FRAMES_IN_FLIGHT'
+///   frames are held between the readback and the written file. 'isReady' is false while the limit is reached, and the
+///   caller has to hold the scene until it turns true, so slow encoding throttles rendering instead of growing memory.
+///
+/// [Formats]
+///   PNG and JPG frames are written to numbered files in parallel.
+///   Y4M frames are converted to YUV 4:2:0 in parallel and appended to one file in the order of the frames.
+class FrameRecorder {
+ public:
+  enum class Format {
+    PNG = 0,
+    JPG,
+    Y4M,
+  };
+
+  struct Settings {
+    // NOTE: Directory of the numbered files, or the Y4M file
+    std::string outputPath;
+    Format format = Format::PNG;
+
+    // NOTE: Every this-th rendered frame is recorded
+    int frameStep = 1;
+
+    // NOTE: Written to the Y4M header [frames/s]
+    int frameRate = 30;
+  };
+
+  inline static const size_t MAX_FRAMES_IN_FLIGHT = 8;
+
+ private:
+  inline static const size_t MAX_ENCODER_THREADS = 4;
+  inline static const char* FRAME_FILE_NAME_FORMAT = "frame_%06d";
+
+  /// @brief State of one recording, shared with the frames in flight.
+  ///        The Y4M file is closed when the last frame of the recording is written.
+  struct Session {
+    Settings settings;
+    int width = 0;
+    int height = 0;
+
+    std::ofstream stream;
+
+    // NOTE: Index of the next frame appended to the stream
+    std::mutex writeMutex;
+    std::condition_variable writeCondition;
+    int iNextWrittenFrame = 0;
+  };
+
+  using Session_t = std::shared_ptr<Session>;
+
+  struct EncodeJob {
+    Session_t session = nullptr;
+    int iFrame = 0;
+    CapturedFrame frame;
+  };
+
+  ScreenCapture _screenCapture;
+  util::TaskScheduler& _scheduler;
+
+  Session_t _session;
+  int _nRenderedFrames;
+  int _nCapturedFrames;
+  bool _isSizeWarned;
+
+  std::vector<std::thread> _threads;
+  std::deque<EncodeJob> _jobs;
+  std::mutex _jobMutex;
+  std::condition_variable _jobCondition;
+  bool _isStopped;
+
+  // NOTE: From the capture until the frame is written
+  std::atomic<size_t> _nFramesInFlight;
+  std::atomic<size_t> _nWrittenFrames;
+  std::atomic<size_t> _nFailedFrames;
+
+  void encoderLoop();
+  void encode(EncodeJob& job);
+
+  /// @brief Append the frame to the Y4M file after the preceding ones
+  /// @param yuvBytes Y, U and V planes, or nullptr to skip the frame
+  static bool writeY4MFrame(Session& session, const int iFrame, const std::vector<unsigned char>* yuvBytes);
+
+  /// @brief Convert the RGBA frame from the top row to YUV 4:2:0 planes with full range BT.601
+  static void convertToYUV420(const CapturedFrame& frame, std::vector<unsigned char>& yuvBytes, util::TaskScheduler& scheduler);
+
+ public:
+  FrameRecorder(util::TaskScheduler& scheduler = util::TaskScheduler::getInstance());
+  ~FrameRecorder();
+
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+  /// @brief Start a recording. Must be called on the GL thread.
+  /// @param width Width of the frames. Y4M frames of other sizes are skipped.
+  /// @param height Height of the frames
+  /// @return `isStarted` (`bool`)
+  bool start(const Settings& settings, const int width, const int height);
+
+  /// @brief Stop the recording. The frames in flight are still written.
+  void stop();
+
+  bool isRecording() const { return _session != nullptr; };
+
+  /// @brief Whether the next frame can be recorded without exceeding the frames in flight
+  bool isReady() const;
+
+  /// @brief Count a rendered frame, and record it if it is on the frame step. Must be called on the GL thread.
+  void record(const FrameBuffer& frameBuffer);
+
+  /// @brief Hand the read back frames to the encoders. Must be called on the GL thread every frame.
+  void update();
+
+  bool hasPendingFrames() const { return _nFramesInFlight > 0; };
+  size_t getNumFramesInFlight() const { return _nFramesInFlight; };
+  size_t getNumWrittenFrames() const { return _nWrittenFrames; };
+  size_t getNumFailedFrames() const { return _nFailedFrames; };
+};
+
+using FrameRecorder_t = std::shared_ptr<FrameRecorder>;
+
+}  // namespace renderer
+}  // namespace simview
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace simview {
+namespace renderer {
+
+/// @brief Color and depth attachments which the scene is rendered to.
+///        With multisampling, the scene is drawn to renderbuffers and resolved to 'texture', otherwise drawn to 'texture' directly.
+struct RenderTarget {
+  // NOTE: Allocated size, which may be larger than the size in use
+  int width;
+  int height;
+  int nSamples;
+
+  util::GLFramebuffer fbo;
+  util::GLRenderbuffer colorBuffer;  // NOTE: Only with multisampling
+  util::GLRenderbuffer depthBuffer;
+
+  util::GLFramebuffer resolveFbo;  // NOTE: Only with multisampling
+  util::GLTexture texture;
+
+  /// @brief Framebuffer whose color attachment is 'texture'
+  GLuint getResolvedFbo() const { return nSamples > 1 ? resolveFbo.get() : fbo.get(); };
+};
+
+using RenderTarget_t = std::shared_ptr<RenderTarget>;
+
+/// @brief Render targets shared by the renderers on the GL thread.
+///
+/// [Reuse]
+///   A target is reused as long as the requested size fits in it and does not waste too much of it,
+///   so a live window drag does not reallocate the attachments on every frame.
+///   New targets are allocated with headroom for the same reason.
+///
+/// [Release]
+///   Released targets are kept for other renderers up to 'MAX_FREE_TARGETS', and the oldest ones are deleted.
+class RenderTargetPool {
+ private:
+  // NOTE: Headroom of new targets, and the granularity of their size [px]
+  inline static const float GROWTH_FACTOR = 1.25f;
+  inline static const int SIZE_GRANULARITY = 64;
+
+  // NOTE: Targets larger than this times the requested area are not reused
+  inline static const int MAX_WASTED_AREA_RATIO = 4;
+
+  inline static const size_t MAX_FREE_TARGETS = 2;
+
+  std::vector<RenderTarget_t> _freeTargets;
+
+  size_t _nAllocations;
+  size_t _nLiveTargets;
+
+  RenderTargetPool();
+
+  RenderTarget_t allocate(const int width, const int height, const int nSamples);
+
+ public:
+  inline static const int DEFAULT_NUM_SAMPLES = 4;
+
+  RenderTargetPool(const RenderTargetPool&) = delete;
+  RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+  ~RenderTargetPool() = default;
+
+  static RenderTargetPool& getInstance();
+
+  /// @brief Whether the target can be kept for the size
+  static bool fits(const RenderTarget& target, const int width, const int height);
+
+  /// @brief Take a free target which fits, or allocate a new one. Must be called on the GL thread.
+  RenderTarget_t acquire(const int width, const int height, const int nSamples = DEFAULT_NUM_SAMPLES);
+
+  /// @brief Return a target for other renderers
+  void release(const RenderTarget_t& target);
+
+  /// @brief Targets allocated since the start
+  size_t getNumAllocations() const { return _nAllocations; };
+
+  /// @brief Targets alive in use or in the pool
+  size_t getNumLiveTargets() const { return _nLiveTargets; };
+};
+
+}  // namespace renderer
+}  // namespace simview
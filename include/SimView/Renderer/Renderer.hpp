@@ -6,6 +6,9 @@
 #include <SimView/OpenGL.hpp>
 #include <SimView/Renderer/DepthRenderer.hpp>
 #include <SimView/Renderer/FrameBuffer.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -39,6 +42,11 @@ class Renderer {
   FrameBuffer_t _frameBuffer = nullptr;
   DepthRenderer_t _depthRenderer = nullptr;
 
+  // Statistics of the last frame
+  double _paintTimeMs = 0.0;
+  size_t _nIssuedStateCalls = 0;
+  size_t _nElidedStateCalls = 0;
+
  protected:
   // nothing
  public:
@@ -64,6 +72,13 @@ class Renderer {
   FrameBuffer_t getFrameBuffer();
   DepthRenderer_t getDepthRenderer();
 
+  /// @brief CPU time spent in the last 'paintGL', excluding the GPU work which is not waited for
+  double getPaintTimeMs() const { return _paintTimeMs; };
+
+  /// @brief GL state calls of the last 'paintGL' which were issued, or elided by 'util::GLStateCache'
+  size_t getNumIssuedStateCalls() const { return _nIssuedStateCalls; };
+  size_t getNumElidedStateCalls() const { return _nElidedStateCalls; };
+
   void updateScale(const float);
   void updateTranslate(const glm::vec4& newPosScreenSpace,
                        const glm::vec4& oldPosScreenSpace);
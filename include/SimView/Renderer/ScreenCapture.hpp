@@ -0,0 +1,97 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Renderer/FrameBuffer.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/StbAdapter.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace simview {
+namespace renderer {
+
+/// @brief Pixels of a captured frame
+struct CapturedFrame {
+  int width = 0;
+  int height = 0;
+
+  // NOTE: RGBA from the bottom row as read by GL. nullptr if the readback failed.
+  std::shared_ptr<unsigned char[]> bytes = nullptr;
+};
+
+using CaptureCallback = std::function<void(const CapturedFrame&)>;
+
+/// @brief Asynchronous capture of frames.
+///
+/// [Readback]
+///   'capture' only issues 'glReadPixels' into a pixel buffer object and a fence, so the GL thread does not wait for the GPU.
+///   'update' polls the fences every frame, and copies the finished pixels out in the order of the captures.
+///
+/// [Encoding]
+///   For captures to image files, the rows are flipped in parallel, and the image is encoded and written on the task scheduler.
+///   The returned future is set when the file is written.
+class ScreenCapture {
+ public:
+  // NOTE: Captures in flight. The oldest one is waited for when all are in use.
+  inline static const size_t NUM_PIXEL_BUFFERS = 3;
+
+ private:
+  struct PixelBuffer {
+    util::GLBuffer buffer;
+    size_t bufferSize = 0;
+
+    GLsync fence = nullptr;
+    int width = 0;
+    int height = 0;
+    CaptureCallback onCaptured;
+  };
+
+  std::array<PixelBuffer, NUM_PIXEL_BUFFERS> _pixelBuffers;
+  size_t _iNextBuffer;
+
+  util::TaskScheduler& _scheduler;
+
+  /// @brief Copy the pixels out and pass them to the callback
+  /// @param toWait Wait for the fence instead of returning if the GPU has not finished
+  /// @return `isCompleted` (`bool`)
+  bool complete(PixelBuffer& pixelBuffer, const bool toWait);
+
+ public:
+  ScreenCapture(util::TaskScheduler& scheduler = util::TaskScheduler::getInstance());
+  ~ScreenCapture();
+
+  ScreenCapture(const ScreenCapture&) = delete;
+  ScreenCapture& operator=(const ScreenCapture&) = delete;
+
+  /// @brief Start reading the frame back. Must be called on the GL thread.
+  /// @param onCaptured Called on the GL thread by 'update' when the pixels are copied out
+  void capture(const FrameBuffer& frameBuffer, CaptureCallback onCaptured);
+
+  /// @brief Start reading the frame back to an image file. Must be called on the GL thread.
+  /// @return `isSaved` (`std::future<bool>`): Set when the image is written
+  std::future<bool> capture(const FrameBuffer& frameBuffer, const std::string& filePath);
+
+  /// @brief Complete the captures whose readback has finished. Must be called on the GL thread every frame.
+  void update();
+
+  size_t getNumPendingCaptures() const;
+  bool hasPendingCaptures() const { return getNumPendingCaptures() > 0; };
+
+  /// @brief Whether the next capture has to wait for the oldest one
+  bool isFull() const { return getNumPendingCaptures() >= NUM_PIXEL_BUFFERS; };
+
+  /// @brief Flip the rows in place, so that the top row comes first as in image files
+  static void flipRows(const CapturedFrame& frame, util::TaskScheduler& scheduler);
+};
+
+using ScreenCapture_t = std::shared_ptr<ScreenCapture>;
+
+}  // namespace renderer
+}  // namespace simview
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SimView/OpenGL.hpp>
+#include <SimView/Shader/UniformName.hpp>
 #include <string>
 
 namespace simview {
@@ -9,29 +10,33 @@ namespace shader {
 class DefaultModelShader {
  public:
   // clang-format off
-  inline static const char* UNIFORM_NAME_MV_MAT                     = "u_mvMat";
-  inline static const char* UNIFORM_NAME_MVP_MAT                    = "u_mvpMat";
-  inline static const char* UNIFORM_NAME_NORM_MAT                   = "u_normMat";
-  inline static const char* UNIFORM_NAME_LIGHT_MAT                  = "u_lightMat";
-  inline static const char* UNIFORM_NAME_LIGHT_POS                  = "u_lightPos";
-  inline static const char* UNIFORM_NAME_SHININESS                  = "u_shininess";
-  inline static const char* UNIFORM_NAME_AMBIENT_INTENSITY          = "u_ambientIntensity";
-  inline static const char* UNIFORM_NAME_AMBIENT_COLOR              = "u_ambientColor";
-  inline static const char* UNIFORM_NAME_DIFFUSE_COLOR              = "u_diffuseColor";
-  inline static const char* UNIFORM_NAME_SPECULAR_COLOR             = "u_specularColor";
-  inline static const char* UNIFORM_NAME_RENDER_TYPE                = "u_renderType";
-  inline static const char* UNIFORM_NAME_BUMP_MAP                   = "u_bumpMap";
-  inline static const char* UNIFORM_NAME_LIGHT_MVP_MAT              = "u_lightMvpMat";
-  inline static const char* UNIFORM_NAME_SHADOW_MAPPING             = "u_shadowMapping";
+  inline static const UniformName UNIFORM_NAME_MV_MAT                     = UniformName("u_mvMat");
+  inline static const UniformName UNIFORM_NAME_MVP_MAT                    = UniformName("u_mvpMat");
+  inline static const UniformName UNIFORM_NAME_NORM_MAT                   = UniformName("u_normMat");
+  inline static const UniformName UNIFORM_NAME_LIGHT_MAT                  = UniformName("u_lightMat");
+  inline static const UniformName UNIFORM_NAME_LIGHT_POS                  = UniformName("u_lightPos");
+  inline static const UniformName UNIFORM_NAME_SHININESS                  = UniformName("u_shininess");
+  inline static const UniformName UNIFORM_NAME_AMBIENT_INTENSITY          = UniformName("u_ambientIntensity");
+  inline static const UniformName UNIFORM_NAME_AMBIENT_COLOR              = UniformName("u_ambientColor");
+  inline static const UniformName UNIFORM_NAME_DIFFUSE_COLOR              = UniformName("u_diffuseColor");
+  inline static const UniformName UNIFORM_NAME_SPECULAR_COLOR             = UniformName("u_specularColor");
+  inline static const UniformName UNIFORM_NAME_RENDER_TYPE                = UniformName("u_renderType");
+  inline static const UniformName UNIFORM_NAME_BUMP_MAP                   = UniformName("u_bumpMap");
+  inline static const UniformName UNIFORM_NAME_LIGHT_MVP_MAT              = UniformName("u_lightMvpMat");
+  inline static const UniformName UNIFORM_NAME_SHADOW_MAPPING             = UniformName("u_shadowMapping");
 
-  inline static const char* UNIFORM_NAME_AMBIENT_TEXTURE            = "u_ambientTexture";
-  inline static const char* UNIFORM_NAME_DIFFUSE_TEXTURE            = "u_diffuseTexture";
-  inline static const char* UNIFORM_NAME_SPECULAR_TEXTURE           = "u_specularTexture";
-  inline static const char* UNIFORM_NAME_NORMAL_MAP                 = "u_normalMap";
-  inline static const char* UNIFORM_NAME_AMBIENT_TEXTURE_FLAG       = "u_hasAmbientTexture";
-  inline static const char* UNIFORM_NAME_DIFFUSE_TEXTURE_FLAG       = "u_hasDiffuseTexture";
-  inline static const char* UNIFORM_NAME_SPECULAR_TEXTURE_FLAG      = "u_hasSpecularTexture";
-  inline static const char* UNIFORM_NAME_DEPTH_TEXTURE              = "u_depthTexture";
+  inline static const UniformName UNIFORM_NAME_AMBIENT_TEXTURE            = UniformName("u_ambientTexture");
+  inline static const UniformName UNIFORM_NAME_DIFFUSE_TEXTURE            = UniformName("u_diffuseTexture");
+  inline static const UniformName UNIFORM_NAME_SPECULAR_TEXTURE           = UniformName("u_specularTexture");
+  inline static const UniformName UNIFORM_NAME_NORMAL_MAP                 = UniformName("u_normalMap");
+  inline static const UniformName UNIFORM_NAME_AMBIENT_TEXTURE_FLAG       = UniformName("u_hasAmbientTexture");
+  inline static const UniformName UNIFORM_NAME_DIFFUSE_TEXTURE_FLAG       = UniformName("u_hasDiffuseTexture");
+  inline static const UniformName UNIFORM_NAME_SPECULAR_TEXTURE_FLAG      = UniformName("u_hasSpecularTexture");
+  inline static const UniformName UNIFORM_NAME_DEPTH_TEXTURE              = UniformName("u_depthTexture");
+
+  inline static const UniformName UNIFORM_NAME_POSITION_SCALE             = UniformName("u_positionScale");
+  inline static const UniformName UNIFORM_NAME_POSITION_OFFSET            = UniformName("u_positionOffset");
+  inline static const UniformName UNIFORM_NAME_OCT_NORMAL                 = UniformName("u_octNormal");
   // clang-format on
 
   inline static const std::string VERT_SHADER =
@@ -51,6 +56,11 @@ class DefaultModelShader {
       "uniform vec3 u_lightPos;\n"
       "uniform mat4 u_lightMvpMat;\n"
       "\n"
+      "// Decoding of the vertex layout ('util::VertexLayout')\n"
+      "uniform vec3 u_positionScale = vec3(1.0);\n"
+      "uniform vec3 u_positionOffset = vec3(0.0);\n"
+      "uniform float u_octNormal = 0.0;\n"
+      "\n"
       "out vec2 f_uv;\n"
       "out vec3 f_worldPos;\n"
       "out vec3 f_color;\n"
@@ -62,24 +72,36 @@ class DefaultModelShader {
       "out vec3 f_lightPosCameraSpace;\n"
       "out vec4 f_positionLightScreenSpace;\n"
       "\n"
+      "vec3 decodeOctNormal(vec2 e) {\n"
+      "    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+      "    float t = max(-n.z, 0.0);\n"
+      "    n.x += n.x >= 0.0 ? -t : t;\n"
+      "    n.y += n.y >= 0.0 ? -t : t;\n"
+      "    return normalize(n);\n"
+      "}\n"
+      "\n"
       "void main() {\n"
-      "    gl_Position = u_mvpMat * vec4(in_position, 1.0);\n"
+      "    vec3 position = in_position * u_positionScale + u_positionOffset;\n"
+      "    vec3 normal = u_octNormal > 0.5 ? decodeOctNormal(in_normal.xy) : in_normal;\n"
+      "\n"
+      "    gl_Position = u_mvpMat * vec4(position, 1.0);\n"
       "\n"
-      "    f_positionCameraSpace = (u_mvMat * vec4(in_position, 1.0)).xyz;\n"
-      "    f_normalCameraSpace = (u_normMat * vec4(in_normal, 0.0)).xyz;\n"
+      "    f_positionCameraSpace = (u_mvMat * vec4(position, 1.0)).xyz;\n"
+      "    f_normalCameraSpace = (u_normMat * vec4(normal, 0.0)).xyz;\n"
       "    f_lightPosCameraSpace = (u_lightMat * vec4(u_lightPos, 1.0)).xyz;\n"
-      "    f_positionLightScreenSpace = u_lightMvpMat * vec4(in_position, 1.0);\n"
+      "    f_positionLightScreenSpace = u_lightMvpMat * vec4(position, 1.0);\n"
       "\n"
-      "    f_worldPos = in_position;\n"
+      "    f_worldPos = position;\n"
       "    f_color = in_color;\n"
-      "    f_normal = in_normal;\n"
+      "    f_normal = normal;\n"
       "    f_barycentric = in_bary;\n"
       "    f_uv = in_uv;\n"
       "    f_id = in_id;\n"
       "}\n";
 
-  inline static const std::string FRAG_SHADER =
-      SIMVIEW_SHADER_VERSION
+  // NOTE: The fragment shader without the version line. 'DefaultBatchedModelShader' compiles it with 'SIMVIEW_BATCHED_DRAW',
+  //       where the per-object uniform variables are replaced with the draw parameters passed from the vertex shader.
+  inline static const std::string FRAG_SHADER_BODY =
       "\n"
       "in vec2 f_uv;\n"
       "in vec3 f_worldPos;\n"
@@ -92,14 +114,27 @@ class DefaultModelShader {
       "in vec3 f_lightPosCameraSpace;\n"
       "in vec4 f_positionLightScreenSpace;\n"
       "\n"
+      "#ifdef SIMVIEW_BATCHED_DRAW\n"
+      "flat in vec4 f_material;\n"
+      "#define u_renderType f_material.x\n"
+      "#define u_shadowMapping f_material.y\n"
+      "#define u_hasAmbientTexture f_material.z\n"
+      "#define u_hasDiffuseTexture f_material.z\n"
+      "#define u_hasSpecularTexture 0.0\n"
+      "#else\n"
       "uniform float u_renderType;\n"
+      "uniform float u_shadowMapping;\n"
+      "uniform float u_hasAmbientTexture;\n"
+      "uniform float u_hasDiffuseTexture;\n"
+      "uniform float u_hasSpecularTexture;\n"
+      "#endif\n"
+      "\n"
       "uniform float u_bumpMap;\n"
       "uniform float u_ambientIntensity;\n"
       "uniform vec3 u_ambientColor;\n"
       "uniform vec3 u_diffuseColor;\n"
       "uniform vec3 u_specularColor;\n"
       "uniform float u_shininess;\n"
-      "uniform float u_shadowMapping;\n"
       "\n"
       "uniform sampler2D u_ambientTexture;\n"
       "uniform sampler2D u_diffuseTexture;\n"
@@ -107,10 +142,6 @@ class DefaultModelShader {
       "uniform sampler2D u_normalMap;\n"
       "uniform sampler2D u_depthTexture;\n"
       "\n"
-      "uniform float u_hasAmbientTexture;\n"
-      "uniform float u_hasDiffuseTexture;\n"
-      "uniform float u_hasSpecularTexture;\n"
-      "\n"
       "out vec4 out_color;\n"
       "\n"
       "vec3 getAmbientColor() {\n"
@@ -238,11 +269,17 @@ class DefaultModelShader {
       "        out_color = vec4(f_normal, 1.0);\n"
       "    }\n"
       "}\n";
+
+  inline static const std::string FRAG_SHADER = SIMVIEW_SHADER_VERSION "\n" + FRAG_SHADER_BODY;
 };
 
 class DefaultDepthShader {
  public:
-  inline static const char* UNIFORM_NAME_LIGHT_MVP_MAT = "u_lightMvpMat";
+  // clang-format off
+  inline static const UniformName UNIFORM_NAME_LIGHT_MVP_MAT              = UniformName("u_lightMvpMat");
+  inline static const UniformName UNIFORM_NAME_POSITION_SCALE             = UniformName("u_positionScale");
+  inline static const UniformName UNIFORM_NAME_POSITION_OFFSET            = UniformName("u_positionOffset");
+  // clang-format on
 
   inline static const std::string VERT_SHADER =
       SIMVIEW_SHADER_VERSION
@@ -256,8 +293,13 @@ class DefaultDepthShader {
       "\n"
       "uniform mat4 u_lightMvpMat;\n"
       "\n"
+      "// Decoding of the vertex layout ('util::VertexLayout')\n"
+      "uniform vec3 u_positionScale = vec3(1.0);\n"
+      "uniform vec3 u_positionOffset = vec3(0.0);\n"
+      "\n"
       "void main() {\n"
-      "    gl_Position = u_lightMvpMat * vec4(in_position, 1.0);\n"
+      "    vec3 position = in_position * u_positionScale + u_positionOffset;\n"
+      "    gl_Position = u_lightMvpMat * vec4(position, 1.0);\n"
       "    // gl_Position = mat4(1.0f) * vec4(in_position, 1.0);\n"
       "}\n";
 
@@ -271,6 +313,307 @@ class DefaultDepthShader {
       "}\n";
 };
 
+/// @brief Model and depth shaders of the objects drawn by 'model::DrawBatcher'.
+///        The parameters of each object are read from a shader storage buffer at the base instance of its draw,
+///        so a single multi-draw call draws objects at different positions with different render types.
+///        The other uniform variables of 'DefaultModelShader' are shared by all draws, with the matrices of the scene.
+///        'gl_BaseInstance' needs GLSL 4.60.
+class DefaultBatchedModelShader {
+ public:
+  inline static const GLuint DRAW_PARAMS_BINDING = 0;
+
+  // NOTE: The same layout as 'model::DrawBatcher::DrawParams'
+  inline static const std::string DRAW_PARAMS_BUFFER =
+      "struct DrawParams {\n"
+      "    vec4 translation;\n"
+      "    vec4 positionScale;\n"
+      "    vec4 positionOffset;\n"
+      "    vec4 material; /* (renderType, shadowMapping, hasTexture, octNormal) */\n"
+      "};\n"
+      "\n"
+      "layout(std430, binding = 0) readonly buffer DrawParamsBuffer {\n"
+      "    DrawParams drawParams[];\n"
+      "};\n"
+      "\n";
+
+  inline static const std::string VERT_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "layout(location = 0) in vec3 in_position;\n"
+      "layout(location = 1) in vec3 in_color;\n"
+      "layout(location = 2) in vec3 in_normal;\n"
+      "layout(location = 3) in vec3 in_bary;\n"
+      "layout(location = 4) in vec2 in_uv;\n"
+      "layout(location = 5) in float in_id;\n"
+      "\n" +
+      DRAW_PARAMS_BUFFER +
+      "uniform mat4 u_mvpMat;\n"
+      "uniform mat4 u_mvMat;\n"
+      "uniform mat4 u_normMat;\n"
+      "uniform mat4 u_lightMat;\n"
+      "uniform vec3 u_lightPos;\n"
+      "uniform mat4 u_lightMvpMat;\n"
+      "\n"
+      "out vec2 f_uv;\n"
+      "out vec3 f_worldPos;\n"
+      "out vec3 f_color;\n"
+      "out vec3 f_normal;\n"
+      "out vec3 f_barycentric;\n"
+      "out float f_id;\n"
+      "out vec3 f_positionCameraSpace;\n"
+      "out vec3 f_normalCameraSpace;\n"
+      "out vec3 f_lightPosCameraSpace;\n"
+      "out vec4 f_positionLightScreenSpace;\n"
+      "flat out vec4 f_material;\n"
+      "\n"
+      "vec3 decodeOctNormal(vec2 e) {\n"
+      "    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+      "    float t = max(-n.z, 0.0);\n"
+      "    n.x += n.x >= 0.0 ? -t : t;\n"
+      "    n.y += n.y >= 0.0 ? -t : t;\n"
+      "    return normalize(n);\n"
+      "}\n"
+      "\n"
+      "void main() {\n"
+      "    DrawParams params = drawParams[gl_BaseInstance];\n"
+      "\n"
+      "    vec3 position = in_position * params.positionScale.xyz + params.positionOffset.xyz;\n"
+      "    vec3 normal = params.material.w > 0.5 ? decodeOctNormal(in_normal.xy) : in_normal;\n"
+      "\n"
+      "    // NOTE: Objects are only translated, so the normal matrix of the scene is valid for all of them\n"
+      "    vec4 translatedPosition = vec4(position + params.translation.xyz, 1.0);\n"
+      "\n"
+      "    gl_Position = u_mvpMat * translatedPosition;\n"
+      "\n"
+      "    f_positionCameraSpace = (u_mvMat * translatedPosition).xyz;\n"
+      "    f_normalCameraSpace = (u_normMat * vec4(normal, 0.0)).xyz;\n"
+      "    f_lightPosCameraSpace = (u_lightMat * vec4(u_lightPos, 1.0)).xyz;\n"
+      "    f_positionLightScreenSpace = u_lightMvpMat * translatedPosition;\n"
+      "\n"
+      "    f_worldPos = position;\n"
+      "    f_color = in_color;\n"
+      "    f_normal = normal;\n"
+      "    f_barycentric = in_bary;\n"
+      "    f_uv = in_uv;\n"
+      "    f_id = in_id;\n"
+      "    f_material = params.material;\n"
+      "}\n";
+
+  inline static const std::string FRAG_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "#define SIMVIEW_BATCHED_DRAW\n" +
+      DefaultModelShader::FRAG_SHADER_BODY;
+
+  inline static const std::string DEPTH_VERT_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "layout(location = 0) in vec3 in_position;\n"
+      "\n" +
+      DRAW_PARAMS_BUFFER +
+      "uniform mat4 u_lightMvpMat;\n"
+      "\n"
+      "void main() {\n"
+      "    DrawParams params = drawParams[gl_BaseInstance];\n"
+      "    vec3 position = in_position * params.positionScale.xyz + params.positionOffset.xyz + params.translation.xyz;\n"
+      "    gl_Position = u_lightMvpMat * vec4(position, 1.0);\n"
+      "}\n";
+
+  inline static const std::string DEPTH_FRAG_SHADER = DefaultDepthShader::FRAG_SHADER;
+};
+
+/// @brief Spheres drawn as instanced quads and ray-cast per fragment.
+///        Each instance is a sphere with the center in 'in_position', the color in 'in_color' and the radius in 'in_id'.
+///        The quad is perpendicular to the ray from the eye to the center, and sized to cover the silhouette of the sphere.
+///        Rays are built in model coords, so the same vertex shader works for the camera and the light.
+///        The model pass takes the uniform variables of 'DefaultModelShader'.
+class DefaultSphereImpostorShader {
+ public:
+  // clang-format off
+  inline static const UniformName UNIFORM_NAME_MVP_MAT                    = UniformName("u_mvpMat");
+  inline static const UniformName UNIFORM_NAME_INV_MVP_MAT                = UniformName("u_invMvpMat");
+  // clang-format on
+
+  inline static const std::string VERT_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "layout(location = 0) in vec3 in_position;\n"
+      "layout(location = 1) in vec3 in_color;\n"
+      "layout(location = 5) in float in_id;\n"
+      "\n"
+      "uniform mat4 u_mvpMat;\n"
+      "uniform mat4 u_invMvpMat;\n"
+      "\n"
+      "out vec3 f_quadPos;\n"
+      "out vec3 f_rayDir;\n"
+      "flat out vec3 f_center;\n"
+      "flat out float f_radius;\n"
+      "flat out vec3 f_color;\n"
+      "\n"
+      "void main() {\n"
+      "    vec3 center = in_position;\n"
+      "    float radius = in_id;\n"
+      "\n"
+      "    // The eye in homogeneous model coords. 'w' is zero for orthographic projections, and then 'xyz' is the view direction.\n"
+      "    vec4 eye = u_invMvpMat * vec4(0.0, 0.0, 1.0, 0.0);\n"
+      "    bool isPerspective = u_mvpMat[0][3] != 0.0 || u_mvpMat[1][3] != 0.0 || u_mvpMat[2][3] != 0.0;\n"
+      "\n"
+      "    vec3 axis;\n"
+      "    float halfSize;\n"
+      "\n"
+      "    if(isPerspective) {\n"
+      "        vec3 toCenter = center - eye.xyz / eye.w;\n"
+      "        float distance = length(toCenter);\n"
+      "\n"
+      "        if(distance <= radius) {\n"
+      "            // The eye is inside the sphere. Put the quad outside the clip volume.\n"
+      "            gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"
+      "            return;\n"
+      "        }\n"
+      "\n"
+      "        // Radius of the tangent cone at the center\n"
+      "        axis = toCenter / distance;\n"
+      "        halfSize = radius * distance / sqrt(distance * distance - radius * radius);\n"
+      "    } else {\n"
+      "        axis = normalize(eye.xyz);\n"
+      "        halfSize = radius;\n"
+      "    }\n"
+      "\n"
+      "    vec3 helper = abs(axis.y) < 0.99 ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);\n"
+      "    vec3 tangent = normalize(cross(axis, helper));\n"
+      "    // The quad faces the eye, so that it is not culled as a back face\n"
+      "    vec3 bitangent = cross(tangent, axis);\n"
+      "\n"
+      "    // Corners of a triangle strip\n"
+      "    vec2 corner = vec2((gl_VertexID & 1) == 0 ? -1.0 : 1.0, (gl_VertexID & 2) == 0 ? -1.0 : 1.0);\n"
+      "    vec3 position = center + halfSize * (corner.x * tangent + corner.y * bitangent);\n"
+      "\n"
+      "    gl_Position = u_mvpMat * vec4(position, 1.0);\n"
+      "\n"
+      "    f_quadPos = position;\n"
+      "    f_rayDir = isPerspective ? position - eye.xyz / eye.w : axis;\n"
+      "    f_center = center;\n"
+      "    f_radius = radius;\n"
+      "    f_color = in_color;\n"
+      "}\n";
+
+  inline static const std::string FRAG_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "in vec3 f_quadPos;\n"
+      "in vec3 f_rayDir;\n"
+      "flat in vec3 f_center;\n"
+      "flat in float f_radius;\n"
+      "flat in vec3 f_color;\n"
+      "\n"
+      "uniform mat4 u_mvpMat;\n"
+      "uniform mat4 u_mvMat;\n"
+      "uniform mat4 u_normMat;\n"
+      "uniform mat4 u_lightMat;\n"
+      "uniform vec3 u_lightPos;\n"
+      "uniform mat4 u_lightMvpMat;\n"
+      "\n"
+      "uniform float u_renderType;\n"
+      "uniform float u_ambientIntensity;\n"
+      "uniform float u_shininess;\n"
+      "uniform float u_shadowMapping;\n"
+      "uniform sampler2D u_depthTexture;\n"
+      "\n"
+      "out vec4 out_color;\n"
+      "\n"
+      "float calcShadow(vec4 fragPosLightSpace) {\n"
+      "    vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;\n"
+      "    projCoords = projCoords * 0.5 + 0.5;\n"
+      "    float closestDepth = texture(u_depthTexture, projCoords.xy).r;\n"
+      "    float currentDepth = projCoords.z;\n"
+      "    return currentDepth > closestDepth ? 1.0 : 0.0;\n"
+      "}\n"
+      "\n"
+      "void main() {\n"
+      "    // ================================================================================================================================\n"
+      "    // Ray casting\n"
+      "    // ================================================================================================================================\n"
+      "    vec3 rayDir = normalize(f_rayDir);\n"
+      "    vec3 oc = f_quadPos - f_center;\n"
+      "    float b = dot(oc, rayDir);\n"
+      "    float h = b * b - dot(oc, oc) + f_radius * f_radius;\n"
+      "\n"
+      "    if(h < 0.0) {\n"
+      "        discard;\n"
+      "    }\n"
+      "\n"
+      "    vec3 position = f_quadPos + (-b - sqrt(h)) * rayDir;\n"
+      "    vec4 clipPos = u_mvpMat * vec4(position, 1.0);\n"
+      "\n"
+      "    if(clipPos.w <= 0.0 || clipPos.z < -clipPos.w) {\n"
+      "        // Clipped by the near plane\n"
+      "        discard;\n"
+      "    }\n"
+      "\n"
+      "    gl_FragDepth = 0.5 * clipPos.z / clipPos.w + 0.5;\n"
+      "\n"
+      "    // ================================================================================================================================\n"
+      "    // Render\n"
+      "    // ================================================================================================================================\n"
+      "    vec3 normal = (position - f_center) / f_radius;\n"
+      "\n"
+      "    if(u_renderType > 1.5) {\n"
+      "        // Color with shading\n"
+      "        vec3 positionCameraSpace = (u_mvMat * vec4(position, 1.0)).xyz;\n"
+      "        vec3 lightPosCameraSpace = (u_lightMat * vec4(u_lightPos, 1.0)).xyz;\n"
+      "\n"
+      "        vec3 N = normalize((u_normMat * vec4(normal, 0.0)).xyz);\n"
+      "        vec3 V = normalize(-positionCameraSpace);\n"
+      "        vec3 L = normalize(lightPosCameraSpace - positionCameraSpace);\n"
+      "        vec3 H = normalize(V + L);\n"
+      "\n"
+      "        vec3 diffuse = f_color * max(0.0, dot(N, L));\n"
+      "        vec3 specular = vec3(pow(max(0.0, dot(N, H)), u_shininess));\n"
+      "        vec3 ambient = u_ambientIntensity * f_color;\n"
+      "\n"
+      "        float shadow = u_shadowMapping > 0.5 ? calcShadow(u_lightMvpMat * vec4(position, 1.0)) : 0.0;\n"
+      "\n"
+      "        out_color = vec4((1.0 - shadow) * (diffuse + specular) + ambient, 1.0);\n"
+      "    } else if(u_renderType > -0.5) {\n"
+      "        // Color\n"
+      "        out_color = vec4(f_color, 1.0);\n"
+      "    } else if(u_renderType > -1.5 && u_renderType < -0.5) {\n"
+      "        // Face Normal\n"
+      "        out_color = vec4((normal + 1.0) / 2.0, 1.0);\n"
+      "    } else if(u_renderType > -2.5 && u_renderType < -1.5) {\n"
+      "        // Mask\n"
+      "        out_color = vec4(1.0, 1.0, 1.0, 1.0);\n"
+      "    } else {\n"
+      "        // Vertex normal\n"
+      "        out_color = vec4(normal, 1.0);\n"
+      "    }\n"
+      "}\n";
+
+  inline static const std::string DEPTH_FRAG_SHADER =
+      SIMVIEW_SHADER_VERSION
+      "\n"
+      "in vec3 f_quadPos;\n"
+      "in vec3 f_rayDir;\n"
+      "flat in vec3 f_center;\n"
+      "flat in float f_radius;\n"
+      "\n"
+      "uniform mat4 u_mvpMat;\n"
+      "\n"
+      "void main() {\n"
+      "    vec3 rayDir = normalize(f_rayDir);\n"
+      "    vec3 oc = f_quadPos - f_center;\n"
+      "    float b = dot(oc, rayDir);\n"
+      "    float h = b * b - dot(oc, oc) + f_radius * f_radius;\n"
+      "\n"
+      "    if(h < 0.0) {\n"
+      "        discard;\n"
+      "    }\n"
+      "\n"
+      "    vec4 clipPos = u_mvpMat * vec4(f_quadPos + (-b - sqrt(h)) * rayDir, 1.0);\n"
+      "    gl_FragDepth = 0.5 * clipPos.z / clipPos.w + 0.5;\n"
+      "}\n";
+};
+
 class DefaultDepthQuadShader {
  public:
   inline static const std::string VERT_SHADER =
@@ -309,8 +652,8 @@ class DefaultDepthQuadShader {
 class DefaultLineShader {
  public:
   // clang-format off
-  inline static const char* UNIFORM_NAME_MVP_MAT                    = "u_mvpMat";
-  inline static const char* UNIFORM_NAME_LINE_COLOER                = "u_lineColor";
+  inline static const UniformName UNIFORM_NAME_MVP_MAT                    = UniformName("u_mvpMat");
+  inline static const UniformName UNIFORM_NAME_LINE_COLOER                = UniformName("u_lineColor");
   // clang-format on
 
   inline static const std::string VERT_SHADER =
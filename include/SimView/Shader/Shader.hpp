@@ -2,52 +2,27 @@
 
 #include <SimView/OpenGL.hpp>
 #include <SimView/Shader/ShaderCompiler.hpp>
+#include <SimView/Shader/UniformName.hpp>
+#include <SimView/Util/GLStateCache.hpp>
 #include <SimView/Util/Logging.hpp>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace simview {
 namespace shader {
 
 class Shader {
  private:
-  inline const static int MAX_NUM_TEXTURES = 32;
-  inline const static int GL_TEXTURE_IDS[MAX_NUM_TEXTURES] = {
-      GL_TEXTURE0,
-      GL_TEXTURE1,
-      GL_TEXTURE2,
-      GL_TEXTURE3,
-      GL_TEXTURE4,
-      GL_TEXTURE5,
-      GL_TEXTURE6,
-      GL_TEXTURE7,
-      GL_TEXTURE8,
-      GL_TEXTURE9,
-      GL_TEXTURE10,
-      GL_TEXTURE11,
-      GL_TEXTURE12,
-      GL_TEXTURE13,
-      GL_TEXTURE14,
-      GL_TEXTURE15,
-      GL_TEXTURE16,
-      GL_TEXTURE17,
-      GL_TEXTURE18,
-      GL_TEXTURE19,
-      GL_TEXTURE20,
-      GL_TEXTURE21,
-      GL_TEXTURE22,
-      GL_TEXTURE23,
-      GL_TEXTURE24,
-      GL_TEXTURE25,
-      GL_TEXTURE26,
-      GL_TEXTURE27,
-      GL_TEXTURE28,
-      GL_TEXTURE29,
-      GL_TEXTURE30,
-      GL_TEXTURE31};
-
   GLuint _shaderID;
   int _textureCounter = 0;
 
+  // NOTE: Locations of 'UniformName's indexed by their IDs. -1 if the program does not have the variable.
+  mutable std::vector<GLint> _uniformLocations;
+
+  // NOTE: Locations of variables set by arbitrary names
+  mutable std::unordered_map<std::string, GLint> _namedUniformLocations;
+
  protected:
   int _textureCounterOffset;
 
@@ -55,16 +30,27 @@ class Shader {
   // Nothing
 
  private:
-  // Nothing
+  GLint getUniformLocation(const UniformName& name) const;
+  GLint getUniformLocation(const std::string& name) const;
 
  protected:
   void setShaders(const std::string& vertShaderCode, const std::string& fragShaderCode);
   virtual ~Shader();
 
  public:
+  /// @brief Use the program. The depth test is enabled unless `disableDepthTest`, and blending and line smoothing are disabled.
   void bind(const bool& disableDepthTest = false);
+
+  /// @brief Restore the depth test. The program and the textures stay bound, so that binding them again for the next draw is elided.
   void unbind();
 
+  void setUniformVariable(const UniformName& name, const glm::mat4& matrix) const;
+  void setUniformVariable(const UniformName& name, const glm::vec3& vec) const;
+  void setUniformVariable(const UniformName& name, const float& value) const;
+  void setUniformVariable(const UniformName& name, const int& value) const;
+  void setUniformVariable(const UniformName& name, const bool& value) const;
+  void setUniformTexture(const UniformName& name, const GLuint& textureId);
+
   void setUniformVariable(const std::string& name, const glm::mat4& matrix) const;
   void setUniformVariable(const std::string& name, const glm::vec3& vec) const;
   void setUniformVariable(const std::string& name, const float& value) const;
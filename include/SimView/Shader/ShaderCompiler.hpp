@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SimView/OpenGL.hpp>
+#include <SimView/Util/GLStateCache.hpp>
 #include <SimView/Util/Logging.hpp>
 #include <fstream>
 #include <iostream>
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace simview {
+namespace shader {
+
+/// @brief Name of a uniform variable with an ID assigned at static initialization.
+///        Shaders resolve the locations of all names once after linking, into a table indexed by the IDs,
+///        so setting a uniform variable is an array lookup. Names must be static constants, like the ones in 'DefaultShaders.hpp'.
+class UniformName {
+ private:
+  size_t _id;
+  const char* _name;
+
+  static std::vector<const char*>& getRegistry() {
+    static std::vector<const char*> registry;
+    return registry;
+  };
+
+ public:
+  explicit UniformName(const char* name)
+      : _id(getRegistry().size()),
+        _name(name) {
+    getRegistry().push_back(name);
+  };
+
+  size_t getId() const { return _id; };
+  const char* getName() const { return _name; };
+
+  static size_t getNumNames() { return getRegistry().size(); };
+  static const char* getName(const size_t id) { return getRegistry()[id]; };
+};
+
+}  // namespace shader
+}  // namespace simview
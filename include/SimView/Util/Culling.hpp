@@ -0,0 +1,95 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief View frustum as six planes whose normals point inside.
+///        The planes are extracted from a `proj * view * model` matrix, so they are in the model space of the matrix.
+class Frustum {
+ private:
+  std::array<glm::vec4, 6> _planes;
+
+ public:
+  Frustum();
+  explicit Frustum(const glm::mat4& mvpMat);
+  ~Frustum() = default;
+
+  /// @brief Conservative test of an axis-aligned box. A box near a corner of the frustum may pass without being inside.
+  bool intersects(const glm::vec3& minCoords, const glm::vec3& maxCoords) const;
+
+  const std::array<glm::vec4, 6>& getPlanes() const { return _planes; };
+};
+
+/// @brief Bounding volume hierarchy over axis-aligned boxes, used to cull items against a frustum.
+///
+/// [Layout]
+///   Nodes are stored in depth-first order, so the left child of an inner node is the next node, and
+///   every node comes before its children. Item ids of a leaf are 'itemIds[first, first + nItems)'.
+///
+/// [Update]
+///   'build' splits the items at the median of the longest axis of their centers. When the items move but
+///   stay the same, 'refit' recomputes the bounds of the same tree in one backward pass over the nodes.
+class BoundingVolumeHierarchy {
+ public:
+  struct Box {
+    glm::vec3 minCoords;
+    glm::vec3 maxCoords;
+  };
+
+ private:
+  struct Node {
+    Box bounds;
+
+    // NOTE: Index of the right child. The node is a leaf if it is negative.
+    int32_t right;
+    uint32_t first;
+    uint32_t nItems;
+  };
+
+  inline static const uint32_t MAX_LEAF_ITEMS = 4;
+
+  // NOTE: Subtrees with fewer items are traversed on the calling thread
+  inline static const uint32_t PARALLEL_QUERY_THRESHOLD = 4096;
+
+  std::vector<Node> _nodes;
+  std::vector<uint32_t> _itemIds;
+  std::vector<Box> _boxes;
+
+  int32_t buildNode(const std::vector<glm::vec3>& centers, const uint32_t first, const uint32_t nItems);
+
+  void querySubtree(const Frustum& frustum, const int32_t iRoot, std::vector<uint8_t>& isInside) const;
+
+  Box calcBounds(const uint32_t first, const uint32_t nItems) const;
+  static Box merge(const Box& box0, const Box& box1);
+
+ protected:
+  // nothing
+ public:
+  BoundingVolumeHierarchy();
+  ~BoundingVolumeHierarchy() = default;
+
+  void build(const std::vector<Box>& boxes);
+
+  /// @brief Recompute the bounds for moved boxes. The number of boxes must be the same as in 'build'.
+  void refit(const std::vector<Box>& boxes);
+
+  /// @brief Test the boxes against a frustum. Large trees are traversed in parallel below their top levels.
+  /// @param isInside Output flags, one per box
+  void query(const Frustum& frustum, std::vector<uint8_t>& isInside) const;
+
+  size_t getNumItems() const { return _itemIds.size(); };
+  size_t getNumNodes() const { return _nodes.size(); };
+};
+
+}  // namespace util
+}  // namespace simview
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 
@@ -22,7 +24,12 @@ class FileUtil {
   static bool exists(const std::string);
   static bool isFile(const std::string);
   static bool isAbsolute(const std::string);
+  static uintmax_t fileSize(const std::string);
+  static int64_t lastWriteTime(const std::string);
   static std::string getTimeStamp();
+
+  /// @brief Path next to 'path' which no other thread or process gets, e.g. for a file renamed into place after writing
+  static std::string uniquePath(const std::string path);
 };
 
 }  // namespace util
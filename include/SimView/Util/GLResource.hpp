@@ -0,0 +1,139 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+enum class GLResourceType : int {
+  BUFFER,
+  VERTEX_ARRAY,
+  TEXTURE,
+  FRAMEBUFFER,
+  RENDERBUFFER
+};
+
+/// @brief Names of GL objects waiting to be deleted on the GL thread.
+///
+/// [Deferred deletion]
+///   Handles may be destroyed on any thread, e.g. when a worker drops the last reference to a cancelled object,
+///   so they only push their names here. 'flush' deletes them in batches and must be called on the GL thread,
+///   which the renderer does at the start of every frame.
+class GLDeletionQueue {
+ private:
+  inline static const size_t NUM_RESOURCE_TYPES = 5;
+
+  std::mutex _mutex;
+  std::array<std::vector<GLuint>, NUM_RESOURCE_TYPES> _pendingNames;
+  std::array<std::vector<GLuint>, NUM_RESOURCE_TYPES> _flushedNames;
+
+  size_t _nDeletedNames;
+
+  GLDeletionQueue();
+
+ public:
+  GLDeletionQueue(const GLDeletionQueue&) = delete;
+  GLDeletionQueue& operator=(const GLDeletionQueue&) = delete;
+
+  ~GLDeletionQueue() = default;
+
+  static GLDeletionQueue& getInstance();
+
+  /// @brief Queue a name for deletion. Thread safe.
+  void push(const GLResourceType type, const GLuint name);
+
+  /// @brief Delete the queued names. Must be called on the GL thread.
+  /// @return `nDeletedNames` (`size_t`)
+  size_t flush();
+
+  size_t getNumPendingNames();
+
+  /// @brief Names deleted since the start
+  size_t getNumDeletedNames() const { return _nDeletedNames; };
+};
+
+/// @brief Move-only owner of a GL object. The name is queued in 'GLDeletionQueue' when the handle is reset or destroyed.
+///        It converts to 'GLuint', so it can be passed to GL calls like a raw name.
+template <GLResourceType Type>
+class GLHandle {
+ private:
+  GLuint _name;
+
+ public:
+  GLHandle()
+      : _name(0) {};
+
+  /// @brief Take the ownership of an existing name
+  explicit GLHandle(const GLuint name)
+      : _name(name) {};
+
+  ~GLHandle() { reset(); };
+
+  GLHandle(const GLHandle&) = delete;
+  GLHandle& operator=(const GLHandle&) = delete;
+
+  GLHandle(GLHandle&& other) noexcept
+      : _name(other.release()) {};
+
+  GLHandle& operator=(GLHandle&& other) noexcept {
+    if (this != &other) {
+      reset(other.release());
+    }
+    return *this;
+  };
+
+  /// @brief Generate a new name, releasing the current one. Must be called on the GL thread.
+  /// @return `name` (`GLuint`)
+  GLuint create() {
+    GLuint name = 0;
+
+    if constexpr (Type == GLResourceType::BUFFER) {
+      glGenBuffers(1, &name);
+    } else if constexpr (Type == GLResourceType::VERTEX_ARRAY) {
+      glGenVertexArrays(1, &name);
+    } else if constexpr (Type == GLResourceType::TEXTURE) {
+      glGenTextures(1, &name);
+    } else if constexpr (Type == GLResourceType::FRAMEBUFFER) {
+      glGenFramebuffers(1, &name);
+    } else if constexpr (Type == GLResourceType::RENDERBUFFER) {
+      glGenRenderbuffers(1, &name);
+    }
+
+    reset(name);
+    return _name;
+  };
+
+  /// @brief Queue the current name for deletion and own `name` instead
+  void reset(const GLuint name = 0) {
+    if (_name != 0 && _name != name) {
+      GLDeletionQueue::getInstance().push(Type, _name);
+    }
+    _name = name;
+  };
+
+  /// @brief Give up the ownership without deleting
+  /// @return `name` (`GLuint`)
+  GLuint release() {
+    const GLuint name = _name;
+    _name = 0;
+    return name;
+  };
+
+  GLuint get() const { return _name; };
+  bool isValid() const { return _name != 0; };
+  operator GLuint() const { return _name; };
+};
+
+using GLBuffer = GLHandle<GLResourceType::BUFFER>;
+using GLVertexArray = GLHandle<GLResourceType::VERTEX_ARRAY>;
+using GLTexture = GLHandle<GLResourceType::TEXTURE>;
+using GLFramebuffer = GLHandle<GLResourceType::FRAMEBUFFER>;
+using GLRenderbuffer = GLHandle<GLResourceType::RENDERBUFFER>;
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace simview {
+namespace util {
+
+/// @brief Shadow copy of the GL state of the current context. Calls which would not change the state are elided.
+///
+/// [Tracked state]
+///   The current program, the vertex array, the active texture unit, the 2D texture of each unit,
+///   and the capabilities in 'TRACKED_CAPABILITIES'. Other capabilities are passed through.
+///
+/// [Coherence]
+///   The tracked state must only be changed through this class. Code which changes it behind the cache
+///   (e.g. the ImGui backend) must be followed by 'invalidate', and deleted objects must be forgotten
+///   before their names are reused.
+class GLStateCache {
+ private:
+  inline static const GLuint UNKNOWN_NAME = 0xFFFFFFFFu;
+  inline static const GLuint MAX_NUM_TEXTURE_UNITS = 32;
+
+  inline static const GLenum TRACKED_CAPABILITIES[] = {
+      GL_DEPTH_TEST,
+      GL_BLEND,
+      GL_LINE_SMOOTH,
+      GL_CULL_FACE,
+      GL_MULTISAMPLE};
+  inline static const size_t NUM_TRACKED_CAPABILITIES = sizeof(TRACKED_CAPABILITIES) / sizeof(GLenum);
+
+  enum class CapabilityState : int8_t {
+    UNKNOWN = -1,
+    DISABLED = 0,
+    ENABLED = 1
+  };
+
+  GLuint _program;
+  GLuint _vertexArray;
+  GLuint _activeTextureUnit;
+  std::array<GLuint, MAX_NUM_TEXTURE_UNITS> _textures2D;
+  std::array<CapabilityState, NUM_TRACKED_CAPABILITIES> _capabilities;
+
+  size_t _nIssuedCalls;
+  size_t _nElidedCalls;
+
+  GLStateCache();
+
+  static int findCapability(const GLenum capability);
+
+ public:
+  GLStateCache(const GLStateCache&) = delete;
+  GLStateCache& operator=(const GLStateCache&) = delete;
+
+  ~GLStateCache() = default;
+
+  /// @brief Cache of the GL context. The viewer renders on one context from the GL thread.
+  static GLStateCache& getInstance();
+
+  /// @brief Forget the tracked state, so that the next call of each kind is issued
+  void invalidate();
+
+  void useProgram(const GLuint program);
+  void bindVertexArray(const GLuint vertexArray);
+
+  /// @param unit Index of the texture unit, not 'GL_TEXTUREi'
+  void activeTexture(const GLuint unit);
+
+  /// @brief Bind a 2D texture to the active texture unit
+  void bindTexture2D(const GLuint texture);
+
+  void enable(const GLenum capability);
+  void disable(const GLenum capability);
+  void setEnabled(const GLenum capability, const bool isEnabled);
+
+  /// @brief Forget a vertex array which is going to be deleted. GL unbinds it if it is bound.
+  void forgetVertexArray(const GLuint vertexArray);
+
+  /// @brief Forget a texture which is going to be deleted. GL unbinds it from every unit.
+  void forgetTexture(const GLuint texture);
+
+  void resetStatistics();
+  size_t getNumIssuedCalls() const { return _nIssuedCalls; };
+  size_t getNumElidedCalls() const { return _nElidedCalls; };
+};
+
+}  // namespace util
+}  // namespace simview
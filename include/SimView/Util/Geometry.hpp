@@ -3,47 +3,199 @@
 #include <SimView/Util/DataStructure.hpp>
 #include <SimView/Util/Logging.hpp>
 #include <SimView/Util/Math.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace simview {
 namespace util {
 
-class TriangleBucket {
+/// @brief Uniform grid spatial index stored in CSR form.
+///        Item ids are counting-sorted by cell into one contiguous array, and `_cellOffsets[iCell]`
+///        points to the head of the ids in each cell, so a cell lookup is two loads without any pointer chasing.
+class UniformGrid {
  public:
-  using Bucket_t = vec_pt<vec_pt<vec_pt<vec_pt<int>>>>;
+  /// @brief Item ids in one cell
+  struct CellRange {
+    const uint32_t *first;
+    const uint32_t *last;
+
+    const uint32_t *begin() const { return first; }
+    const uint32_t *end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+  };
 
  private:
-  inline static const int INVALID_ID = -1;
-  inline static const float COEFF_FOR_INTERVAL_OF_BUCKETS = 1.05f;
+  // NOTE: Upper limit of the number of cells to bound the memory of '_cellOffsets'
+  inline static const size_t MAX_NUM_CELLS = 1ULL << 27;
+  inline static const float COEFF_FOR_INTERVAL = 1.05f;
 
   float _interval;
   vec3f_t _minCoords;
   vec3f_t _maxCoords;
-  int _nBucketsX;
-  int _nBucketsY;
-  int _nBucketsZ;
+  vec3i_t _nCells;
 
-  Bucket_t _bucket;
+  std::vector<uint32_t> _cellOffsets;
+  std::vector<uint32_t> _itemIds;
 
  public:
-  TriangleBucket();
-  ~TriangleBucket();
+  UniformGrid();
+  ~UniformGrid();
+
+  /// @brief Build the grid over points
+  /// @param coords Point coordinates arranged like `[x0, y0, z0, x1, y1, z1, ...]`
+  /// @param nItems Number of points
+  /// @param interval Cell size. It is enlarged if the grid would exceed `MAX_NUM_CELLS`.
+  void build(const float *coords, const size_t nItems, const float interval);
+  void build(const vecf_pt &coords, const float interval);
+
+  /// @brief Compute a cell size which divides the longest side of the bounds into `nDivs` cells
+  static float calcInterval(const vec3f_t &minCoords, const vec3f_t &maxCoords, const int nDivs);
+
+  float getInterval() const { return _interval; }
+  const vec3i_t &getNumCells() const { return _nCells; }
+  size_t getNumItems() const { return _itemIds.size(); }
+
+  int toCellIndexX(const float &) const;
+  int toCellIndexY(const float &) const;
+  int toCellIndexZ(const float &) const;
+
+  inline size_t toFlatIndex(const int &x, const int &y, const int &z) const {
+    return (static_cast<size_t>(z) * _nCells[1] + y) * _nCells[0] + x;
+  }
 
-  void initBucket(const float &, const vec3f_t &, const vec3f_t &);
-  void resetBuckets();
+  CellRange getIdsInCell(const int &, const int &, const int &) const;
+  CellRange getIdsInCell(const float &, const float &, const float &) const;
 
-  int toBucketIndexX(const float &) const;
-  int toBucketIndexY(const float &) const;
-  int toBucketIndexZ(const float &) const;
+  /// @brief Visit ids of the items in all cells overlapping the box.
+  ///        These are candidates; the caller is responsible for the exact test.
+  template <class Func>
+  void forEachInBox(const vec3f_t &minCorner, const vec3f_t &maxCorner, Func &&func) const {
+    if (_itemIds.empty()) {
+      return;
+    }
+
+    const int minX = toCellIndexX(minCorner[0]);
+    const int minY = toCellIndexY(minCorner[1]);
+    const int minZ = toCellIndexZ(minCorner[2]);
+    const int maxX = toCellIndexX(maxCorner[0]);
+    const int maxY = toCellIndexY(maxCorner[1]);
+    const int maxZ = toCellIndexZ(maxCorner[2]);
 
-  vec_pt<int> getIdsInBucket(const int &, const int &, const int &) const;
-  vec_pt<int> getIdsInBucket(const float &, const float &, const float &) const;
-  void addToBucket(const float &, const float &, const float &, const int &);
+    for (int z = minZ; z <= maxZ; ++z) {
+      for (int y = minY; y <= maxY; ++y) {
+        const size_t iRowHead = toFlatIndex(0, y, z);
+        const uint32_t *first = _itemIds.data() + _cellOffsets[iRowHead + minX];
+        const uint32_t *last = _itemIds.data() + _cellOffsets[iRowHead + maxX + 1];
+
+        // NOTE: Cells in a row are contiguous, so a row is one range
+        for (const uint32_t *id = first; id != last; ++id) {
+          func(*id);
+        }
+      }
+    }
+  }
+
+  /// @brief Visit ids of the items in the cell containing the point and its 26 neighbor cells
+  template <class Func>
+  void forEachInNeighborCells(const float &x, const float &y, const float &z, Func &&func) const {
+    const vec3f_t minCorner = {x - _interval, y - _interval, z - _interval};
+    const vec3f_t maxCorner = {x + _interval, y + _interval, z + _interval};
+    forEachInBox(minCorner, maxCorner, std::forward<Func>(func));
+  }
 };
 
-using TriangleBucket_t = std::shared_ptr<TriangleBucket>;
+/// @brief Uniform grid spatial index over the occupied cells only.
+///        Cells are found by their quantized coords in an open-addressing hash table, so the memory is linear in the number of items
+///        however small the cells are. Item ids are counting-sorted by cell in CSR form like `UniformGrid`.
+class SparseGrid {
+ public:
+  using CellRange = UniformGrid::CellRange;
+
+ private:
+  // NOTE: A cell key packs the quantized coords with 'KEY_BITS' bits per axis
+  inline static const int KEY_BITS = 21;
+  inline static const int64_t MAX_CELL_INDEX = (1LL << KEY_BITS) - 2;
+  inline static const uint64_t EMPTY_KEY = ~0ULL;
+  inline static const uint32_t INVALID_CELL = std::numeric_limits<uint32_t>::max();
+
+  float _interval;
+  vec3f_t _minCoords;
+
+  // NOTE: Hash table from a cell key to the cell id. Its size is a power of two.
+  std::vector<uint64_t> _slotKeys;
+  std::vector<uint32_t> _slotCells;
+
+  std::vector<uint64_t> _cellKeys;
+  std::vector<uint32_t> _cellOffsets;
+  std::vector<uint32_t> _itemIds;
+
+  int64_t toCellIndex(const float &coord, const int &iAxis) const;
+
+  static inline uint64_t toCellKey(const int64_t &x, const int64_t &y, const int64_t &z) {
+    return ((uint64_t)z << (2 * KEY_BITS)) | ((uint64_t)y << KEY_BITS) | (uint64_t)x;
+  }
+
+  inline size_t toSlot(const uint64_t &key) const {
+    // NOTE: Fibonacci hashing, so that neighboring keys spread over the table
+    return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & (_slotKeys.size() - 1);
+  }
+
+  uint32_t findCell(const uint64_t &key) const;
+
+ public:
+  SparseGrid();
+  ~SparseGrid();
+
+  /// @brief Build the grid over points
+  /// @param coords Point coordinates arranged like `[x0, y0, z0, x1, y1, z1, ...]`
+  /// @param nItems Number of points
+  /// @param interval Cell size. It is enlarged if a side of the bounds would exceed 'MAX_CELL_INDEX' cells.
+  void build(const float *coords, const size_t nItems, const float interval);
+
+  float getInterval() const { return _interval; }
+  size_t getNumCells() const { return _cellKeys.size(); }
+  size_t getNumItems() const { return _itemIds.size(); }
+
+  CellRange getIdsInCell(const uint32_t &iCell) const {
+    return {_itemIds.data() + _cellOffsets[iCell], _itemIds.data() + _cellOffsets[iCell + 1]};
+  }
+
+  /// @brief Visit the ids of the items in each occupied cell among the cell and its 26 neighbor cells.
+  ///        `func(range)` is called once per cell, so the cells are looked up once for all items in the cell.
+  template <class Func>
+  void forEachNeighborCell(const uint32_t &iCell, Func &&func) const {
+    const uint64_t key = _cellKeys[iCell];
+    const uint64_t mask = (1ULL << KEY_BITS) - 1;
+
+    const int64_t cellX = (int64_t)(key & mask);
+    const int64_t cellY = (int64_t)((key >> KEY_BITS) & mask);
+    const int64_t cellZ = (int64_t)(key >> (2 * KEY_BITS));
+
+    for (int64_t iZ = cellZ - 1; iZ <= cellZ + 1; ++iZ) {
+      for (int64_t iY = cellY - 1; iY <= cellY + 1; ++iY) {
+        for (int64_t iX = cellX - 1; iX <= cellX + 1; ++iX) {
+          if (iX < 0 || iY < 0 || iZ < 0) {
+            continue;
+          }
+
+          const uint32_t jCell = findCell(toCellKey(iX, iY, iZ));
+          if (jCell != INVALID_CELL) {
+            func(getIdsInCell(jCell));
+          }
+        }
+      }
+    }
+  }
+};
 
 class Geometry {
  public:
@@ -67,28 +219,102 @@ class Geometry {
   template <class Coord_t = float>
   static std::pair<vec3_t<Coord_t>, vec3_t<Coord_t>> calcModelBounds(const vec_pt<Coord_t> &vertexCoords);
 
-  template <class Indexing_t = uint32_t, class Coord_t = float>
-  static vec_pt<Indexing_t> extractSurfaceTriangle(const int &nDivsBucket,
-                                                   const vec_pt<Indexing_t> &originalTriangles,
-                                                   const vec_pt<Coord_t> &vertexCoords);
+  /// @brief Extract triangles which are not shared with any other triangle, i.e. the surface of a volume mesh
+  /// @param originalTriangles Vertex indices arranged like `[i0, j0, k0, i1, j1, k1, ...]`
+  /// @return `Surface triangles` (`vec_pt<Indexing_t>`): in the same order and orientation as the input
+  template <class Indexing_t = uint32_t>
+  static vec_pt<Indexing_t> extractSurfaceTriangle(const vec_pt<Indexing_t> &originalTriangles);
 
-  template <class Coord_t = float>
-  static void calcVertexNormals(const int &nNodes,
-                                const vec_pt<Coord_t> &triangles);
+  /// @brief Build the vertex-to-face adjacency in CSR form in parallel.
+  ///        The ids of the faces around vertex `i` are `faceIds[offsets[i]] ... faceIds[offsets[i + 1] - 1]` in ascending order.
+  /// @param triangles Vertex indices arranged like `[i0, j0, k0, i1, j1, k1, ...]`
+  /// @param nNodes Number of vertices
+  /// @param offsets Head of the faces of each vertex. Its size is `nNodes + 1`.
+  /// @param faceIds Face ids sorted by vertex
+  static void calcVertexToFaceAdjacency(const vec_pt<uint32_t> &triangles,
+                                        const size_t nNodes,
+                                        std::vector<uint32_t> &offsets,
+                                        std::vector<uint32_t> &faceIds);
+
+  /// @brief Smooth vertex normals. Each is the sum of the normals of the faces around the vertex weighted by their areas.
+  /// @param vertexCoords Vertex coords arranged like `[x0, y0, z0, x1, y1, z1, ...]`
+  /// @param triangles Vertex indices
+  /// @return `Vertex normals` (`vecf_pt`): Unit normals arranged like the coords. Zero for vertices without faces.
+  static vecf_pt calcVertexNormals(const vecf_pt &vertexCoords,
+                                   const vec_pt<uint32_t> &triangles);
+
+  /// @brief Smooth normals of face corners with a crease angle.
+  ///        A corner averages the faces around its vertex whose normals are within `creaseAngle` of its own face,
+  ///        so edges sharper than the angle stay sharp. `0` gives flat shading and `pi` gives `calcVertexNormals`.
+  /// @param vertexCoords Vertex coords arranged like `[x0, y0, z0, x1, y1, z1, ...]`
+  /// @param triangles Vertex indices
+  /// @param creaseAngle Crease angle in radians
+  /// @return `Corner normals` (`vecf_pt`): Unit normals of the corners in the order of `triangles`, i.e. 9 floats per triangle
+  static vecf_pt calcCornerNormals(const vecf_pt &vertexCoords,
+                                   const vec_pt<uint32_t> &triangles,
+                                   const float creaseAngle);
+
+  /// @brief Group the corners which share a node and a corner normal, i.e. the corners on the same side of the creases around the node.
+  ///        Each group becomes one vertex of an indexed mesh.
+  /// @param triangles Vertex indices
+  /// @param nNodes Number of vertices
+  /// @param cornerNormals Normals of the corners from `calcCornerNormals`
+  /// @return `First corners` (`std::vector<uint32_t>`): For each corner, the first corner of its group. It is never after the corner.
+  static std::vector<uint32_t> calcCreaseGroups(const vec_pt<uint32_t> &triangles,
+                                                const size_t nNodes,
+                                                const vecf_pt &cornerNormals);
 
+  /// @brief Weld vertices which are within `threshold` of each other along every axis.
+  ///        Each vertex is merged into the lowest-indexed vertex found in its neighbor cells of a `SparseGrid`
+  ///        whose cells are as large as the threshold, so each vertex only meets the vertices nearby.
+  /// @param srcVertices Vertex coords arranged like `[x0, y0, z0, x1, y1, z1, ...]`
+  /// @param srcIndices Vertex indices
+  /// @param distVertices Welded vertex coords
+  /// @param distIndices Vertex indices remapped to `distVertices`
+  /// @param threshold Distance along each axis. `0` welds only exact duplicates.
   static void removeDuplecatedVertices(
       const vecf_pt &srcVertices,
       const veci_pt &srcIndices,
       vecf_pt &distVertices,
       veci_pt &distIndices,
       const float &threshold);
+
+  /// @brief Weld vertices which are within `threshold` of each other along every axis
+  ///        and whose color, normal and uv are also the same (barycentric coords and ids are ignored).
+  static void removeDuplecatedVertices(
+      const VertexArray_t &srcVertices,
+      const IndexArray_t &srcIndices,
+      VertexArray_t &distVertices,
+      IndexArray_t &distIndices,
+      const float &threshold);
+
+ private:
+  inline static const float WELD_ATTRIBUTE_THRESHOLD = 1e-4f;
+
+  /// @brief Face normals in SoA form, so that the loops over faces run on contiguous floats
+  struct FaceNormals {
+    // NOTE: Not normalized. The length is twice the area of the face.
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+
+    // NOTE: Zero for degenerate faces
+    std::vector<float> invLength;
+  };
+
+  static void calcFaceNormals(const vecf_pt &vertexCoords,
+                              const vec_pt<uint32_t> &triangles,
+                              FaceNormals &faceNormals);
+
+  template <class IsCompatible>
+  static std::vector<uint32_t> calcWeldMap(const float *coords,
+                                           const size_t nVertices,
+                                           const float threshold,
+                                           IsCompatible &&isCompatible);
 };
 
-// Type specialization
-template <>
-vec_pt<uint32_t> Geometry::extractSurfaceTriangle<uint32_t, float>(const int &,
-                                                                   const vec_pt<uint32_t> &,
-                                                                   const vec_pt<float> &);
+// Explicit instantiation
+extern template vec_pt<uint32_t> Geometry::extractSurfaceTriangle<uint32_t>(const vec_pt<uint32_t> &);
 
 }  // namespace util
 }  // namespace simview
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/VertexLayout.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Large vertex and index buffers shared by the static meshes of one vertex layout.
+///
+/// [Allocation]
+///   Each mesh gets a range of vertices and a range of indices. Indices are kept relative to the mesh,
+///   and the first vertex of the range is passed as the base vertex of the draw.
+///   Released ranges are merged with their free neighbours and reused by later allocations.
+///   The buffers are doubled when no free range is large enough.
+///
+/// [Draw]
+///   All meshes share one VAO, so a set of meshes can be drawn by a single multi-draw call.
+class GpuBufferArena {
+ public:
+  struct Range {
+    GLuint baseVertex = 0;
+    GLuint nVertices = 0;
+    GLuint firstIndex = 0;
+    GLuint nIndices = 0;
+  };
+
+ private:
+  /// @brief Free ranges of a buffer in elements, first-fit
+  class FreeList {
+   private:
+    // NOTE: Offset -> size of free ranges, which are never adjacent
+    std::map<size_t, size_t> _freeRanges;
+    size_t _capacity;
+
+   public:
+    inline static const size_t INVALID_OFFSET = (size_t)-1;
+
+    FreeList();
+
+    /// @return `offset` (`size_t`): 'INVALID_OFFSET' if no free range is large enough
+    size_t allocate(const size_t size);
+    void release(const size_t offset, const size_t size);
+
+    /// @brief Append a free range at the end
+    void grow(const size_t capacity);
+
+    size_t getCapacity() const { return _capacity; };
+  };
+
+  inline static const size_t INITIAL_NUM_VERTICES = 64 * 1024;
+  inline static const size_t INITIAL_NUM_INDICES = 3 * INITIAL_NUM_VERTICES;
+
+  VertexLayout _vertexLayout;
+
+  GLVertexArray _vaoId;
+  GLBuffer _vertexBufferId;
+  GLBuffer _indexBufferId;
+
+  FreeList _vertexRanges;
+  FreeList _indexRanges;
+
+  size_t _nUsedVertices;
+  size_t _nUsedIndices;
+  size_t _nRanges;
+
+  void growVertexBuffer(const size_t nVertices);
+  void growIndexBuffer(const size_t nIndices);
+
+  /// @brief Create a buffer of `nBytes` and copy the first `nCopiedBytes` of `bufferId` into it
+  static GLBuffer reallocateBuffer(const GLuint bufferId, const size_t nCopiedBytes, const size_t nBytes);
+
+ public:
+  /// @brief Create the buffers. Must be called on the GL thread.
+  GpuBufferArena(const VertexLayout& vertexLayout);
+  ~GpuBufferArena() = default;
+
+  GpuBufferArena(const GpuBufferArena&) = delete;
+  GpuBufferArena& operator=(const GpuBufferArena&) = delete;
+
+  /// @brief Copy a mesh into the buffers
+  /// @param packedVertices Vertices packed by the vertex layout of the arena
+  /// @param indices Vertex indices relative to the mesh
+  /// @return `range` (`Range`): Ranges of the mesh in the buffers
+  Range allocate(const std::vector<uint8_t>& packedVertices, const std::vector<uint32_t>& indices);
+
+  /// @brief Free the ranges of a mesh for later allocations. No GL call is made.
+  void release(const Range& range);
+
+  GLuint getVaoId() const { return _vaoId; };
+  const VertexLayout& getVertexLayout() const { return _vertexLayout; };
+
+  size_t getNumRanges() const { return _nRanges; };
+  size_t getNumUsedVertices() const { return _nUsedVertices; };
+  size_t getNumUsedIndices() const { return _nUsedIndices; };
+  size_t getVertexCapacity() const { return _vertexRanges.getCapacity(); };
+  size_t getIndexCapacity() const { return _indexRanges.getCapacity(); };
+};
+
+using GpuBufferArena_t = std::shared_ptr<GpuBufferArena>;
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Read-only memory-mapped text file which is split into fixed-size chunks for parallel parsing.
+///        The number of line breaks in each chunk is counted in parallel on open,
+///        so lines can be visited in parallel without building an index of all line heads.
+class MappedTextFile {
+ private:
+  // NOTE: Large enough to amortize the per-chunk overhead, small enough to balance the load between threads
+  inline static const size_t CHUNK_SIZE = 1024 * 1024;
+
+  const char* _data;
+  size_t _fileSize;
+
+  // NOTE: '_chunkLineOffsets[iChunk]' is the number of line breaks before the head of the chunk
+  std::vector<size_t> _chunkLineOffsets;
+
+#if defined(_WIN64)
+  void* _fileHandle;
+  void* _mappingHandle;
+#else
+  int _fileDescriptor;
+#endif
+
+  MappedTextFile();
+
+  bool map(const std::string& filePath);
+  void unmap();
+
+  size_t getNumChunks() const { return _chunkLineOffsets.size() - 1; };
+
+ public:
+  MappedTextFile(const MappedTextFile&) = delete;
+  MappedTextFile& operator=(const MappedTextFile&) = delete;
+
+  ~MappedTextFile();
+
+  /// @brief Map a text file into memory and count its lines
+  /// @param filePath Path to the text file
+  /// @param toCountLines Skip counting for files with a binary payload. The lines can be counted later by 'countLines'.
+  /// @return `File` (`std::shared_ptr<MappedTextFile>`): nullptr on failure
+  static std::shared_ptr<MappedTextFile> open(const std::string& filePath, const bool toCountLines = true);
+
+  /// @brief Count line breaks in parallel. Line access is available after this.
+  void countLines();
+
+  const char* getData() const { return _data; };
+  size_t getFileSize() const { return _fileSize; };
+
+  /// @brief Number of lines. A trailing line without a line break is also counted. Zero if the lines are not counted.
+  size_t getNumLines() const;
+
+  /// @brief Get the range of the line
+  /// @return `isFound` (`bool`): false if the line is out of range
+  bool getLine(const size_t iLine, const char*& begin, const char*& end) const;
+
+  /// @brief Visit lines in [firstLine, firstLine + nLines) in parallel.
+  ///        `func(iLocalLine, begin, end)` is called with the index relative to `firstLine` and returns false on a parse error.
+  ///        Lines are visited in an arbitrary order.
+  /// @return `isSucceeded` (`bool`): false if `func` failed on any line, or the file has fewer lines
+  template <class Func>
+  bool forEachLine(const size_t firstLine, const size_t nLines, Func&& func) const {
+    if (nLines == 0) {
+      return true;
+    }
+
+    if (firstLine + nLines > getNumLines()) {
+      LOG_ERROR("Unexpected end of file.");
+      return false;
+    }
+
+    const size_t lastLine = firstLine + nLines;
+    const char* fileEnd = _data + _fileSize;
+    const int64_t nChunks = (int64_t)getNumChunks();
+
+    const int64_t nFailures = parallelReduce<int64_t>(
+        0,
+        nChunks,
+        0,
+        [&](const int64_t iChunk) {
+          int64_t nChunkFailures = 0;
+
+          // NOTE: Lines whose preceding line break is in this chunk are visited here.
+          //       The first line has no preceding line break, so it belongs to the first chunk.
+          size_t iLine = _chunkLineOffsets[iChunk];
+          if (iLine >= lastLine || _chunkLineOffsets[iChunk + 1] < firstLine) {
+            return nChunkFailures;
+          }
+
+          const char* chunkBegin = _data + (size_t)iChunk * CHUNK_SIZE;
+          const char* chunkEnd = std::min(chunkBegin + CHUNK_SIZE, fileEnd);
+          const char* lineBegin = nullptr;
+
+          if (iChunk == 0) {
+            lineBegin = _data;
+          } else {
+            const char* lineBreak = (const char*)std::memchr(chunkBegin, '\n', chunkEnd - chunkBegin);
+            lineBegin = lineBreak == nullptr ? nullptr : lineBreak + 1;
+            ++iLine;
+          }
+
+          while (lineBegin != nullptr && iLine < lastLine) {
+            const char* lineBreak = (const char*)std::memchr(lineBegin, '\n', fileEnd - lineBegin);
+            const char* lineEnd = lineBreak == nullptr ? fileEnd : lineBreak;
+
+            if (iLine >= firstLine && !func(iLine - firstLine, lineBegin, lineEnd)) {
+              ++nChunkFailures;
+            }
+
+            // Go to the next line if its preceding line break is still in this chunk
+            if (lineBreak == nullptr || lineBreak >= chunkEnd) {
+              break;
+            }
+
+            lineBegin = lineBreak + 1;
+            ++iLine;
+          }
+
+          return nChunkFailures;
+        },
+        std::plus<int64_t>(),
+        1);
+
+    return nFailures == 0;
+  }
+
+  // ==================================================================================================
+  // Allocation-free token parsers
+  // The cursor is advanced past the parsed token. Leading spaces, tabs and '\r' are skipped.
+  // ==================================================================================================
+  static inline const char* skipSpaces(const char* cursor, const char* end) {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')) {
+      ++cursor;
+    }
+    return cursor;
+  }
+
+  /// @brief Count whitespace-separated tokens in [begin, end)
+  static size_t countTokens(const char* begin, const char* end);
+
+  template <class T>
+  static inline bool parseInteger(const char*& cursor, const char* end, T& value) {
+    cursor = skipSpaces(cursor, end);
+
+    if (cursor < end && *cursor == '+') {
+      ++cursor;
+    }
+
+    const std::from_chars_result result = std::from_chars(cursor, end, value);
+    if (result.ec != std::errc()) {
+      return false;
+    }
+
+    cursor = result.ptr;
+    return true;
+  }
+
+  /// @brief Parse a float. The result is the same as 'std::stof', which rounds to the nearest.
+  static bool parseFloat(const char*& cursor, const char* end, float& value);
+
+  /// @brief Parse a double. The result is the same as 'std::stod'.
+  static bool parseFloat(const char*& cursor, const char* end, double& value);
+};
+
+using MappedTextFile_t = std::shared_ptr<MappedTextFile>;
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/Culling.hpp>
+#include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Spatially coherent clusters of the triangles of a mesh, for culling parts of a single large mesh.
+///
+/// [Build]
+///   Triangles are sorted by the Morton codes of their centroids, and the index array is rewritten in that order.
+///   Every run of 'maxTriangles' triangles becomes a cluster with its own bounds, so each cluster is a contiguous
+///   range of the index buffer and the mesh still needs only one VBO and one IBO.
+///
+/// [Draw]
+///   'cull' collects the clusters in the frustum, merging adjacent ones into one range,
+///   and 'draw' issues them in one 'glMultiDrawElements' call on the bound VAO.
+class MeshClusters {
+ public:
+  struct Cluster {
+    glm::vec3 minCoords;
+    glm::vec3 maxCoords;
+    uint32_t firstIndex;
+    uint32_t nIndices;
+  };
+
+ private:
+  // NOTE: Bits of each axis of the Morton code
+  inline static const uint32_t MORTON_BITS = 10;
+
+  // NOTE: Ranges with fewer keys are sorted on the calling thread
+  inline static const int64_t PARALLEL_SORT_THRESHOLD = 256 * 1024;
+
+  // NOTE: Clusters per task when they are culled in parallel
+  inline static const int64_t CULLING_GRAIN_SIZE = 1024;
+
+  std::vector<Cluster> _clusters;
+  std::vector<uint8_t> _isClusterInside;
+  std::vector<GLsizei> _drawCounts;
+  std::vector<const void*> _drawOffsets;
+  size_t _nVisibleClusters;
+
+  static uint32_t expandBits(const uint32_t value);
+  static void parallelSort(uint64_t* first, uint64_t* last);
+
+ protected:
+  // nothing
+ public:
+  inline static const uint32_t DEFAULT_MAX_TRIANGLES = 4096;
+
+  MeshClusters();
+  ~MeshClusters() = default;
+
+  /// @brief Sort the triangles and split them into clusters
+  /// @param vertices Vertices of the mesh
+  /// @param indices Vertex indices of triangles. Rewritten in the order of the clusters.
+  /// @param maxTriangles Maximum number of triangles in a cluster
+  void build(const std::vector<Vertex>& vertices,
+             std::vector<uint32_t>& indices,
+             const uint32_t maxTriangles = DEFAULT_MAX_TRIANGLES);
+
+  void clear();
+
+  /// @brief Collect the clusters in the frustum of `mvpMat` for the next 'draw'
+  void cull(const glm::mat4& mvpMat);
+
+  /// @brief Draw the clusters collected by 'cull'. The VAO of the mesh must be bound.
+  void draw() const;
+
+  bool isEmpty() const { return _clusters.empty(); };
+  size_t getNumClusters() const { return _clusters.size(); };
+  size_t getNumVisibleClusters() const { return _nVisibleClusters; };
+  const std::vector<Cluster>& getClusters() const { return _clusters; };
+};
+
+}  // namespace util
+}  // namespace simview
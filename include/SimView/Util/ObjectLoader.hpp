@@ -6,14 +6,20 @@
 #include <SimView/Util/FileUtil.hpp>
 #include <SimView/Util/Geometry.hpp>
 #include <SimView/Util/Logging.hpp>
+#include <SimView/Util/MappedTextFile.hpp>
 #include <SimView/Util/Math.hpp>
+#include <SimView/Util/PlyFile.hpp>
 #include <SimView/Util/StringUtil.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <SimView/Util/VertexCache.hpp>
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Include assimp
@@ -125,49 +131,131 @@ class ObjectLoader {
       {MSH_NUM_TRIANGLES_QUAD_TETRA, MSH_TRIANGLE_IDS_QUAD_TETRA},
       {MSH_NUM_TRIANGLES_HEXA, MSH_TRIANGLE_IDS_HEXA}};
 
+  // NOTE: Relative to the longest side of the model bounds
+  inline static const float WELD_RELATIVE_THRESHOLD = 1e-6f;
+
+  // NOTE: Edges sharper than this stay sharp in the generated normals
+  inline static const float SMOOTHING_CREASE_ANGLE = glm::radians(60.0f);
+
+  // NOTE: Number of vertices per task of the transform and bounds kernels
+  inline static const int64_t TRANSFORM_CHUNK_SIZE = 64 * 1024;
+
+  /// @brief Face corner of an OBJ file. Corners with the same key become one vertex in the indexed mode.
+  struct ObjCornerKey {
+    int vertexIndex;
+    int normalIndex;
+    int texcoordIndex;
+
+    // NOTE: First corner of the crease group for generated normals, otherwise -1
+    int firstCorner;
+
+    bool operator==(const ObjCornerKey& other) const {
+      return vertexIndex == other.vertexIndex && normalIndex == other.normalIndex && texcoordIndex == other.texcoordIndex &&
+             firstCorner == other.firstCorner;
+    };
+  };
+
+  struct ObjCornerKeyHash {
+    size_t operator()(const ObjCornerKey& key) const {
+      size_t hash = std::hash<int>()(key.vertexIndex);
+      hash = hash * 31 + std::hash<int>()(key.normalIndex);
+      hash = hash * 31 + std::hash<int>()(key.texcoordIndex);
+      hash = hash * 31 + std::hash<int>()(key.firstCorner);
+      return hash;
+    };
+  };
+
+  /// @brief Create a shared-vertex mesh from node coords and triangles which refer to them.
+  ///        Only the referenced nodes are emitted. A node is split at the creases sharper than 'SMOOTHING_CREASE_ANGLE',
+  ///        with one vertex per crease group, so the normals match the non-indexed mode.
+  /// @param vertexCoords Node coords (x0, y0, z0, x1, ...)
+  /// @param triangles Node ids of triangles
+  /// @param color Vertex color
+  /// @param vertices Output vertices
+  /// @param indices Output indices
+  static void createIndexedMesh(const vecf_pt& vertexCoords,
+                                const vec_pt<uint32_t>& triangles,
+                                const glm::vec3& color,
+                                VertexArray_t vertices,
+                                IndexArray_t indices);
+
+  /// @brief Compose 'moveToOrigin', 'scaleObject' and 'translateObject' into one matrix
+  /// @param minCoords Min corner of the model bounds
+  /// @param maxCoords Max corner of the model bounds
+  /// @param scale Scale around the center of the bounds
+  /// @param offset Position of the center after the transform
+  /// @return `transform` (`glm::mat4`): Affine transform
+  static glm::mat4 createPlacementMatrix(const glm::vec3& minCoords,
+                                         const glm::vec3& maxCoords,
+                                         const glm::vec3& scale,
+                                         const glm::vec3& offset);
+
+  /// @brief Log the throughput of parsing a text file
+  /// @param nBytes Size of the parsed file
+  /// @param startTime Time when parsing started
+  static void logParsingThroughput(const size_t nBytes,
+                                   const std::chrono::system_clock::time_point& startTime);
+
  public:
   static std::vector<std::string> getReadableExtensionList();
+
+  // NOTE: 'indexed' keeps the vertices shared by the source topology instead of emitting one vertex per face corner.
+  //       'Vertex::bary' is left zero in that mode, since wire frames are drawn by 'WireFrame' as line primitives.
   static void readFromFile(const std::string& filePath,
                            VertexArray_t vertices,
                            IndexArray_t indices,
                            const float offsetX = 0.0f,
                            const float offsetY = 0.0f,
                            const float offsetZ = 0.0f,
-                           const bool autoScale = false);
+                           const bool autoScale = false,
+                           const bool weldVertices = false,
+                           const bool indexed = false);
   static void readObjFile(const std::string& filePath,
                           VertexArray_t vertices,
                           IndexArray_t indices,
                           const float offsetX = 0.0f,
                           const float offsetY = 0.0f,
-                          const float offsetZ = 0.0f);
+                          const float offsetZ = 0.0f,
+                          const bool indexed = false);
   static void readMshFile(const std::string& filePath,
                           VertexArray_t vertices,
                           IndexArray_t indices,
                           const float offsetX = 0.0f,
                           const float offsetY = 0.0f,
-                          const float offsetZ = 0.0f);
+                          const float offsetZ = 0.0f,
+                          const bool indexed = false);
   static void readPchFile(const std::string& filePath,
                           VertexArray_t vertices,
                           IndexArray_t indices,
                           const float offsetX = 0.0f,
                           const float offsetY = 0.0f,
-                          const float offsetZ = 0.0f);
+                          const float offsetZ = 0.0f,
+                          const bool indexed = false);
   static void readLasFile(const std::string& filePath,
                           VertexArray_t vertices,
                           IndexArray_t indices,
                           const float offsetX = 0.0f,
                           const float offsetY = 0.0f,
                           const float offsetZ = 0.0f);
+  static void readPlyFile(const std::string& filePath,
+                          VertexArray_t vertices,
+                          IndexArray_t indices,
+                          const float offsetX = 0.0f,
+                          const float offsetY = 0.0f,
+                          const float offsetZ = 0.0f,
+                          const bool indexed = false);
   static void readVtkFile(const std::string& filePath,
                           VertexArray_t vertices,
                           IndexArray_t indices,
                           const float offsetX = 0.0f,
                           const float offsetY = 0.0f,
-                          const float offsetZ = 0.0f);
+                          const float offsetZ = 0.0f,
+                          const bool indexed = false);
   static void readObjFileWithMaterialGroup(const std::string& filePath,
                                            MaterialGroups_t materialGroups,
                                            const glm::vec3 offset,
-                                           const glm::vec3 scale);
+                                           const glm::vec3 scale,
+                                           const bool indexed = false);
   static void scaleObject(VertexArray_t vertices,
                           const float scale);
   static void scaleObject(VertexArray_t vertices,
@@ -186,6 +274,19 @@ class ObjectLoader {
   static void rotateObject(VertexArray_t vertices,
                            const float angle,
                            const glm::vec3 axis);
+
+  /// @brief Apply an affine transform to positions, and its inverse transpose to normals, in one parallel pass.
+  ///        Normals keep their length, so unit normals stay unit even under non-uniform scales.
+  /// @param vertices Vertices to transform in place
+  /// @param transform Affine transform. The projective row is ignored.
+  static void transformObject(VertexArray_t vertices,
+                              const glm::mat4& transform);
+
+  /// @brief Move the center of the bounds to the origin, scale and translate, in one pass.
+  ///        Same as 'moveToOrigin', 'scaleObject' and 'translateObject' in a row, but the bounds are computed only once.
+  static void placeObject(VertexArray_t vertices,
+                          const glm::vec3 scale,
+                          const glm::vec3 offset);
   static void mergeVertices(const VertexArray_t& sourceVertices,
                             const IndexArray_t& sourceIndices,
                             VertexArray_t& distVertices,
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/MappedTextFile.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Reader of PLY files in ASCII, binary little-endian and binary big-endian formats.
+///        The file is memory-mapped, and the 'vertex' and 'face' elements are decoded in parallel chunks
+///        straight into the output arrays. Binary elements with list properties have variable-size records,
+///        so their chunk heads are located by one sequential scan on open.
+class PlyFile {
+ public:
+  enum class Format {
+    ASCII,
+    BINARY_LITTLE_ENDIAN,
+    BINARY_BIG_ENDIAN
+  };
+
+  enum class PropertyType {
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT32,
+    FLOAT64
+  };
+
+  struct Property {
+    std::string name;
+    PropertyType type;
+
+    // NOTE: 'countType' is the type of the item count of a list property. 'type' is the type of its items.
+    bool isList;
+    PropertyType countType;
+  };
+
+  struct Element {
+    std::string name;
+    size_t count;
+    std::vector<Property> properties;
+
+    // NOTE: Size of a binary record. Zero if the element has list properties.
+    size_t stride;
+
+    // NOTE: Byte offset of the first record in binary files, line index in ASCII files
+    size_t offset;
+
+    // NOTE: Byte offsets of every 'CHUNK_SIZE'-th record of binary elements with list properties.
+    //       The last entry is the end of the element.
+    std::vector<size_t> chunkOffsets;
+  };
+
+ private:
+  // NOTE: Number of records decoded by one task
+  inline static const size_t CHUNK_SIZE = 64 * 1024;
+
+  MappedTextFile_t _file;
+  Format _format;
+  std::vector<Element> _elements;
+
+  PlyFile();
+
+  bool parseHeader(size_t& headerSize, size_t& nHeaderLines);
+  bool locateElements(const size_t headerSize, const size_t nHeaderLines);
+
+  const Element* findElement(const std::string& name) const;
+
+  bool isByteSwapped() const;
+
+  static bool toPropertyType(const std::string& name, PropertyType& type);
+  static size_t getTypeSize(const PropertyType type);
+
+  static double decodeBinary(const char* data, const PropertyType type, const bool isByteSwapped);
+  static bool parseAscii(const char*& cursor, const char* end, const PropertyType type, double& value);
+
+ public:
+  PlyFile(const PlyFile&) = delete;
+  PlyFile& operator=(const PlyFile&) = delete;
+
+  ~PlyFile();
+
+  /// @brief Map a PLY file and parse its header
+  /// @param filePath Path to the PLY file
+  /// @return `File` (`std::shared_ptr<PlyFile>`): nullptr on failure
+  static std::shared_ptr<PlyFile> open(const std::string& filePath);
+
+  Format getFormat() const { return _format; };
+  const std::vector<Element>& getElements() const { return _elements; };
+  size_t getFileSize() const { return _file->getFileSize(); };
+
+  size_t getNumVertices() const;
+  size_t getNumFaces() const;
+
+  /// @brief Decode the 'vertex' element.
+  ///        'x', 'y' and 'z' go to the position, 'nx', 'ny' and 'nz' to the normal, 'red', 'green' and 'blue' to the color,
+  ///        'u' and 'v' (or 's' and 't') to the uv, and the first other scalar property to 'Vertex::id'.
+  /// @param vertices Output vertices. The color is white and the other attributes are zero if they are missing.
+  /// @param hasNormals Whether the element has normals
+  /// @return `isSucceeded` (`bool`)
+  bool readVertices(std::vector<Vertex>& vertices, bool& hasNormals) const;
+
+  /// @brief Decode a range of the 'vertex' element, so that large files can be streamed in parts
+  /// @param firstVertex Index of the first vertex
+  /// @param nVertices Number of vertices
+  /// @param vertices Output vertices. Its size is `nVertices`.
+  /// @param hasNormals Whether the element has normals
+  /// @return `isSucceeded` (`bool`): false on a parse error or a range out of the element
+  bool readVertices(const size_t firstVertex,
+                    const size_t nVertices,
+                    std::vector<Vertex>& vertices,
+                    bool& hasNormals) const;
+
+  /// @brief Decode the 'face' element. Polygons are split into triangle fans.
+  /// @param triangles Output vertex indices of triangles. Empty if there is no 'face' element.
+  /// @return `isSucceeded` (`bool`): false on a parse error or an out-of-range vertex index
+  bool readTriangles(std::vector<uint32_t>& triangles) const;
+};
+
+using PlyFile_t = std::shared_ptr<PlyFile>;
+
+}  // namespace util
+}  // namespace simview
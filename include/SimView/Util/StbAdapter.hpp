@@ -25,7 +25,9 @@ const int api_STBI_rgb_alpha = STBI_rgb_alpha;
 unsigned char *api_stbi_load(char const *filename, int *x, int *y, int *comp, int req_comp);
 void api_stbi_image_free(void *);
 
-void saveImage(const int width, const int height, const int channels, unsigned char *bytes, const std::string filePath);
+/// @brief Save the image as PNG or JPG by the extension. Thread safe.
+/// @return `isSaved` (`bool`)
+bool saveImage(const int width, const int height, const int channels, unsigned char *bytes, const std::string filePath);
 
 }  // namespace stb
 }  // namespace util
@@ -0,0 +1,448 @@
+#pragma once
+
+#include <SimView/Util/Logging.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Move-only type-erased callable.
+///        Callables up to INLINE_SIZE bytes are stored in place, so submitting a small task does not allocate.
+class Task {
+ private:
+  inline static const size_t INLINE_SIZE = 48;
+
+  struct Operations {
+    void (*invoke)(void* storage);
+    void (*moveTo)(void* dist, void* src);
+    void (*destroy)(void* storage);
+  };
+
+  template <class Func>
+  struct InlineOperations {
+    static void invoke(void* storage) { (*static_cast<Func*>(storage))(); }
+    static void moveTo(void* dist, void* src) {
+      new (dist) Func(std::move(*static_cast<Func*>(src)));
+      static_cast<Func*>(src)->~Func();
+    }
+    static void destroy(void* storage) { static_cast<Func*>(storage)->~Func(); }
+    inline static const Operations OPERATIONS = {invoke, moveTo, destroy};
+  };
+
+  template <class Func>
+  struct HeapOperations {
+    static void invoke(void* storage) { (**static_cast<Func**>(storage))(); }
+    static void moveTo(void* dist, void* src) {
+      *static_cast<Func**>(dist) = *static_cast<Func**>(src);
+      *static_cast<Func**>(src) = nullptr;
+    }
+    static void destroy(void* storage) { delete *static_cast<Func**>(storage); }
+    inline static const Operations OPERATIONS = {invoke, moveTo, destroy};
+  };
+
+  alignas(std::max_align_t) unsigned char _storage[INLINE_SIZE];
+  const Operations* _operations;
+
+ public:
+  Task() : _operations(nullptr) {};
+
+  template <class Func, class = std::enable_if_t<!std::is_same<std::decay_t<Func>, Task>::value>>
+  Task(Func&& func) {
+    using Func_t = std::decay_t<Func>;
+
+    if constexpr (sizeof(Func_t) <= INLINE_SIZE &&
+                  alignof(Func_t) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible<Func_t>::value) {
+      new (_storage) Func_t(std::forward<Func>(func));
+      _operations = &InlineOperations<Func_t>::OPERATIONS;
+    } else {
+      *reinterpret_cast<Func_t**>(_storage) = new Func_t(std::forward<Func>(func));
+      _operations = &HeapOperations<Func_t>::OPERATIONS;
+    }
+  };
+
+  Task(Task&& other) noexcept : _operations(other._operations) {
+    if (_operations != nullptr) {
+      _operations->moveTo(_storage, other._storage);
+      other._operations = nullptr;
+    }
+  };
+
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      reset();
+      _operations = other._operations;
+      if (_operations != nullptr) {
+        _operations->moveTo(_storage, other._storage);
+        other._operations = nullptr;
+      }
+    }
+    return *this;
+  };
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() { reset(); };
+
+  void reset() {
+    if (_operations != nullptr) {
+      _operations->destroy(_storage);
+      _operations = nullptr;
+    }
+  };
+
+  explicit operator bool() const { return _operations != nullptr; };
+
+  void operator()() { _operations->invoke(_storage); };
+};
+
+/// @brief Thread pool with one task deque per worker.
+///        A worker pops its own tasks from the back (LIFO, cache friendly) and steals from the front of
+///        the other deques when its own one is empty. Workers waiting on a 'TaskGroup' run tasks meanwhile,
+///        so nested parallelism does not deadlock.
+class TaskScheduler {
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> _queues;
+  std::vector<std::thread> _threads;
+
+  // NOTE: Incremented before a task is pushed and decremented after it is popped, so it is never negative
+  std::atomic<int64_t> _nPendingTasks;
+  std::atomic<size_t> _nextQueue;
+
+  std::mutex _sleepMutex;
+  std::condition_variable _sleepCondition;
+  bool _isStopped;
+
+  inline static thread_local TaskScheduler* _currentScheduler = nullptr;
+  inline static thread_local size_t _currentWorker = 0;
+
+  void workerLoop(const size_t iWorker);
+  bool popTask(Task& task);
+
+ public:
+  /// @brief Create a pool
+  /// @param nThreads Number of worker threads. Uses the number of hardware threads if zero.
+  TaskScheduler(size_t nThreads = 0);
+  ~TaskScheduler();
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  /// @brief Pool shared by loaders and geometry kernels
+  static TaskScheduler& getInstance();
+
+  size_t getNumThreads() const { return _threads.size(); };
+
+  /// @brief Whether the calling thread is a worker of this pool
+  bool isWorkerThread() const { return _currentScheduler == this; };
+
+  /// @brief Enqueue a task without a result. Exceptions thrown by the task are logged.
+  void enqueue(Task task);
+
+  /// @brief Enqueue a task
+  /// @return `future` (`std::future`): Result of the task. Exceptions are rethrown by 'get'.
+  template <class Func>
+  auto submit(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>>> {
+    using Result_t = std::invoke_result_t<std::decay_t<Func>>;
+
+    std::packaged_task<Result_t()> task(std::forward<Func>(func));
+    std::future<Result_t> future = task.get_future();
+    enqueue(Task(std::move(task)));
+
+    return future;
+  };
+
+  /// @brief Run one pending task on the calling thread
+  /// @return `isExecuted` (`bool`): false if there was no pending task
+  bool runPendingTask();
+};
+
+/// @brief Set of tasks which can be waited for together.
+///
+/// [Waiting]
+///   'wait' first runs the tasks of the group which no worker has started yet on the calling thread.
+///   Workers then keep running pending tasks of the pool, so nested parallelism does not deadlock.
+///   Other threads such as the GL thread block instead, so they never pick up a long task of someone else
+///   (e.g. a mesh parse or an image encode) in the middle of a frame.
+class TaskGroup {
+ private:
+  // NOTE: Run either by a worker through the pool or by the waiting thread, whichever claims it first
+  struct Slot {
+    std::atomic<bool> isClaimed{false};
+    Task task;
+  };
+
+  using Slot_t = std::shared_ptr<Slot>;
+
+  TaskScheduler& _scheduler;
+  std::atomic<int64_t> _nRunningTasks;
+
+  std::mutex _slotMutex;
+  std::vector<Slot_t> _slots;
+  size_t _iNextSlot;
+
+  std::mutex _waitMutex;
+  std::condition_variable _waitCondition;
+
+  std::mutex _exceptionMutex;
+  std::exception_ptr _exception;
+
+  static void runSlot(Slot& slot) {
+    if (!slot.isClaimed.exchange(true)) {
+      slot.task();
+    }
+  };
+
+  /// @brief Run a task of the group which is not started yet
+  /// @return `isExecuted` (`bool`): false if all tasks are started
+  bool runOwnTask() {
+    while (true) {
+      Slot_t slot = nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(_slotMutex);
+        if (_iNextSlot >= _slots.size()) {
+          return false;
+        }
+        slot = _slots[_iNextSlot++];
+      }
+
+      if (!slot->isClaimed.exchange(true)) {
+        slot->task();
+        return true;
+      }
+    }
+  };
+
+ public:
+  TaskGroup(TaskScheduler& scheduler = TaskScheduler::getInstance())
+      : _scheduler(scheduler),
+        _nRunningTasks(0),
+        _slotMutex(),
+        _slots(),
+        _iNextSlot(0),
+        _waitMutex(),
+        _waitCondition(),
+        _exceptionMutex(),
+        _exception(nullptr) {};
+
+  ~TaskGroup() { wait(false); };
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  template <class Func>
+  void run(Func&& func) {
+    ++_nRunningTasks;
+
+    auto slot = std::make_shared<Slot>();
+    slot->task = Task([this, func = std::forward<Func>(func)]() mutable {
+      try {
+        func();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(_exceptionMutex);
+        if (_exception == nullptr) {
+          _exception = std::current_exception();
+        }
+      }
+
+      // NOTE: Notified under the lock, so that the group is not destroyed by the waiter before the notification
+      std::lock_guard<std::mutex> lock(_waitMutex);
+      if (--_nRunningTasks == 0) {
+        _waitCondition.notify_all();
+      }
+    });
+
+    {
+      std::lock_guard<std::mutex> lock(_slotMutex);
+      _slots.push_back(slot);
+    }
+
+    // NOTE: The pool holds only the slot, which outlives the group if the waiting thread has run the task
+    _scheduler.enqueue([slot]() { runSlot(*slot); });
+  };
+
+  /// @brief Wait for all tasks of the group
+  /// @param toRethrow Rethrow the first exception thrown by the tasks
+  void wait(const bool toRethrow = true) {
+    while (runOwnTask()) {
+    }
+
+    if (_scheduler.isWorkerThread()) {
+      while (_nRunningTasks > 0) {
+        if (!_scheduler.runPendingTask()) {
+          std::this_thread::yield();
+        }
+      }
+
+      // NOTE: Until the last task has released the lock
+      std::lock_guard<std::mutex> lock(_waitMutex);
+    } else {
+      std::unique_lock<std::mutex> lock(_waitMutex);
+      _waitCondition.wait(lock, [this]() { return _nRunningTasks == 0; });
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_slotMutex);
+      _slots.clear();
+      _iNextSlot = 0;
+    }
+
+    if (toRethrow && _exception != nullptr) {
+      std::exception_ptr exception = nullptr;
+      std::swap(exception, _exception);
+      std::rethrow_exception(exception);
+    }
+  };
+};
+
+// ==================================================================================================
+// Parallel loops
+// ==================================================================================================
+/// @brief Number of iterations per task. Each thread gets a few chunks so that uneven chunks are balanced by stealing.
+inline int64_t calcGrainSize(const TaskScheduler& scheduler, const int64_t nIterations) {
+  const int64_t nChunks = 4 * (int64_t)(scheduler.getNumThreads() + 1);
+  return std::max<int64_t>(1, (nIterations + nChunks - 1) / nChunks);
+}
+
+/// @brief Call `func(i)` for i in [first, last) in parallel
+/// @param grainSize Number of iterations per task. Calculated from the number of threads if zero.
+template <class Func>
+void parallelFor(const int64_t first,
+                 const int64_t last,
+                 Func&& func,
+                 int64_t grainSize = 0,
+                 TaskScheduler& scheduler = TaskScheduler::getInstance()) {
+  const int64_t nIterations = last - first;
+  if (nIterations <= 0) {
+    return;
+  }
+
+  if (grainSize <= 0) {
+    grainSize = calcGrainSize(scheduler, nIterations);
+  }
+
+  if (nIterations <= grainSize || scheduler.getNumThreads() == 0) {
+    for (int64_t i = first; i < last; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  TaskGroup group(scheduler);
+
+  for (int64_t chunkFirst = first; chunkFirst < last; chunkFirst += grainSize) {
+    const int64_t chunkLast = std::min(chunkFirst + grainSize, last);
+
+    group.run([&func, chunkFirst, chunkLast]() {
+      for (int64_t i = chunkFirst; i < chunkLast; ++i) {
+        func(i);
+      }
+    });
+  }
+
+  group.wait();
+}
+
+/// @brief Call `func(chunkFirst, chunkLast)` for the chunks of [first, last) in parallel,
+///        so that a work space can be set up once per chunk instead of once per iteration
+/// @param grainSize Number of iterations per chunk. Calculated from the number of threads if zero.
+template <class Func>
+void parallelForRange(const int64_t first,
+                      const int64_t last,
+                      Func&& func,
+                      int64_t grainSize = 0,
+                      TaskScheduler& scheduler = TaskScheduler::getInstance()) {
+  const int64_t nIterations = last - first;
+  if (nIterations <= 0) {
+    return;
+  }
+
+  if (grainSize <= 0) {
+    grainSize = calcGrainSize(scheduler, nIterations);
+  }
+
+  const int64_t nChunks = (nIterations + grainSize - 1) / grainSize;
+
+  parallelFor(
+      0,
+      nChunks,
+      [&](const int64_t iChunk) {
+        const int64_t chunkFirst = first + iChunk * grainSize;
+        func(chunkFirst, std::min(chunkFirst + grainSize, last));
+      },
+      1,
+      scheduler);
+}
+
+/// @brief Reduce `func(i)` for i in [first, last) in parallel.
+///        Partial results are combined in the order of chunks, so the result does not depend on scheduling.
+/// @param identity Identity of `reduce`
+/// @param func Mapping of an iteration `T func(int64_t)`
+/// @param reduce Associative reduction `T reduce(const T&, const T&)`
+template <class T, class Func, class Reduce>
+T parallelReduce(const int64_t first,
+                 const int64_t last,
+                 const T& identity,
+                 Func&& func,
+                 Reduce&& reduce,
+                 int64_t grainSize = 0,
+                 TaskScheduler& scheduler = TaskScheduler::getInstance()) {
+  const int64_t nIterations = last - first;
+  if (nIterations <= 0) {
+    return identity;
+  }
+
+  if (grainSize <= 0) {
+    grainSize = calcGrainSize(scheduler, nIterations);
+  }
+
+  const int64_t nChunks = (nIterations + grainSize - 1) / grainSize;
+  std::vector<T> partials(nChunks, identity);
+
+  parallelFor(
+      0,
+      nChunks,
+      [&](const int64_t iChunk) {
+        const int64_t chunkFirst = first + iChunk * grainSize;
+        const int64_t chunkLast = std::min(chunkFirst + grainSize, last);
+
+        T partial = identity;
+        for (int64_t i = chunkFirst; i < chunkLast; ++i) {
+          partial = reduce(partial, func(i));
+        }
+        partials[iChunk] = std::move(partial);
+      },
+      1,
+      scheduler);
+
+  T result = identity;
+  for (const T& partial : partials) {
+    result = reduce(result, partial);
+  }
+
+  return result;
+}
+
+}  // namespace util
+}  // namespace simview
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <SimView/OpenGL.hpp>
+#include <SimView/Util/GLResource.hpp>
+#include <SimView/Util/GLStateCache.hpp>
 #include <SimView/Util/Logging.hpp>
 #include <SimView/Util/StbAdapter.hpp>
 #include <memory>
@@ -18,12 +20,13 @@ class Texture {
   using InnerTextureArray = std::vector<std::shared_ptr<std::vector<std::shared_ptr<std::vector<int>>>>>;
   using TextureArray = std::shared_ptr<InnerTextureArray>;
 
-  static void loadTexture(const std::string& filePath, GLuint& texID);
+  /// @brief Load an image file into a new texture. The previous texture of `texID` is released.
+  static void loadTexture(const std::string& filePath, GLTexture& texID);
   static void loadTexture(const unsigned char* bytes,
                           const int& width,
                           const int& height,
                           const int& channels,
-                          GLuint& texID);
+                          GLTexture& texID);
   static void readTexture(const std::string& filePath, Texture::TextureArray texture);
 };
 
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/FileUtil.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Options of 'ObjectLoader::readFromFile' which change the loaded vertices.
+///        A cache entry is only valid for the same options.
+struct VertexCacheKey {
+  std::string filePath;
+  uintmax_t fileSize;
+  int64_t lastWriteTime;
+  float offsetX;
+  float offsetY;
+  float offsetZ;
+  bool autoScale;
+  bool weldVertices;
+  bool indexed;
+};
+
+/// @brief On-disk cache of the final vertex and index arrays produced by 'ObjectLoader::readFromFile'.
+///
+/// [Layout] (version 5, native byte order)
+///   Header       : 'VertexCache::Header' (fixed size)
+///   Source path  : 'Header::pathLength' bytes
+///   Vertices     : 'Header::nVertices' x 'Vertex', starts at 'Header::vertexOffset'
+///   Indices      : 'Header::nIndices' x 'uint32_t', starts at 'Header::indexOffset'
+///
+/// Both arrays start at DATA_ALIGNMENT-byte aligned offsets, so the file can be memory-mapped and used in place.
+class VertexCache {
+ private:
+  inline static const char MAGIC[8] = {'S', 'V', 'C', 'A', 'C', 'H', 'E', '\0'};
+  // NOTE: Bumped also when the loaders produce different vertices, e.g. normals, so that stale caches are rebuilt
+  inline static const uint32_t VERSION = 5;
+  inline static const uint64_t DATA_ALIGNMENT = 64;
+  inline static const std::string EXTENSION = ".svcache";
+
+  // NOTE: Parsing small files is cheaper than looking up the cache
+  inline static const uintmax_t MIN_SOURCE_FILE_SIZE = 1024 * 1024;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t vertexStride;
+    uint64_t sourceFileSize;
+    int64_t sourceLastWriteTime;
+    float offsetX;
+    float offsetY;
+    float offsetZ;
+    uint32_t autoScale;
+    uint32_t weldVertices;
+    uint32_t indexed;
+    uint64_t nVertices;
+    uint64_t nIndices;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+    uint64_t pathLength;
+  };
+
+  inline static bool _isEnabled = true;
+  inline static std::string _cacheDirPath = "";
+
+  static uint64_t alignOffset(const uint64_t offset);
+  static std::string getCacheFilePath(const std::string& absFilePath);
+  static bool isValidHeader(const Header& header, const VertexCacheKey& key);
+
+ public:
+  static void setEnabled(const bool isEnabled) { _isEnabled = isEnabled; };
+  static bool isEnabled() { return _isEnabled; };
+
+  /// @brief Set the directory where cache files are stored. The system temporary directory is used by default.
+  static void setCacheDirPath(const std::string& dirPath) { _cacheDirPath = dirPath; };
+  static std::string getCacheDirPath();
+
+  /// @brief Create a cache key for the given source file and loader options
+  /// @return `Key` (`VertexCacheKey`): 'fileSize' is zero if the source file does not exist
+  static VertexCacheKey createKey(const std::string& filePath,
+                                  const float offsetX,
+                                  const float offsetY,
+                                  const float offsetZ,
+                                  const bool autoScale,
+                                  const bool weldVertices,
+                                  const bool indexed);
+
+  /// @brief Whether the source file is worth caching
+  static bool isCacheable(const VertexCacheKey& key);
+
+  /// @brief Load vertices and indices from the cache
+  /// @return `isHit` (`bool`): false if there is no valid cache entry for the key
+  static bool load(const VertexCacheKey& key,
+                   VertexArray_t vertices,
+                   IndexArray_t indices);
+
+  /// @brief Store vertices and indices to the cache
+  /// @return `isStored` (`bool`)
+  static bool store(const VertexCacheKey& key,
+                    const VertexArray_t& vertices,
+                    const IndexArray_t& indices);
+};
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <SimView/OpenGL.hpp>
+#include <SimView/Util/DataStructure.hpp>
+#include <SimView/Util/Logging.hpp>
+#include <SimView/Util/TaskScheduler.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simview {
+namespace util {
+
+/// @brief Vertex attributes. The values are the attribute locations in the default shaders.
+enum class VertexAttribute : GLuint {
+  POSITION = 0,
+  COLOR = 1,
+  NORMAL = 2,
+  BARY = 3,
+  UV = 4,
+  ID = 5
+};
+
+/// @brief Encoding of a vertex attribute in the vertex buffer
+enum class VertexEncoding {
+  FLOAT32,       // 32-bit float per component
+  HALF_FLOAT,    // 16-bit float per component, padded to an even number of components
+  UNORM16_BBOX,  // 16-bit unsigned normalized, relative to the bounding box of the vertices (position only)
+  UNORM8,        // RGBA8 unsigned normalized, clamped to [0, 1] (color only)
+  OCT_SNORM16    // Octahedral 2 x 16-bit signed normalized (normal only)
+};
+
+/// @brief Declaration of the attributes which a primitive uploads, and how each of them is encoded.
+///        The vertex buffer is packed and the VAO attribute pointers are set up from this declaration.
+///        Attributes which are not declared are disabled, so that shaders read (0, 0, 0, 1) for them.
+///
+/// [Decoding]
+///   'UNORM16_BBOX' positions and 'OCT_SNORM16' normals need the uniform variables of
+///   'getPositionScale', 'getPositionOffset' and 'isOctNormal' in the vertex shader.
+///   The other encodings are decoded by the vertex fetch.
+class VertexLayout {
+ public:
+  struct Element {
+    VertexAttribute attribute;
+    VertexEncoding encoding;
+    GLint size;  // Number of components passed to 'glVertexAttribPointer'
+    GLenum type;
+    GLboolean normalized;
+    GLuint offset;
+  };
+
+ private:
+  inline static const int NUM_ATTRIBUTES = 6;
+
+  // NOTE: Number of components and byte offset of each attribute in 'Vertex'
+  inline static const int NUM_COMPONENTS[NUM_ATTRIBUTES] = {3, 3, 3, 3, 2, 1};
+  inline static const size_t VERTEX_OFFSETS[NUM_ATTRIBUTES] = {
+      offsetof(Vertex, position),
+      offsetof(Vertex, color),
+      offsetof(Vertex, normal),
+      offsetof(Vertex, bary),
+      offsetof(Vertex, uv),
+      offsetof(Vertex, id)};
+
+  std::vector<Element> _elements;
+  GLuint _stride;
+  glm::vec3 _positionScale;
+  glm::vec3 _positionOffset;
+
+  bool isSameAsVertex() const;
+  void encodeElement(const Element& element, const Vertex& vertex, uint8_t* dist) const;
+
+  static glm::vec2 encodeOctNormal(const glm::vec3& normal);
+
+ public:
+  VertexLayout();
+
+  /// @brief Append an attribute
+  /// @return `self` (`VertexLayout&`): For chaining
+  VertexLayout& add(const VertexAttribute attribute, const VertexEncoding encoding);
+
+  /// @brief All attributes in 32-bit floats. The same memory layout as 'Vertex'.
+  static VertexLayout createDefault();
+
+  /// @brief Position in 16-bit normalized coords and RGBA8 color (12 bytes per vertex)
+  static VertexLayout createPointCloud();
+
+  /// @brief Position, RGBA8 color, oct-encoded normal and uv (28 bytes per vertex)
+  static VertexLayout createCompactMesh();
+
+  /// @brief Sphere center, RGBA8 color and radius in 'Vertex::id' (20 bytes per sphere)
+  static VertexLayout createSphereImpostor();
+
+  GLuint getStride() const { return _stride; };
+  const std::vector<Element>& getElements() const { return _elements; };
+  bool hasAttribute(const VertexAttribute attribute) const;
+  bool isOctNormal() const;
+
+  /// @brief Whether the vertices of both layouts are packed in the same way, so that they can share a vertex buffer.
+  ///        The decoding scale and offset of positions are not compared.
+  bool hasSameFormat(const VertexLayout& other) const;
+
+  /// @brief Decoded position = position in the buffer * scale + offset
+  const glm::vec3& getPositionScale() const { return _positionScale; };
+  const glm::vec3& getPositionOffset() const { return _positionOffset; };
+
+  /// @brief Pack vertices into the layout.
+  ///        For 'UNORM16_BBOX' positions, the decoding scale and offset are updated to the bounds of the vertices.
+  /// @return `bytes` (`std::vector<uint8_t>`): 'getStride()' bytes per vertex
+  std::vector<uint8_t> encode(const std::vector<Vertex>& vertices);
+
+  /// @brief Pack vertices and upload them to the buffer bound to GL_ARRAY_BUFFER
+  void upload(const VertexArray_t& vertices, const GLenum usage = GL_STATIC_DRAW);
+
+  /// @brief Set up the attribute pointers of the bound VAO for the buffer bound to GL_ARRAY_BUFFER
+  /// @param divisor Attribute divisor. 1 for attributes advanced per instance.
+  void setupAttributes(const GLuint divisor = 0) const;
+};
+
+using VertexLayout_t = std::shared_ptr<VertexLayout>;
+
+}  // namespace util
+}  // namespace simview
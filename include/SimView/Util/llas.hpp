@@ -35,6 +35,8 @@
  * [Readme]
  *   This implementation is based on 'ASPRS LAS 1.4 Format Specification R15 July 9 2019'
  *   Link is "https://www.asprs.org/wp-content/uploads/2019/07/LAS_1_4_r15.pdf"
+ *
+ *   The file mapping of 'LasView' is implemented in 'llas.cpp', which is the only part that is not header-only.
  */
 
 #ifndef __LLAS_HPP__
@@ -51,6 +53,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #if defined(LLAS_STATIC)
@@ -79,6 +83,9 @@
 
 #define LLAS_BUFFER_SIZE 1024
 
+// Number of point data records decoded at once by 'LasView::forEachPointChunk'
+#define LLAS_DEFAULT_CHUNK_SIZE 65536
+
 // ==========================================================================
 // Simple logging macro
 // ==========================================================================
@@ -102,7 +109,42 @@ namespace llas {
 // Utility Functions
 // ==========================================================================
 
-// Nothing
+/// @brief Resolve the number of worker threads. `0` means all hardware threads.
+LLAS_FUNC_DECL_PREFIX size_t getNumThreads(const size_t nThreads) {
+  if (nThreads > 0) {
+    return nThreads;
+  }
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/// @brief Split `[0, nItems)` into contiguous ranges and call `func(iBegin, iEnd)` for each of them on its own thread
+/// @param nItems Number of items
+/// @param nThreads Number of threads. `0` means all hardware threads.
+/// @param func Function called like `func(size_t iBegin, size_t iEnd)`
+template <class Func>
+void parallelFor(const size_t nItems, const size_t nThreads, Func&& func) {
+  const size_t nWorkers = std::min(getNumThreads(nThreads), std::max<size_t>(nItems, 1));
+
+  if (nWorkers <= 1) {
+    func((size_t)0, nItems);
+    return;
+  }
+
+  const size_t nItemsPerWorker = (nItems + nWorkers - 1) / nWorkers;
+
+  std::vector<std::thread> workers;
+  workers.reserve(nWorkers);
+
+  for (size_t iWorker = 0; iWorker < nWorkers; ++iWorker) {
+    const size_t iBegin = std::min(iWorker * nItemsPerWorker, nItems);
+    const size_t iEnd = std::min(iBegin + nItemsPerWorker, nItems);
+    workers.emplace_back([&func, iBegin, iEnd]() { func(iBegin, iEnd); });
+  }
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
 
 // ==========================================================================
 // Math utility
@@ -700,8 +742,11 @@ struct PublicHeader {
   // clang-format on
 
   static PublicHeader readPublicHeader(const std::vector<char>& fileBytes) {
+    return readPublicHeader(fileBytes.data());
+  };
+
+  static PublicHeader readPublicHeader(const char* data) {
     PublicHeader publicHeader;
-    const char* data = fileBytes.data();
     size_t offset = 0;
 
     {
@@ -1072,6 +1117,9 @@ struct PointDataRecord {
   inline static const std::streamsize NUM_BYTES_RED                                                 = 2;
   inline static const std::streamsize NUM_BYTES_GREEN                                               = 2;
   inline static const std::streamsize NUM_BYTES_BLUE                                                = 2;
+  inline static const std::streamsize NUM_BYTES_EXTENDED_SENSOR_DATA                                = 2;
+  inline static const std::streamsize NUM_BYTES_SCAN_ANGLE                                          = 2;
+  inline static const std::streamsize NUM_BYTES_NIR                                                 = 2;
   // clang-format on
 
   PointDataRecord()
@@ -1086,7 +1134,9 @@ struct PointDataRecord {
         GPSTime(),
         red(std::numeric_limits<LLAS_USHORT>::max()),
         green(std::numeric_limits<LLAS_USHORT>::max()),
-        blue(std::numeric_limits<LLAS_USHORT>::max()) {
+        blue(std::numeric_limits<LLAS_USHORT>::max()),
+        scanAngle(),
+        NIR() {
   }
 
   // clang-format off
@@ -1102,115 +1152,140 @@ struct PointDataRecord {
   LLAS_USHORT    red;
   LLAS_USHORT    green;
   LLAS_USHORT    blue;
+  LLAS_SHORT     scanAngle;  // format 6-10 only
+  LLAS_USHORT    NIR;        // format 8 and 10 only
   // clang-format on
 
-  static PointDataRecord _readPointDataRecordFotmat0to4(const char* byteData,
-                                                        std::streamsize& offset,
-                                                        const LLAS_UCHAR& format) {
-    PointDataRecord pointDataRecord;
+  /// @brief Decode one point data record of the given format.
+  ///        Each format is instantiated separately, so that there is no branching on the format per point.
+  /// @param byteData Pointer to the head of the record
+  /// @param pointDataRecord Output record
+  /// @return `nBytes` (`std::streamsize`): the number of bytes consumed (wave packets are not read)
+  template <int Format>
+  static std::streamsize decodePointDataRecord(const char* byteData,
+                                               PointDataRecord& pointDataRecord) {
+    static_assert(0 <= Format && Format <= 10, "Point data record format is defined from 0 to 10");
 
-    {
-      // X
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_X;
-      std::memcpy(&pointDataRecord.x, byteData + offset, nBytes);
-      offset += nBytes;
-    }
+    constexpr bool isLegacyFormat = Format <= 5;
+    constexpr bool hasGPSTime = Format == 1 || Format >= 3;
+    constexpr bool hasRGB = Format == 2 || Format == 3 || Format == 5 || Format == 7 || Format == 8 || Format == 10;
+    constexpr bool hasNIR = Format == 8 || Format == 10;
 
-    {
-      // Y
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_Y;
-      std::memcpy(&pointDataRecord.y, byteData + offset, nBytes);
-      offset += nBytes;
-    }
+    std::streamsize offset = 0;
 
     {
-      // Z
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_Z;
-      std::memcpy(&pointDataRecord.z, byteData + offset, nBytes);
-      offset += nBytes;
+      // X, Y, Z
+      std::memcpy(&pointDataRecord.x, byteData + offset, NUM_BYTES_X);
+      offset += NUM_BYTES_X;
+      std::memcpy(&pointDataRecord.y, byteData + offset, NUM_BYTES_Y);
+      offset += NUM_BYTES_Y;
+      std::memcpy(&pointDataRecord.z, byteData + offset, NUM_BYTES_Z);
+      offset += NUM_BYTES_Z;
     }
 
     {
       // Intensity
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_INTENSITY;
-      std::memcpy(&pointDataRecord.intensity, byteData + offset, nBytes);
-      offset += nBytes;
+      std::memcpy(&pointDataRecord.intensity, byteData + offset, NUM_BYTES_INTENSITY);
+      offset += NUM_BYTES_INTENSITY;
     }
 
-    {
+    if constexpr (isLegacyFormat) {
       // Sensor Data
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_SENSOR_DATA;
       // TODO: set variables
-      offset += nBytes;
-    }
+      offset += NUM_BYTES_SENSOR_DATA;
 
-    {
       // Classification
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_CLASSIFICATION;
-      std::memcpy(&pointDataRecord.classification, byteData + offset, nBytes);
-      offset += nBytes;
-    }
+      std::memcpy(&pointDataRecord.classification, byteData + offset, NUM_BYTES_CLASSIFICATION);
+      offset += NUM_BYTES_CLASSIFICATION;
 
-    {
       // Scan Angle Rank
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_SCAN_ANGLE_RANK;
-      std::memcpy(&pointDataRecord.scanAngleRank, byteData + offset, nBytes);
-      offset += nBytes;
-    }
+      std::memcpy(&pointDataRecord.scanAngleRank, byteData + offset, NUM_BYTES_SCAN_ANGLE_RANK);
+      offset += NUM_BYTES_SCAN_ANGLE_RANK;
 
-    {
       // User Data
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_USER_DATA;
-      std::memcpy(&pointDataRecord.userData, byteData + offset, nBytes);
-      offset += nBytes;
+      std::memcpy(&pointDataRecord.userData, byteData + offset, NUM_BYTES_USER_DATA);
+      offset += NUM_BYTES_USER_DATA;
+    } else {
+      // Extended Sensor Data
+      // TODO: set variables
+      offset += NUM_BYTES_EXTENDED_SENSOR_DATA;
+
+      // Classification
+      std::memcpy(&pointDataRecord.classification, byteData + offset, NUM_BYTES_CLASSIFICATION);
+      offset += NUM_BYTES_CLASSIFICATION;
+
+      // User Data
+      std::memcpy(&pointDataRecord.userData, byteData + offset, NUM_BYTES_USER_DATA);
+      offset += NUM_BYTES_USER_DATA;
+
+      // Scan Angle
+      std::memcpy(&pointDataRecord.scanAngle, byteData + offset, NUM_BYTES_SCAN_ANGLE);
+      offset += NUM_BYTES_SCAN_ANGLE;
     }
 
     {
       // Point Soruce ID
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_POINT_SOURCE_ID;
-      std::memcpy(&pointDataRecord.pointSourceID, byteData + offset, nBytes);
-      offset += nBytes;
+      std::memcpy(&pointDataRecord.pointSourceID, byteData + offset, NUM_BYTES_POINT_SOURCE_ID);
+      offset += NUM_BYTES_POINT_SOURCE_ID;
     }
 
-    if (format == 1 || format == 3 || format == 4) {
+    if constexpr (hasGPSTime) {
       // GPS Time
-      const std::streamsize nBytes = PointDataRecord::NUM_BYTES_GPS_TIME;
-      std::memcpy(&pointDataRecord.GPSTime, byteData + offset, nBytes);
-      offset += nBytes;
+      std::memcpy(&pointDataRecord.GPSTime, byteData + offset, NUM_BYTES_GPS_TIME);
+      offset += NUM_BYTES_GPS_TIME;
     }
 
-    if (format == 2 || format == 3) {
-      {
-        // Red
-        const std::streamsize nBytes = PointDataRecord::NUM_BYTES_RED;
-        std::memcpy(&pointDataRecord.red, byteData + offset, nBytes);
-        offset += nBytes;
-      }
-
-      {
-        // Green
-        const std::streamsize nBytes = PointDataRecord::NUM_BYTES_GREEN;
-        std::memcpy(&pointDataRecord.green, byteData + offset, nBytes);
-        offset += nBytes;
-      }
+    if constexpr (hasRGB) {
+      // Red, Green, Blue
+      std::memcpy(&pointDataRecord.red, byteData + offset, NUM_BYTES_RED);
+      offset += NUM_BYTES_RED;
+      std::memcpy(&pointDataRecord.green, byteData + offset, NUM_BYTES_GREEN);
+      offset += NUM_BYTES_GREEN;
+      std::memcpy(&pointDataRecord.blue, byteData + offset, NUM_BYTES_BLUE);
+      offset += NUM_BYTES_BLUE;
+    }
 
-      {
-        // Blue
-        const std::streamsize nBytes = PointDataRecord::NUM_BYTES_BLUE;
-        std::memcpy(&pointDataRecord.blue, byteData + offset, nBytes);
-        offset += nBytes;
-      }
+    if constexpr (hasNIR) {
+      // NIR
+      std::memcpy(&pointDataRecord.NIR, byteData + offset, NUM_BYTES_NIR);
+      offset += NUM_BYTES_NIR;
     }
 
-    return pointDataRecord;
+    return offset;
   }
 
-  static PointDataRecord _readPointDataRecordFotmat5to15(const char* byteData,
-                                                         std::streamsize& offset,
-                                                         const LLAS_UCHAR& format) {
-    _LLAS_logError("Unsupported point data record format: " + std::to_string((int)format));
-    PointDataRecord pointDataRecord;
-    return pointDataRecord;
+  using Decoder_t = std::streamsize (*)(const char*, PointDataRecord&);
+
+  /// @brief Select the decoder for the given format. Call this once per file, not once per point.
+  /// @param format Point data record format
+  /// @return `Decoder` (`Decoder_t`): nullptr if the format is not defined
+  static Decoder_t getDecoder(const LLAS_UCHAR& format) {
+    switch (format) {
+      case 0:
+        return &decodePointDataRecord<0>;
+      case 1:
+        return &decodePointDataRecord<1>;
+      case 2:
+        return &decodePointDataRecord<2>;
+      case 3:
+        return &decodePointDataRecord<3>;
+      case 4:
+        return &decodePointDataRecord<4>;
+      case 5:
+        return &decodePointDataRecord<5>;
+      case 6:
+        return &decodePointDataRecord<6>;
+      case 7:
+        return &decodePointDataRecord<7>;
+      case 8:
+        return &decodePointDataRecord<8>;
+      case 9:
+        return &decodePointDataRecord<9>;
+      case 10:
+        return &decodePointDataRecord<10>;
+      default:
+        return nullptr;
+    }
   }
 
   static PointDataRecord readPointDataRecord(const char* byteData,
@@ -1218,10 +1293,10 @@ struct PointDataRecord {
                                              const LLAS_UCHAR& format) {
     PointDataRecord pointDataRecord;
 
-    if (0 <= (int)format && (int)format < 5) {
-      pointDataRecord = _readPointDataRecordFotmat0to4(byteData, offset, format);
-    } else if (5 <= (int)format && (int)format < 16) {
-      pointDataRecord = _readPointDataRecordFotmat5to15(byteData, offset, format);
+    const Decoder_t decoder = getDecoder(format);
+
+    if (decoder != nullptr) {
+      offset += decoder(byteData + offset, pointDataRecord);
     } else {
       _LLAS_logError("Unsupported point data record format: " + std::to_string((int)format));
     }
@@ -1458,6 +1533,204 @@ struct LasData {
 
 using LasData_ptr = std::shared_ptr<LasData>;
 
+// ==========================================================================
+// Memory-mapped view
+// ==========================================================================
+
+/// @brief Read-only memory-mapped view of a '.las' file.
+///        Point data records are decoded straight from the mapped pages, so the file is never copied as a whole.
+class LasView {
+ private:
+  const char* _data;
+  size_t _fileSize;
+  PublicHeader _header;
+  PointDataRecord::Decoder_t _decoder;
+
+  // NOTE: The platform headers are only included by 'llas.cpp', so that they do not leak into the clients
+#if defined(_WIN64)
+  void* _fileHandle;
+  void* _mappingHandle;
+#else
+  int _fileDescriptor;
+#endif
+
+  LasView();
+
+  bool map(const std::string& filePath);
+  void unmap();
+
+  /// @brief Tell the OS that the mapped pages of already decoded records are no longer needed
+  void releasePages(const size_t beginByte, const size_t endByte) const;
+
+ public:
+  LasView(const LasView&) = delete;
+  LasView& operator=(const LasView&) = delete;
+
+  ~LasView();
+
+  /// @brief Map '.las' file into memory and parse its public header
+  /// @param filePath Path to the las file
+  /// @return `Las view` (`std::shared_ptr<LasView>`): nullptr on failure
+  static std::shared_ptr<LasView> open(const std::string& filePath) {
+    std::shared_ptr<LasView> view(new LasView());
+
+    if (!view->map(filePath)) {
+      _LLAS_logError("Failed to map file: " + filePath);
+      return nullptr;
+    }
+
+    // NOTE: The public header is 227 bytes (version 1.0-1.2), 235 bytes (1.3) or 375 bytes (1.4).
+    //       'Version Minor' is located at byte 25.
+    const LLAS_UCHAR versionMinor = view->_fileSize > 25 ? (LLAS_UCHAR)view->_data[25] : 0;
+    const size_t minHeaderSize = versionMinor >= 4 ? 375 : (versionMinor == 3 ? 235 : 227);
+    if (view->_fileSize < minHeaderSize) {
+      _LLAS_logError("File is too small to contain a public header: " + filePath);
+      return nullptr;
+    }
+
+    view->_header = PublicHeader::readPublicHeader(view->_data);
+
+    // NOTE: Format is defined from 0 to 10. The decoder is selected once here.
+    const LLAS_UCHAR format = view->_header.pointDataRecordFormat;
+    view->_decoder = PointDataRecord::getDecoder(format);
+    if (view->_decoder == nullptr) {
+      _LLAS_logError("Invalid point data record format:  " + std::to_string(format));
+      return nullptr;
+    }
+
+    const size_t endOfPointData = (size_t)view->_header.offsetToPointData + view->getNumPoints() * view->_header.pointDataRecordLength;
+    if (endOfPointData > view->_fileSize) {
+      _LLAS_logError("Point data records exceed the end of file: " + filePath);
+      return nullptr;
+    }
+
+    return view;
+  }
+
+  inline const PublicHeader& getHeader() const {
+    return _header;
+  }
+
+  inline const char* data() const {
+    return _data;
+  }
+
+  inline size_t getFileSize() const {
+    return _fileSize;
+  }
+
+  /// @brief Get the number of points declared in the public header
+  /// @return `nPoints` (`size_t`)
+  inline size_t getNumPoints() const {
+    const bool isLegacyFormat = _header.pointDataRecordFormat <= 5;
+    return isLegacyFormat ? (size_t)_header.legacyNumOfPointRecords : (size_t)_header.numOfPointRecords;
+  }
+
+  /// @brief Decode a single point data record from the mapped pages
+  /// @param iRecord Index of the record
+  /// @return `Point data record` (`PointDataRecord`)
+  inline PointDataRecord getPointDataRecord(const size_t iRecord) const {
+    PointDataRecord pointDataRecord;
+    _decoder(_data + _header.offsetToPointData + iRecord * _header.pointDataRecordLength, pointDataRecord);
+    return pointDataRecord;
+  }
+
+  /// @brief Decode a contiguous range of point data records
+  /// @param iFirstRecord Index of the first record
+  /// @param nRecords Number of records
+  /// @param pointDataRecords Output buffer with room for `nRecords` records
+  inline void decodePointDataRecords(const size_t iFirstRecord,
+                                     const size_t nRecords,
+                                     PointDataRecord* pointDataRecords) const {
+    const size_t recordLength = _header.pointDataRecordLength;
+    const char* byteData = _data + _header.offsetToPointData + iFirstRecord * recordLength;
+
+    for (size_t iRecord = 0; iRecord < nRecords; ++iRecord) {
+      pointDataRecords[iRecord] = PointDataRecord();
+      _decoder(byteData + iRecord * recordLength, pointDataRecords[iRecord]);
+    }
+  }
+
+  /// @brief Decode all point data records in fixed-size chunks.
+  ///        Only one chunk of decoded records is alive at a time.
+  /// @param chunkSize Number of records per chunk
+  /// @param callback Called like `callback(const PointDataRecord* records, size_t iFirstRecord, size_t nRecords)`
+  template <class Callback>
+  void forEachPointChunk(const size_t chunkSize, Callback&& callback) const {
+    const size_t nPoints = getNumPoints();
+    const size_t nRecordsPerChunk = std::max<size_t>(chunkSize, 1);
+    const size_t recordLength = _header.pointDataRecordLength;
+
+    std::vector<PointDataRecord> chunk(std::min(nRecordsPerChunk, nPoints));
+
+    for (size_t iFirstRecord = 0; iFirstRecord < nPoints; iFirstRecord += nRecordsPerChunk) {
+      const size_t nRecords = std::min(nRecordsPerChunk, nPoints - iFirstRecord);
+      const size_t beginByte = _header.offsetToPointData + iFirstRecord * recordLength;
+
+      decodePointDataRecords(iFirstRecord, nRecords, chunk.data());
+
+      callback((const PointDataRecord*)chunk.data(), iFirstRecord, nRecords);
+
+      releasePages(beginByte, beginByte + nRecords * recordLength);
+    }
+  }
+
+  /// @brief Decode all point data records in fixed-size chunks in parallel.
+  ///        Runs of chunks are handed to `parallelFor`, and each run owns one chunk buffer,
+  ///        so `callback` is called concurrently for disjoint record ranges and must be thread-safe.
+  /// @param chunkSize Number of records per chunk
+  /// @param callback Called like `callback(const PointDataRecord* records, size_t iFirstRecord, size_t nRecords)`
+  /// @param parallelFor Called like `parallelFor(size_t nItems, func)`. It calls `func(size_t iBegin, size_t iEnd)` for ranges which cover `[0, nItems)`, possibly concurrently.
+  ///                    Pass one which runs on the thread pool of the application, so that no threads are started per call.
+  template <class Callback, class ParallelFor, class = std::enable_if_t<!std::is_integral<std::decay_t<ParallelFor>>::value>>
+  void parallelForEachPointChunk(const size_t chunkSize, Callback&& callback, ParallelFor&& parallelFor) const {
+    const size_t nPoints = getNumPoints();
+    const size_t nRecordsPerChunk = std::max<size_t>(chunkSize, 1);
+    const size_t nChunks = (nPoints + nRecordsPerChunk - 1) / nRecordsPerChunk;
+    const size_t recordLength = _header.pointDataRecordLength;
+
+#if defined(LLAS_MEASURE_TIME)
+    const auto startTime = std::chrono::system_clock::now();
+#endif
+
+    parallelFor(nChunks, [&](const size_t iBeginChunk, const size_t iEndChunk) {
+      std::vector<PointDataRecord> chunk(std::min(nRecordsPerChunk, nPoints));
+
+      for (size_t iChunk = iBeginChunk; iChunk < iEndChunk; ++iChunk) {
+        const size_t iFirstRecord = iChunk * nRecordsPerChunk;
+        const size_t nRecords = std::min(nRecordsPerChunk, nPoints - iFirstRecord);
+        const size_t beginByte = _header.offsetToPointData + iFirstRecord * recordLength;
+
+        decodePointDataRecords(iFirstRecord, nRecords, chunk.data());
+
+        callback((const PointDataRecord*)chunk.data(), iFirstRecord, nRecords);
+
+        releasePages(beginByte, beginByte + nRecords * recordLength);
+      }
+    });
+
+#if defined(LLAS_MEASURE_TIME)
+    const auto endTime = std::chrono::system_clock::now();
+    const double elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() * 1e-6;
+    _LLAS_logInfo("Decoded " + std::to_string(nPoints) + " points in " + std::to_string(elapsedTime) + " [sec] (" + std::to_string((double)nPoints / std::max(elapsedTime, 1e-9)) + " [points/sec])");
+#endif
+  }
+
+  /// @brief Decode all point data records in fixed-size chunks on threads started by 'llas::parallelFor'
+  /// @param chunkSize Number of records per chunk
+  /// @param callback Called like `callback(const PointDataRecord* records, size_t iFirstRecord, size_t nRecords)`
+  /// @param nThreads Number of threads. `0` means all hardware threads.
+  template <class Callback>
+  void parallelForEachPointChunk(const size_t chunkSize, Callback&& callback, const size_t nThreads = 0) const {
+    parallelForEachPointChunk(
+        chunkSize,
+        std::forward<Callback>(callback),
+        [nThreads](const size_t nItems, const auto& func) { llas::parallelFor(nItems, nThreads, func); });
+  }
+};
+
+using LasView_ptr = std::shared_ptr<LasView>;
+
 // ==========================================================================
 // Functions
 // ==========================================================================
@@ -1617,18 +1890,24 @@ LLAS_FUNC_DECL_PREFIX LasData_ptr read(const std::string& filePath,
     const LLAS_ULLONG nPointRecords = isLegacyFormat ? publicHeader.legacyNumOfPointRecords : publicHeader.numOfPointRecords;
     _LLAS_logInfo("nPointRecords: " + std::to_string(nPointRecords));
 
-    const char* byteData = fileBytes.data();
+    const char* byteData = fileBytes.data() + publicHeader.offsetToPointData;
+    const size_t recordLength = publicHeader.pointDataRecordLength;
 
-    pointDataRecords.resize(nPointRecords);  // allocate
+    if (publicHeader.offsetToPointData + nPointRecords * recordLength > fileBytes.size()) {
+      _LLAS_logError("Point data records exceed the end of file: " + filePath);
+      return nullptr;  // return nullptr
+    }
 
-    for (LLAS_ULLONG iRecord = 0; iRecord < nPointRecords; ++iRecord) {
-      // NOTE: Move to the starting point of each Point Data Record
-      std::streamsize offset = publicHeader.offsetToPointData + iRecord * publicHeader.pointDataRecordLength;
+    // NOTE: Select the decoder once. Records are fixed-length, so the range is split across threads.
+    const PointDataRecord::Decoder_t decoder = PointDataRecord::getDecoder(format);
 
-      // Read
-      const auto pointDataRecord = PointDataRecord::readPointDataRecord(byteData, offset, format);
-      pointDataRecords[iRecord] = pointDataRecord;
-    }
+    pointDataRecords.resize(nPointRecords);  // allocate
+
+    parallelFor(nPointRecords, 0, [&](const size_t iBegin, const size_t iEnd) {
+      for (size_t iRecord = iBegin; iRecord < iEnd; ++iRecord) {
+        decoder(byteData + iRecord * recordLength, pointDataRecords[iRecord]);
+      }
+    });
   }
 
   // ======================================================================================================================
@@ -6,22 +6,90 @@
 namespace simview {
 namespace window {
 
+/// @brief Schedules the frames of a window.
+///
+/// [On-demand rendering]
+///   A frame is painted only when it is needed: input and window events request frames through the GLFW callbacks,
+///   programmatic changes call 'requestFrame', and animations keep painting with 'setIsAnimating'.
+///   Otherwise 'waitEvents' blocks the thread in 'glfwWaitEventsTimeout'. Worker threads wake it up with 'glfwPostEmptyEvent'.
+///
+/// [FPS limit]
+///   Frames are painted at most at the FPS limit, and nothing is painted while the window is minimized.
 class FPSManager {
  private:
   inline static const double DEFAULT_FPS = 240.0;
 
+  // NOTE: Frames painted for each request, so that the GUI settles hover states, popups and so on
+  inline static const int NUM_FRAMES_PER_REQUEST = 3;
+
+  // NOTE: Upper bound of blocking while idle [sec]
+  inline static const double IDLE_WAIT_TIMEOUT = 0.5;
+
+  GLFWwindow* _window;
+
   double _previousTime;
   double _fps;
   double _invFps;
 
+  bool _isOnDemand;
+  bool _isAnimating;
+  int _nRequestedFrames;
+
+  GLFWcursorposfun _prevCursorPosCallback;
+  GLFWmousebuttonfun _prevMouseButtonCallback;
+  GLFWscrollfun _prevScrollCallback;
+  GLFWkeyfun _prevKeyCallback;
+  GLFWcharfun _prevCharCallback;
+  GLFWcursorenterfun _prevCursorEnterCallback;
+  GLFWwindowfocusfun _prevWindowFocusCallback;
+  GLFWwindowiconifyfun _prevWindowIconifyCallback;
+  GLFWframebuffersizefun _prevFramebufferSizeCallback;
+  GLFWwindowrefreshfun _prevWindowRefreshCallback;
+
+  static FPSManager* fromWindow(GLFWwindow* window);
+
+  static void cursorPosCallback(GLFWwindow* window, double xpos, double ypos);
+  static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+  static void scrollCallback(GLFWwindow* window, double xoffset, double yoffset);
+  static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+  static void charCallback(GLFWwindow* window, unsigned int codepoint);
+  static void cursorEnterCallback(GLFWwindow* window, int entered);
+  static void windowFocusCallback(GLFWwindow* window, int focused);
+  static void windowIconifyCallback(GLFWwindow* window, int iconified);
+  static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
+  static void windowRefreshCallback(GLFWwindow* window);
+
  public:
-  FPSManager();
+  FPSManager(GLFWwindow* window);
   ~FPSManager();
 
   double getFPS() const;
   void setFPS(const double& fps);
+
+  /// @brief Install the callbacks requesting frames on events. Callbacks installed before are chained,
+  ///        so callbacks installed after this, e.g. by ImGui, must chain to these as well.
+  void installCallbacks();
+
+  /// @brief Paint a few frames, e.g. after the scene is changed programmatically
+  void requestFrame() { _nRequestedFrames = NUM_FRAMES_PER_REQUEST; };
+
+  /// @brief Keep painting every frame, e.g. while the model is rotating
+  void setIsAnimating(const bool isAnimating) { _isAnimating = isAnimating; };
+
+  /// @brief Paint every frame regardless of the requests if false
+  bool getIsOnDemand() const { return _isOnDemand; };
+  void setIsOnDemand(const bool isOnDemand) { _isOnDemand = isOnDemand; };
+
+  bool isDirty() const { return !_isOnDemand || _isAnimating || _nRequestedFrames > 0; };
+  bool isMinimized() const;
+
+  /// @brief Consume a frame if one is needed and the FPS limit allows it
+  /// @return `toUpdate` (`bool`)
   bool update();
+
+  /// @brief Process events, blocking until the next frame is due or an event arrives
+  void waitEvents();
 };
 
 }  // namespace window
-}  // namespace simview
\ No newline at end of file
+}  // namespace simview
@@ -10,9 +10,11 @@
 #include <SimView/Window/FPSManager.hpp>
 #include <SimView/Window/ImGuiObjectAddPanel.hpp>
 #include <SimView/Window/ImGuiSceneView.hpp>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace simview {
 namespace window {
@@ -24,6 +26,14 @@ class ImGuiMainView {
   inline static const char* FLOAT_FORMAT = "%.6f";
   inline static const char* RENDER_TYPE_ITEMS = "Normal\0Color\0Texture\0Vertex Normal\0Shading\0Shading with texture\0Material\0";
   inline static const char* WIREFRAME_TYPE_ITEMS = "OFF\0ON\0Wire frame only\0";
+  inline static const char* RECORDING_FORMAT_ITEMS = "PNG sequence\0JPG sequence\0Y4M video\0";
+
+  // NOTE: Time spent for uploading objects loaded in background per frame [sec]
+  inline static const double LOAD_TIME_BUDGET = 0.004;
+
+  // NOTE: Number of frames in the frame time graph
+  inline static const int FRAME_TIME_HISTORY_SIZE = 240;
+
   inline static const char* HELP_TEXT =
       "##### Simple Object Viewer #####\n"
       " \n"
@@ -61,6 +71,11 @@ class ImGuiMainView {
   std::shared_ptr<float[]> _wireFrameColorBuffer = nullptr;
   std::shared_ptr<float[]> _lightPositionBuffer = nullptr;
   std::shared_ptr<char[]> _screenshotFilePathBuffer = nullptr;
+  std::shared_ptr<char[]> _recordingPathBuffer = nullptr;
+
+  int _recordingFormatID;
+  int _recordingFrameStep;
+  int _recordingFrameRate;
 
   bool _isVisibleSideBar;
   bool _isVisibleHelpMessage;
@@ -89,6 +104,10 @@ class ImGuiMainView {
 
   std::shared_ptr<FPSManager> _fpsManager;
 
+  // NOTE: CPU time of the painted frames [ms], as a ring buffer
+  std::vector<float> _frameTimeHistory;
+  int _frameTimeHistoryOffset;
+
   bool _moveOn;
 
   bool _toOpenExitProgramPopup;
@@ -113,6 +132,12 @@ class ImGuiMainView {
 
   bool shouldUpdate() const;
 
+  /// @brief Block until the next frame is due or an event arrives
+  void waitEvents() const;
+
+  /// @brief Paint a few frames after changing the scene without any events
+  void requestFrame() const;
+
   bool toMoveOn() const;
 
   ImGuiSceneView_t getSceneView() const { return _sceneView; };
@@ -7,6 +7,7 @@
 #include <SimView/Model/Box.hpp>
 #include <SimView/Model/MaterialObject.hpp>
 #include <SimView/Model/Object.hpp>
+#include <SimView/Model/OctreePointCloud.hpp>
 #include <SimView/Model/PointCloud.hpp>
 #include <SimView/Model/PointCloudPoly.hpp>
 #include <SimView/Model/Sphere.hpp>
@@ -15,7 +16,6 @@
 #include <SimView/Model/ViewerModel.hpp>
 #include <SimView/OpenGL.hpp>
 #include <SimView/Util/ObjectLoader.hpp>
-#include <SimView/Util/StreamExecutor.hpp>
 #include <SimView/Window/ImGuiSceneView.hpp>
 #include <map>
 #include <memory>
@@ -40,8 +40,6 @@ class ImGuiObjectAddPanel {
   std::string _errorMessage = "";
   std::string _readableExtensions;
 
-  std::shared_ptr<util::StreamExecutor> _streamExecutor;
-
  public:
   // Nothing
 
@@ -2,8 +2,11 @@
 
 #include <SimView/ImGui.hpp>
 #include <SimView/Model/Model.hpp>
+#include <SimView/Renderer/FrameRecorder.hpp>
 #include <SimView/Renderer/Renderer.hpp>
+#include <SimView/Renderer/ScreenCapture.hpp>
 #include <SimView/Util/StbAdapter.hpp>
+#include <future>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -14,6 +17,8 @@ namespace window {
 class ImGuiSceneView {
  private:
   renderer::Renderer_t _renderer = nullptr;
+  renderer::ScreenCapture_t _screenCapture = nullptr;
+  renderer::FrameRecorder_t _frameRecorder = nullptr;
   model::Model_t _model = nullptr;
   GLFWwindow* _parentWindow = nullptr;
 
@@ -69,6 +74,7 @@ class ImGuiSceneView {
 
   renderer::FrameBuffer_t getFrameBuffer();
   renderer::Renderer_t getRenderer();
+  renderer::FrameRecorder_t getFrameRecorder() const { return _frameRecorder; };
 
   void paintGL();
   void resetCameraPose();
@@ -85,7 +91,20 @@ class ImGuiSceneView {
   void motionEvent(const bool& isMouseOnScene, const ImVec2& relMousePos);
   void wheelEvent(const bool& isMouseOnScene, const float& offset);
 
-  void saveScreenShot(const std::string& filePath);
+  /// @brief Save the last frame in background
+  /// @return `isSaved` (`std::future<bool>`): Set when the image is written
+  std::future<bool> saveScreenShot(const std::string& filePath);
+
+  bool hasPendingScreenShots() const;
+
+  /// @brief Record the following frames at the size of the current frame.
+  ///        While recording, the animations advance only when the recorder can take the frame.
+  /// @return `isStarted` (`bool`)
+  bool startRecording(const renderer::FrameRecorder::Settings& settings);
+
+  void stopRecording();
+
+  bool isRecording() const;
 
   void setCameraPose(const glm::vec3& cameraPos,
                      const glm::vec3& cameraLookAt,
@@ -16,17 +16,21 @@
 #include "Model/AxisAlignedBoundingBox.hpp"
 #include "Model/Background.hpp"
 #include "Model/Box.hpp"
+#include "Model/DrawBatcher.hpp"
 #include "Model/GridPlane.hpp"
 #include "Model/LightBall.hpp"
 #include "Model/LineSet.hpp"
 #include "Model/MaterialObject.hpp"
 #include "Model/Model.hpp"
 #include "Model/Object.hpp"
+#include "Model/ObjectLoadTask.hpp"
+#include "Model/OctreePointCloud.hpp"
 #include "Model/PointCloud.hpp"
 #include "Model/PointCloudPoly.hpp"
 #include "Model/PoneModel.hpp"
 #include "Model/Primitives.hpp"
 #include "Model/RenderingContext.hpp"
+#include "Model/ResidencyManager.hpp"
 #include "Model/Sphere.hpp"
 #include "Model/Terrain.hpp"
 #include "Model/TextBox.hpp"
@@ -36,7 +40,10 @@
 // Renderer
 #include "Renderer/DepthRenderer.hpp"
 #include "Renderer/FrameBuffer.hpp"
+#include "Renderer/FrameRecorder.hpp"
+#include "Renderer/RenderTargetPool.hpp"
 #include "Renderer/Renderer.hpp"
+#include "Renderer/ScreenCapture.hpp"
 
 // Shader
 #include "Shader/DefaultShaders.hpp"
@@ -44,21 +51,31 @@
 #include "Shader/ModelShader.hpp"
 #include "Shader/Shader.hpp"
 #include "Shader/ShaderCompiler.hpp"
+#include "Shader/UniformName.hpp"
 
 // Utility
 #include "Util/Colors.hpp"
+#include "Util/Culling.hpp"
 #include "Util/DataStructure.hpp"
 #include "Util/FileUtil.hpp"
 #include "Util/FontStorage.hpp"
+#include "Util/GLResource.hpp"
+#include "Util/GLStateCache.hpp"
 #include "Util/Geometry.hpp"
+#include "Util/GpuBufferArena.hpp"
 #include "Util/Logging.hpp"
+#include "Util/MappedTextFile.hpp"
 #include "Util/Math.hpp"
+#include "Util/MeshClusters.hpp"
 #include "Util/ModelParser.hpp"
 #include "Util/ObjectLoader.hpp"
+#include "Util/PlyFile.hpp"
 #include "Util/StbAdapter.hpp"
-#include "Util/StreamExecutor.hpp"
 #include "Util/StringUtil.hpp"
+#include "Util/TaskScheduler.hpp"
 #include "Util/Texture.hpp"
+#include "Util/VertexCache.hpp"
+#include "Util/VertexLayout.hpp"
 #include "Util/llas.hpp"
 
 // Window
@@ -118,6 +118,11 @@ PoneApp::PoneApp(const std::string& configFilePath) {
   glfwSetScrollCallback(window, Window::wheelEvent);
   glfwSetKeyCallback(window, keyboardEventPone);
 
+  // NOTE: After the callbacks above, which are chained
+  fpsManager = std::make_shared<FPSManager>(window);
+  fpsManager->setFPS(Window::FPS);
+  fpsManager->installCallbacks();
+
   {
     std::cout << std::endl
               << "### Start initilizing models ..." << std::endl;
@@ -135,28 +140,34 @@ PoneApp::~PoneApp() {
 }
 
 void PoneApp::launch() {
+  // NOTE: The game moves every frame, but the thread sleeps between the frames
+  fpsManager->setIsAnimating(true);
+
   double prevTime = glfwGetTime();
   while (glfwWindowShouldClose(window) == GLFW_FALSE) {
+    if (!fpsManager->update()) {
+      fpsManager->waitEvents();
+      continue;
+    }
+
     double currentTime = glfwGetTime();
 
-    if (currentTime - prevTime >= 1.0 / Window::FPS) {
-      {
-        double fps = 1.0 / (currentTime - prevTime);
-        char winTitle[256];
-        sprintf(winTitle, "%s (FPS: %.3f)", WIN_TITLE, fps);
-        glfwSetWindowTitle(window, winTitle);
-      }
+    {
+      double fps = 1.0 / (currentTime - prevTime);
+      char winTitle[256];
+      sprintf(winTitle, "%s (FPS: %.3f)", WIN_TITLE, fps);
+      glfwSetWindowTitle(window, winTitle);
+    }
 
-      if (Window::enabledModelRotationMode) {
-        Window::renderer->rotateModel(Window::ROTATE_ANIMATION_ANGLE, Window::cameraUp);
-      }
+    if (Window::enabledModelRotationMode) {
+      Window::renderer->rotateModel(Window::ROTATE_ANIMATION_ANGLE, Window::cameraUp);
+    }
 
-      Window::renderer->paintGL();
-      glfwSwapBuffers(window);
-      glfwPollEvents();
+    Window::renderer->paintGL();
+    glfwSwapBuffers(window);
+    glfwPollEvents();
 
-      prevTime = currentTime;
-    }
+    prevTime = currentTime;
   }
 }
 
@@ -74,6 +74,11 @@ ViewerApp::ViewerApp(std::string configFilePath) {
   glfwSetCursorPosCallback(window, Window::motionEvent);
   glfwSetScrollCallback(window, Window::wheelEvent);
   glfwSetKeyCallback(window, keyboardEventViewer);
+
+  // NOTE: After the callbacks above, which are chained
+  fpsManager = std::make_shared<FPSManager>(window);
+  fpsManager->setFPS(Window::FPS);
+  fpsManager->installCallbacks();
 }
 
 ViewerApp::~ViewerApp() {
@@ -84,26 +89,32 @@ ViewerApp::~ViewerApp() {
 void ViewerApp::launch() {
   double prevTime = glfwGetTime();
   while (glfwWindowShouldClose(window) == GLFW_FALSE) {
-    const double currentTime = glfwGetTime();
+    fpsManager->setIsAnimating(Window::enabledModelRotationMode);
 
-    if (currentTime - prevTime >= 1.0 / Window::FPS) {
-      {
-        const double fps = 1.0 / (currentTime - prevTime);
-        char winTitle[256];
-        sprintf(winTitle, "%s (FPS: %.3f)", WIN_TITLE, fps);
-        glfwSetWindowTitle(window, winTitle);
-      }
+    if (!fpsManager->update()) {
+      // NOTE: Nothing changed, or the next frame is not due yet
+      fpsManager->waitEvents();
+      continue;
+    }
 
-      if (Window::enabledModelRotationMode) {
-        Window::renderer->rotateModel(Window::ROTATE_ANIMATION_ANGLE, Window::cameraUp);
-      }
+    const double currentTime = glfwGetTime();
 
-      Window::renderer->paintGL();
-      glfwSwapBuffers(window);
-      glfwPollEvents();
+    {
+      const double fps = 1.0 / (currentTime - prevTime);
+      char winTitle[256];
+      sprintf(winTitle, "%s (FPS: %.3f)", WIN_TITLE, fps);
+      glfwSetWindowTitle(window, winTitle);
+    }
 
-      prevTime = currentTime;
+    if (Window::enabledModelRotationMode) {
+      Window::renderer->rotateModel(Window::ROTATE_ANIMATION_ANGLE, Window::cameraUp);
     }
+
+    Window::renderer->paintGL();
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+
+    prevTime = currentTime;
   }
 }
 
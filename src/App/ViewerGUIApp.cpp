@@ -131,19 +131,23 @@ void ViewerGUIApp::launch() {
 
 void ViewerGUIApp::addObject(const model::Primitive_t& object, bool toInitializeVAO) {
   _model->addObject(object, toInitializeVAO);
+  _view->requestFrame();
 }
 
 void ViewerGUIApp::addBackground(const model::Background_t& background) {
   _model->addBackground(background);
+  _view->requestFrame();
 }
 
 void ViewerGUIApp::setRenderType(const model::Primitive::RenderType renderType) {
   _view->setRenderType(renderType);
   _model->setRenderType(renderType);
+  _view->requestFrame();
 }
 
 void ViewerGUIApp::setSideBarVisibility(const bool& isVisible) {
   _view->setSideBarVisibility(isVisible);
+  _view->requestFrame();
 }
 
 void ViewerGUIApp::setWindowSubTitle(const std::string& subTitle) {
@@ -164,6 +168,11 @@ void ViewerGUIApp::setCameraPose(const glm::vec3& cameraPos,
   _view->getSceneView()->setCameraPose(cameraPos,
                                        cameraLookAt,
                                        cameraUp);
+  _view->requestFrame();
+}
+
+void ViewerGUIApp::requestFrame() const {
+  _view->requestFrame();
 }
 
 bool ViewerGUIApp::shouldUpdateWindow() const {
@@ -183,6 +192,9 @@ void ViewerGUIApp::paint() const {
     // Swap to another buffer ##############
     glfwSwapBuffers(_window);
     // #####################################
+  } else {
+    // NOTE: Nothing changed, or the next frame is not due yet
+    _view->waitEvents();
   }
 }
 
@@ -123,42 +123,26 @@ void AxesCone::initVAO() {
   // ObjectLoader::translateObject(vertices, _offsetX, _offsetY, _offsetZ);
 
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(vertices);
 
   // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, id));
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 }
 
 void AxesCone::paintGL(
@@ -210,13 +194,10 @@ void AxesCone::paintGL(
 
 void AxesCone::drawGL(const int& index) {
   // Enable VAO
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Draw triangles
   glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  // Disable VAO
-  glBindVertexArray(0);
 }
 
 void AxesCone::drawAllGL(const glm::mat4& lightMvpMat) {
@@ -17,6 +17,7 @@ Background::Background(const GLuint& textureId)
 Background::Background(const std::string& filePath)
     : Primitive(),
       _isLoadedTexture(false),
+      _textureId(0),
       _textureFilePath(filePath) {
   setDefaultRenderType(RenderType::TEXTURE);
 }
@@ -40,40 +41,26 @@ void Background::initVAO() {
     indices->push_back(idx++);
   }
 
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(vertices);
 
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+  // Setup attributes for vertex buffer object
+  _vertexLayout.setupAttributes();
 
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, id));
-
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 
   // Load Texture
   if (!_isLoadedTexture) {
-    Texture::loadTexture(_textureFilePath, _textureId);
+    Texture::loadTexture(_textureFilePath, _loadedTexture);
+    _textureId = _loadedTexture;
   }
 }
 
@@ -114,9 +101,8 @@ void Background::paintGL(
 }
 
 void Background::drawGL(const int& index) {
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
   glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-  glBindVertexArray(0);
 }
 
 void Background::drawAllGL(const glm::mat4& lightMvpMat) {
@@ -0,0 +1,217 @@
+#include <SimView/Model/DrawBatcher.hpp>
+
+namespace simview {
+namespace model {
+
+using namespace util;
+using namespace shader;
+
+DrawBatcher::DrawBatcher()
+    : _isEnabled(true),
+      _arenas(),
+      _shader(nullptr),
+      _depthShader(nullptr),
+      _drawParamsBufferId(),
+      _indirectBufferId(),
+      _drawParamsBufferSize(0),
+      _indirectBufferSize(0),
+      _draws(),
+      _drawParams(),
+      _commands(),
+      _nBatchedDraws(0),
+      _nMultiDrawCalls(0) {
+}
+
+bool DrawBatcher::isSupported() {
+#ifdef SIMVIEW_WITH_MULTI_DRAW_INDIRECT
+  return true;
+#else
+  return false;
+#endif
+}
+
+void DrawBatcher::compileShaders() {
+  if (!isSupported()) {
+    return;
+  }
+
+  LOG_INFO("Compile batched shaders.");
+  _shader = std::make_shared<ModelShader>(DefaultBatchedModelShader::VERT_SHADER, DefaultBatchedModelShader::FRAG_SHADER);
+  _depthShader = std::make_shared<DepthShader>(DefaultBatchedModelShader::DEPTH_VERT_SHADER, DefaultBatchedModelShader::DEPTH_FRAG_SHADER);
+
+  if (!_drawParamsBufferId.isValid()) {
+    _drawParamsBufferId.create();
+  }
+
+  if (!_indirectBufferId.isValid()) {
+    _indirectBufferId.create();
+  }
+}
+
+void DrawBatcher::releaseShaders() {
+  _shader = nullptr;
+  _depthShader = nullptr;
+}
+
+GpuBufferArena_t DrawBatcher::getArena(const VertexLayout& vertexLayout) {
+  for (const auto& arena : _arenas) {
+    if (arena->getVertexLayout().hasSameFormat(vertexLayout)) {
+      return arena;
+    }
+  }
+
+  _arenas.push_back(std::make_shared<GpuBufferArena>(vertexLayout));
+  return _arenas.back();
+}
+
+void DrawBatcher::add(const GpuBufferArena_t& arena,
+                      const GpuBufferArena::Range& range,
+                      const GLuint textureId,
+                      const DrawParams& params) {
+  if (range.nIndices == 0) {
+    return;
+  }
+
+  _draws.push_back({arena.get(), textureId, range, params});
+}
+
+void DrawBatcher::paintGL(const TransformationContext& transCtx,
+                          const LightingContext& lightingCtx,
+                          const RenderingContext& renderingCtx) {
+  _nBatchedDraws = _draws.size();
+  _nMultiDrawCalls = 0;
+
+  if (_draws.empty() || _shader == nullptr) {
+    _draws.clear();
+    return;
+  }
+
+  uploadDraws();
+
+  // NOTE: The matrices of the scene. Each draw adds its translation in the vertex shader.
+  _shader->bind();
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_MV_MAT, transCtx.mvMat);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_MVP_MAT, transCtx.mvpMat);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_NORM_MAT, glm::transpose(glm::inverse(transCtx.mvMat)));
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_LIGHT_MAT, transCtx.lightMat);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_LIGHT_POS, lightingCtx.lightPos);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_LIGHT_MVP_MAT, transCtx.lightMvpMat);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_SHININESS, lightingCtx.shininess);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_AMBIENT_INTENSITY, lightingCtx.ambientIntensity);
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_AMBIENT_COLOR, glm::vec3(0.0f));
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_DIFFUSE_COLOR, glm::vec3(0.0f));
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_SPECULAR_COLOR, glm::vec3(0.0f));
+  _shader->setUniformVariable(DefaultModelShader::UNIFORM_NAME_BUMP_MAP, false);
+
+  _nMultiDrawCalls = issueDraws(_shader, renderingCtx.depthTextureId);
+
+  _shader->unbind();
+  _draws.clear();
+}
+
+void DrawBatcher::drawGL(const glm::mat4& lightMvpMat) {
+  if (_draws.empty() || _depthShader == nullptr) {
+    _draws.clear();
+    return;
+  }
+
+  uploadDraws();
+
+  _depthShader->bind();
+  _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvpMat);
+
+  issueDraws(nullptr, 0);
+
+  _depthShader->unbind();
+  _draws.clear();
+}
+
+void DrawBatcher::uploadDraws() {
+  // NOTE: Draws of the same arena and texture become contiguous commands of one multi-draw call
+  std::sort(_draws.begin(), _draws.end(), [](const Draw& draw0, const Draw& draw1) {
+    if (draw0.arena != draw1.arena) {
+      return draw0.arena < draw1.arena;
+    }
+    return draw0.textureId < draw1.textureId;
+  });
+
+  const size_t nDraws = _draws.size();
+  _drawParams.resize(nDraws);
+  _commands.resize(nDraws);
+
+  for (size_t iDraw = 0; iDraw < nDraws; ++iDraw) {
+    const Draw& draw = _draws[iDraw];
+
+    _drawParams[iDraw] = draw.params;
+
+    DrawElementsIndirectCommand& command = _commands[iDraw];
+    command.count = draw.range.nIndices;
+    command.instanceCount = 1;
+    command.firstIndex = draw.range.firstIndex;
+    command.baseVertex = (GLint)draw.range.baseVertex;
+    command.baseInstance = (GLuint)iDraw;  // NOTE: Index of the parameters, read as 'gl_BaseInstance'
+  }
+
+#ifdef SIMVIEW_WITH_MULTI_DRAW_INDIRECT
+  reserveBuffer(GL_SHADER_STORAGE_BUFFER, _drawParamsBufferId, _drawParamsBufferSize, sizeof(DrawParams) * nDraws);
+  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(DrawParams) * nDraws, _drawParams.data());
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DefaultBatchedModelShader::DRAW_PARAMS_BINDING, _drawParamsBufferId);
+
+  reserveBuffer(GL_DRAW_INDIRECT_BUFFER, _indirectBufferId, _indirectBufferSize, sizeof(DrawElementsIndirectCommand) * nDraws);
+  glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(DrawElementsIndirectCommand) * nDraws, _commands.data());
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#endif
+}
+
+size_t DrawBatcher::issueDraws(const ModelShader_t& shader, const GLuint depthTextureId) {
+  size_t nMultiDrawCalls = 0;
+
+#ifdef SIMVIEW_WITH_MULTI_DRAW_INDIRECT
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, _indirectBufferId);
+
+  const size_t nDraws = _draws.size();
+  size_t iFirstDraw = 0;
+  while (iFirstDraw < nDraws) {
+    const Draw& firstDraw = _draws[iFirstDraw];
+
+    size_t iLastDraw = iFirstDraw + 1;
+    while (iLastDraw < nDraws && _draws[iLastDraw].arena == firstDraw.arena && _draws[iLastDraw].textureId == firstDraw.textureId) {
+      ++iLastDraw;
+    }
+
+    if (shader != nullptr) {
+      // NOTE: Binding again restarts the texture units. Other calls are elided by the state cache.
+      shader->bind();
+      shader->setUniformTexture(DefaultModelShader::UNIFORM_NAME_DEPTH_TEXTURE, depthTextureId);
+      shader->setUniformTexture(DefaultModelShader::UNIFORM_NAME_AMBIENT_TEXTURE, firstDraw.textureId);
+      shader->setUniformTexture(DefaultModelShader::UNIFORM_NAME_DIFFUSE_TEXTURE, firstDraw.textureId);
+    }
+
+    GLStateCache::getInstance().bindVertexArray(firstDraw.arena->getVaoId());
+    glMultiDrawElementsIndirect(GL_TRIANGLES,
+                                GL_UNSIGNED_INT,
+                                reinterpret_cast<const void*>(sizeof(DrawElementsIndirectCommand) * iFirstDraw),
+                                (GLsizei)(iLastDraw - iFirstDraw),
+                                0);
+
+    ++nMultiDrawCalls;
+    iFirstDraw = iLastDraw;
+  }
+
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#endif
+
+  return nMultiDrawCalls;
+}
+
+void DrawBatcher::reserveBuffer(const GLenum target, const GLuint bufferId, size_t& bufferSize, const size_t nBytes) {
+  glBindBuffer(target, bufferId);
+
+  // NOTE: The storage is orphaned every pass, so that the commands of the previous pass are not waited for
+  bufferSize = std::max(bufferSize, nBytes);
+  glBufferData(target, bufferSize, nullptr, GL_STREAM_DRAW);
+}
+
+}  // namespace model
+}  // namespace simview
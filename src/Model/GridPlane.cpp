@@ -3,6 +3,8 @@
 namespace simview {
 namespace model {
 
+using namespace util;
+
 GridPlane::GridPlane(const int& nDivs,
                      const glm::vec2& minCoords,
                      const glm::vec2& maxCoords)
@@ -72,42 +74,26 @@ void GridPlane::initVAO() {
   }
 
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(vertices);
 
   // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, id));
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 }
 
 void GridPlane::paintGL(
@@ -149,17 +135,12 @@ void GridPlane::paintGL(
 }
 
 void GridPlane::drawGL(const int& index) {
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
-  glEnable(GL_LINE_SMOOTH);
-  glEnable(GL_BLEND);
+  GLStateCache::getInstance().enable(GL_LINE_SMOOTH);
+  GLStateCache::getInstance().enable(GL_BLEND);
 
   glDrawElements(GL_LINES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  glDisable(GL_LINE_SMOOTH);
-  glDisable(GL_BLEND);
-
-  glBindVertexArray(0);
 }
 
 void GridPlane::drawAllGL(const glm::mat4& lightMvpMat) {
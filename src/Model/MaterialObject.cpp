@@ -8,12 +8,18 @@ using namespace shader;
 
 MaterialObject::MaterialObject(const std::string& filePath,
                                const glm::vec3 offset,
-                               const glm::vec3 scale)
+                               const glm::vec3 scale,
+                               const bool indexed,
+                               const bool clustered)
     : Primitive(),
       _filePath(filePath),
       _offset(offset),
       _scale(scale),
+      _isIndexed(indexed),
+      _isClustered(clustered),
       _materialObjectBuffers(std::make_shared<std::vector<MaterialObjectBuffer_t>>()) {
+  // NOTE: All material groups share the layout. Positions are not quantized, so no per-group decoding is needed.
+  _vertexLayout = VertexLayout::createCompactMesh();
 }
 
 MaterialObject::~MaterialObject() = default;
@@ -23,7 +29,8 @@ void MaterialObject::initVAO() {
   ObjectLoader::readObjFileWithMaterialGroup(_filePath,
                                              materialGroups,
                                              _offset,
-                                             _scale);
+                                             _scale,
+                                             _isIndexed);
 
   for (int iObject = 0; iObject < (int)materialGroups->size(); ++iObject) {
     MaterialObjectBuffer_t buffer = std::make_shared<MaterialObjectBuffer>();
@@ -31,43 +38,32 @@ void MaterialObject::initVAO() {
 
     buffer->materialGroup = materialGroup;
 
+    if (_isClustered) {
+      // NOTE: Triangles are reordered by clusters before the upload
+      buffer->clusters.build(*materialGroup->vertices, *materialGroup->indices);
+    }
+
     // Create VAO
-    glGenVertexArrays(1, &buffer->vaoId);
-    glBindVertexArray(buffer->vaoId);
+    buffer->vaoId.create();
+    GLStateCache::getInstance().bindVertexArray(buffer->vaoId);
 
     // Create vertex buffer object
-    glGenBuffers(1, &buffer->vertexBufferId);
+    buffer->vertexBufferId.create();
     glBindBuffer(GL_ARRAY_BUFFER, buffer->vertexBufferId);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * materialGroup->vertices->size(), materialGroup->vertices->data(), GL_STATIC_DRAW);
+    _vertexLayout.upload(materialGroup->vertices);
 
     // Setup attributes for vertex buffer object
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bary));
-
-    glEnableVertexAttribArray(4);
-    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, uv));
-
-    glEnableVertexAttribArray(5);
-    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, id));
+    _vertexLayout.setupAttributes();
 
     // Create index buffer object
-    glGenBuffers(1, &buffer->indexBufferId);
+    buffer->indexBufferId.create();
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->indexBufferId);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * materialGroup->indices->size(), materialGroup->indices->data(), GL_STATIC_DRAW);
 
     buffer->indexBufferSize = (int)materialGroup->indices->size();
 
     // Temporarily disable VAO
-    glBindVertexArray(0);
+    GLStateCache::getInstance().bindVertexArray(0);
 
     // Load texture
     if (FileUtil::exists(materialGroup->ambientTexturePath) && FileUtil::isFile(materialGroup->ambientTexturePath)) {
@@ -148,6 +144,10 @@ void MaterialObject::paintGL(
           _shader->setUniformTexture(DefaultModelShader::UNIFORM_NAME_NORMAL_MAP, object->bumpTextureId);
         }
 
+        if (!object->clusters.isEmpty()) {
+          object->clusters.cull(mvptMat);
+        }
+
         drawGL(iObject);
 
         {
@@ -161,17 +161,28 @@ void MaterialObject::paintGL(
 
 void MaterialObject::drawGL(const int& index) {
   // Draw
-  glBindVertexArray((*_materialObjectBuffers)[index]->vaoId);
-  glDrawElements(GL_TRIANGLES, (*_materialObjectBuffers)[index]->indexBufferSize, GL_UNSIGNED_INT, 0);
-  glBindVertexArray(0);
+  const MaterialObjectBuffer_t& object = (*_materialObjectBuffers)[index];
+
+  GLStateCache::getInstance().bindVertexArray(object->vaoId);
+  if (object->clusters.isEmpty()) {
+    glDrawElements(GL_TRIANGLES, object->indexBufferSize, GL_UNSIGNED_INT, 0);
+  } else {
+    // NOTE: Clusters culled in the last 'cull'
+    object->clusters.draw();
+  }
 }
 
 void MaterialObject::drawAllGL(const glm::mat4& lightMvpMat) {
   if (_isVisible) {
     const glm::mat4& lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+    setDepthShaderUniforms(lightMvptMat);
 
     for (int iObject = 0; iObject < (int)_materialObjectBuffers->size(); ++iObject) {
+      const MaterialObjectBuffer_t& object = (*_materialObjectBuffers)[iObject];
+      if (!object->clusters.isEmpty()) {
+        object->clusters.cull(lightMvptMat);
+      }
+
       drawGL(iObject);
     }
   }
@@ -9,6 +9,7 @@ using namespace shader;
 Model::Model()
     : _objects(std::make_shared<std::vector<Primitive_t>>()),
       _backgrounds(std::make_shared<std::vector<Background_t>>()),
+      _loadTasks(),
       _backgroundColor(0.0f, 0.0f, 0.0f, 1.0f),
       _modelVertMShaderPath(),
       _modelFragShaderPath(),
@@ -18,14 +19,173 @@ Model::Model()
       _time(),
       _shader(),
       _depthShader(),
+      _drawBatcher(std::make_shared<DrawBatcher>()),
+      _residencyManager(),
       _lightPosition(5.0f, 5.0f, 5.0f, 1.0f),
       _shininess(50.0f),
       _ambientIntensity(0.1f),
       _wireFrameColor(15.0f / 255.0f, 230.0f / 255.0f, 130.0f / 255.0f),
-      _wireFrameWidth(1.0f) {
+      _wireFrameWidth(1.0f),
+      _isEnabledCulling(true),
+      _objectBVH(),
+      _boundedObjectIds(),
+      _boundedObjectIdsBuffer(),
+      _objectBounds(),
+      _hasObjectBounds(),
+      _isObjectInside(),
+      _isObjectDrawn(),
+      _nDrawnObjects(0),
+      _nCulledObjects(0),
+      _nDrawnShadowCasters(0),
+      _nCulledShadowCasters(0) {
 }
 
-Model::~Model() {}
+Model::~Model() {
+  // NOTE: Running workers keep their tasks alive, so only cancellation is needed here
+  for (const auto& task : _loadTasks) {
+    task->cancel();
+  }
+}
+
+ObjectLoadTask_t Model::addObjectAsync(const Primitive_t& object, TaskScheduler& scheduler) {
+  if (!object->isAsyncLoadable()) {
+    addObject(object);
+    return nullptr;
+  }
+
+  object->setModelShader(getModelShader());
+  object->setDepthShader(getDepthShader());
+  object->setDrawBatcher(getDrawBatcher());
+
+  ObjectLoadTask_t task = std::make_shared<ObjectLoadTask>(object);
+  task->start(scheduler);
+  _loadTasks.push_back(task);
+
+  return task;
+}
+
+void Model::processLoadTasks(const double timeBudget) {
+  if (_loadTasks.empty()) {
+    return;
+  }
+
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeBudget));
+
+  for (const auto& task : _loadTasks) {
+    task->upload(deadline);
+
+    if (task->getState() == ObjectLoadTask::State::DONE) {
+      _objects->push_back(task->getObject());
+    }
+  }
+
+  _loadTasks.erase(std::remove_if(_loadTasks.begin(),
+                                  _loadTasks.end(),
+                                  [](const ObjectLoadTask_t& task) { return task->isFinished(); }),
+                   _loadTasks.end());
+}
+
+bool Model::hasPendingUploads() const {
+  for (const auto& task : _loadTasks) {
+    const ObjectLoadTask::State state = task->getState();
+    if (state != ObjectLoadTask::State::QUEUED && state != ObjectLoadTask::State::LOADING) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Model::needsFrame() const {
+  for (const auto& object : *_objects) {
+    if (object->needsFrame()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Model::drawGL(const glm::mat4& lightMvpMat) {
+  cullObjects(lightMvpMat, _nDrawnShadowCasters, _nCulledShadowCasters);
+
+  // NOTE: Objects only set the uniform variables of the depth shader, so it is bound here for all of them
+  _depthShader->bind();
+
+  const int nObjects = getNumObjects();
+  for (int iObject = 0; iObject < nObjects; ++iObject) {
+    if (_isObjectDrawn[iObject]) {
+      _residencyManager.use(*(*_objects)[iObject]);
+      (*_objects)[iObject]->drawAllGL(lightMvpMat);
+    }
+  }
+
+  // NOTE: Objects in the buffer arenas were added to the batch instead of drawn
+  _drawBatcher->drawGL(lightMvpMat);
+
+  _depthShader->unbind();
+}
+
+void Model::cullObjects(const glm::mat4& mvpMat, size_t& nDrawn, size_t& nCulled) {
+  const int64_t nObjects = (int64_t)_objects->size();
+
+  _isObjectDrawn.assign(nObjects, 1);
+  _hasObjectBounds.resize(nObjects);
+  _objectBounds.resize(nObjects);
+
+  // ================================================================================================
+  // Gather the bounds of the visible objects
+  // ================================================================================================
+  parallelFor(
+      0,
+      nObjects,
+      [&](const int64_t iObject) {
+        const Primitive_t& object = (*_objects)[iObject];
+        BoundingVolumeHierarchy::Box& bounds = _objectBounds[iObject];
+        _hasObjectBounds[iObject] = object->getIsVisible() && object->getBounds(bounds.minCoords, bounds.maxCoords);
+      },
+      CULLING_GRAIN_SIZE);
+
+  _boundedObjectIdsBuffer.clear();
+  for (int64_t iObject = 0; iObject < nObjects; ++iObject) {
+    if (_hasObjectBounds[iObject]) {
+      _objectBounds[_boundedObjectIdsBuffer.size()] = _objectBounds[iObject];
+      _boundedObjectIdsBuffer.push_back((int32_t)iObject);
+    }
+  }
+  _objectBounds.resize(_boundedObjectIdsBuffer.size());
+
+  // ================================================================================================
+  // Update the hierarchy and query the frustum
+  // ================================================================================================
+  if (_isEnabledCulling) {
+    if (_boundedObjectIdsBuffer != _boundedObjectIds) {
+      _boundedObjectIds.swap(_boundedObjectIdsBuffer);
+      _objectBVH.build(_objectBounds);
+    } else {
+      _objectBVH.refit(_objectBounds);
+    }
+
+    _objectBVH.query(Frustum(mvpMat), _isObjectInside);
+
+    for (size_t iBounded = 0; iBounded < _boundedObjectIds.size(); ++iBounded) {
+      _isObjectDrawn[_boundedObjectIds[iBounded]] = _isObjectInside[iBounded];
+    }
+  }
+
+  nDrawn = 0;
+  nCulled = 0;
+  for (int64_t iObject = 0; iObject < nObjects; ++iObject) {
+    if (!(*_objects)[iObject]->getIsVisible()) {
+      continue;
+    }
+
+    if (_isObjectDrawn[iObject]) {
+      ++nDrawn;
+    } else {
+      ++nCulled;
+    }
+  }
+}
 
 void Model::compileShaders(const bool& isQuad) {
   {
@@ -83,6 +243,21 @@ void Model::compileShaders(const bool& isQuad) {
     _depthShader = std::make_shared<DepthShader>(depthVertShaderCode, depthFragShaderCode);
   }
 
+  {
+    // =============================================================================================
+    // Batched shader programs
+    // =============================================================================================
+    // NOTE: They are variants of the default shaders, so batching is disabled with custom ones
+    const bool isDefaultShaders = _modelVertMShaderPath == nullptr && _modelFragShaderPath == nullptr &&
+                                  _depthVertMShaderPath == nullptr && _depthFragShaderPath == nullptr;
+
+    if (!isQuad && isDefaultShaders) {
+      _drawBatcher->compileShaders();
+    } else {
+      _drawBatcher->releaseShaders();
+    }
+  }
+
   // Set program to the existing objects
   setModelShader(_shader);
   setDepthShader(_depthShader);
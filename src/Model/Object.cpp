@@ -11,7 +11,9 @@ Object::Object(const std::string &filePath,  // filePath
                const float offsetY,          // offsetY
                const float offsetZ,          // offsetZ
                const float scale,            // scale
-               const bool autoScale          // autoScale
+               const bool autoScale,         // autoScale
+               const bool indexed,           // indexed
+               const bool clustered          // clustered
                )
     : Primitive(),
       _filePath(filePath),
@@ -19,10 +21,49 @@ Object::Object(const std::string &filePath,  // filePath
       _offsetY(offsetY),
       _offsetZ(offsetZ),
       _scale(scale),
-      _autoScale(autoScale) {}
+      _autoScale(autoScale),
+      _isIndexed(indexed),
+      _isClustered(clustered),
+      _clusters() {
+  _vertexLayout = VertexLayout::createCompactMesh();
+}
 
 Object::~Object() {}
 
+bool Object::loadData() {
+  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+
+  ObjectLoader::readFromFile(_filePath,
+                             vertices,
+                             indices,
+                             _offsetX,
+                             _offsetY,
+                             _offsetZ,
+                             _autoScale,
+                             false,
+                             _isIndexed);
+
+  ObjectLoader::scaleObject(vertices, _scale);
+
+  if (_isClustered) {
+    _clusters.build(*vertices, *indices);
+  }
+
+  return setLoadedData(vertices, indices);
+}
+
+float Object::uploadData(const size_t maxBytes) {
+  const float progress = uploadLoadedData(_vaoId, _vertexBufferId, _indexBufferId, maxBytes);
+
+  if (progress >= 1.0f) {
+    initBoundingVolumes(_loadedVertices, _loadedIndices);
+    clearLoadedData();
+  }
+
+  return progress;
+}
+
 void Object::initVAO() {
   VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
   IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
@@ -33,7 +74,9 @@ void Object::initVAO() {
                              _offsetX,
                              _offsetY,
                              _offsetZ,
-                             _autoScale);
+                             _autoScale,
+                             false,
+                             _isIndexed);
 
   ObjectLoader::scaleObject(vertices, _scale);
 
@@ -97,44 +140,39 @@ void Object::initVAO(const std::shared_ptr<std::vector<vec3f_t>> positions,  //
 
 void Object::initVAO(const VertexArray_t &vertices,
                      const IndexArray_t &indices) {
+  if (_isClustered) {
+    // NOTE: Triangles are reordered by clusters before the upload
+    _clusters.build(*vertices, *indices);
+  }
+
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(vertices);
 
   // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, id));
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
+  _nEvictableBytes = _vertexLayout.getStride() * vertices->size() + sizeof(uint32_t) * indices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 
+  initBoundingVolumes(vertices, indices);
+}
+
+void Object::initBoundingVolumes(const VertexArray_t &vertices,
+                                 const IndexArray_t &indices) {
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(vertices);
   _bbox = std::make_shared<AxisAlignedBoundingBox>(minCoords, maxCoords);
@@ -192,6 +230,10 @@ void Object::paintGL(
         _shader->setUniformTexture(DefaultModelShader::UNIFORM_NAME_NORMAL_MAP, _normalMapId);
       }
 
+      if (!_clusters.isEmpty()) {
+        _clusters.cull(mvptMat);
+      }
+
       drawGL();
 
       unbindShader();
@@ -201,15 +243,23 @@ void Object::paintGL(
 
 void Object::drawGL(const int &index) {
   // Draw
-  glBindVertexArray(_vaoId);
-  glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
+  if (_clusters.isEmpty()) {
+    glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
+  } else {
+    // NOTE: Clusters culled in the last 'cull'
+    _clusters.draw();
+  }
 }
 
 void Object::drawAllGL(const glm::mat4 &lightMvpMat) {
   if (_isVisible) {
     const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+    setDepthShaderUniforms(lightMvptMat);
+
+    if (!_clusters.isEmpty()) {
+      _clusters.cull(lightMvptMat);
+    }
 
     drawGL();
   }
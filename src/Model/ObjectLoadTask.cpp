@@ -0,0 +1,98 @@
+#include <SimView/Model/ObjectLoadTask.hpp>
+
+namespace simview {
+namespace model {
+
+ObjectLoadTask::ObjectLoadTask(const Primitive_t& object)
+    : _object(object),
+      _state(State::QUEUED),
+      _isCancelRequested(false),
+      _uploadProgress(0.0f) {
+}
+
+ObjectLoadTask::~ObjectLoadTask() = default;
+
+void ObjectLoadTask::start(util::TaskScheduler& scheduler) {
+  // NOTE: The worker keeps the task alive even if the task is removed from the model while loading
+  std::shared_ptr<ObjectLoadTask> self = shared_from_this();
+
+  scheduler.enqueue([self]() {
+    self->load();
+  });
+}
+
+void ObjectLoadTask::load() {
+  if (_isCancelRequested) {
+    _state = State::CANCELED;
+    return;
+  }
+
+  _state = State::LOADING;
+
+  bool isLoaded = false;
+
+  try {
+    isLoaded = _object->loadData();
+  } catch (const std::exception& exception) {
+    LOG_ERROR("Failed to load '" + _object->getName() + "': " + std::string(exception.what()));
+  }
+
+  if (_isCancelRequested) {
+    _state = State::CANCELED;
+  } else if (isLoaded) {
+    _state = State::UPLOADING;
+  } else {
+    LOG_ERROR("Failed to load '" + _object->getName() + "'");
+    _state = State::FAILED;
+  }
+
+  // NOTE: Wake up the GL thread, which may be blocked waiting for events
+  glfwPostEmptyEvent();
+}
+
+void ObjectLoadTask::upload(const std::chrono::steady_clock::time_point& deadline) {
+  if (_state != State::UPLOADING) {
+    return;
+  }
+
+  if (_isCancelRequested) {
+    _state = State::CANCELED;
+    return;
+  }
+
+  while (std::chrono::steady_clock::now() < deadline) {
+    _uploadProgress = _object->uploadData(UPLOAD_CHUNK_SIZE);
+
+    if (_uploadProgress >= 1.0f) {
+      _state = State::DONE;
+      LOG_INFO("Loaded '" + _object->getName() + "'");
+      break;
+    }
+  }
+}
+
+bool ObjectLoadTask::isFinished() const {
+  const State state = _state;
+  return state == State::DONE || state == State::CANCELED || state == State::FAILED;
+}
+
+std::string ObjectLoadTask::getStateName(const State state) {
+  switch (state) {
+    case State::QUEUED:
+      return "Queued";
+    case State::LOADING:
+      return "Loading";
+    case State::UPLOADING:
+      return "Uploading";
+    case State::DONE:
+      return "Done";
+    case State::CANCELED:
+      return "Canceled";
+    case State::FAILED:
+      return "Failed";
+  }
+  return "";
+}
+
+}  // namespace model
+}  // namespace simview
@@ -0,0 +1,1119 @@
+#include <SimView/Model/OctreePointCloud.hpp>
+#include <SimView/Util/llas.hpp>
+
+namespace simview {
+namespace model {
+
+using namespace util;
+using namespace shader;
+
+OctreePointCloud::OctreePointCloud(const std::string &filePath,
+                                   const float offsetX,
+                                   const float offsetY,
+                                   const float offsetZ,
+                                   const float scale,
+                                   const float pointSize,
+                                   const bool autoScale,
+                                   const size_t pointBudget)
+    : Primitive(),
+      _filePath(filePath),
+      _offsetX(offsetX),
+      _offsetY(offsetY),
+      _offsetZ(offsetZ),
+      _scale(scale),
+      _pointSize(pointSize),
+      _autoScale(autoScale),
+      _pointBudget(),
+      _cacheCapacity(),
+      _cacheFilePath(),
+      _nodes(),
+      _minCoords(0.0f),
+      _maxCoords(0.0f),
+      _lruNodes(),
+      _loadingNodes(),
+      _visibleNodes(),
+      _nResidentPoints(0),
+      _nVisiblePoints(0),
+      _frameIndex(0),
+      _isSelectionRefined(true) {
+  _vertexLayout = VertexLayout::createPointCloud();
+  setPointBudget(pointBudget);
+}
+
+OctreePointCloud::~OctreePointCloud() {
+  // NOTE: Workers reading nodes hold their own chunks, so they are not waited for
+  for (auto &node : _nodes) {
+    releaseNode(node);
+  }
+}
+
+void OctreePointCloud::setPointBudget(const size_t pointBudget) {
+  _pointBudget = std::max<size_t>(1, pointBudget);
+  _cacheCapacity = 2 * _pointBudget;
+}
+
+// ==================================================================================================
+// Cache file
+// ==================================================================================================
+std::vector<std::string> OctreePointCloud::getCacheFilePaths() const {
+  std::vector<std::string> cacheFilePaths;
+  cacheFilePaths.push_back(_filePath + CACHE_EXTENSION);
+
+  std::error_code error;
+  const auto tempDirPath = generic_fs::temp_directory_path(error);
+  if (!error) {
+    cacheFilePaths.push_back((tempDirPath / (FileUtil::baseName(_filePath) + CACHE_EXTENSION)).string());
+  }
+
+  return cacheFilePaths;
+}
+
+OctreePointCloud::CacheHeader OctreePointCloud::createCacheHeader() const {
+  CacheHeader header{};
+  std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  header.version = CACHE_VERSION;
+  header.sourceSize = (uint64_t)FileUtil::fileSize(_filePath);
+  header.sourceWriteTime = FileUtil::lastWriteTime(_filePath);
+  header.offset[0] = _offsetX;
+  header.offset[1] = _offsetY;
+  header.offset[2] = _offsetZ;
+  header.scale = _scale;
+  header.autoScale = _autoScale ? 1 : 0;
+  return header;
+}
+
+bool OctreePointCloud::isCacheHeaderValid(const CacheHeader &header) const {
+  const CacheHeader expected = createCacheHeader();
+
+  return std::memcmp(header.magic, expected.magic, sizeof(CACHE_MAGIC)) == 0 &&
+         header.version == expected.version &&
+         header.sourceSize == expected.sourceSize &&
+         header.sourceWriteTime == expected.sourceWriteTime &&
+         header.offset[0] == expected.offset[0] &&
+         header.offset[1] == expected.offset[1] &&
+         header.offset[2] == expected.offset[2] &&
+         header.scale == expected.scale &&
+         header.autoScale == expected.autoScale;
+}
+
+bool OctreePointCloud::openCache() {
+  for (const auto &cacheFilePath : getCacheFilePaths()) {
+    if (!FileUtil::isFile(cacheFilePath)) {
+      continue;
+    }
+
+    std::ifstream file(cacheFilePath, std::ios::binary);
+
+    CacheHeader header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(CacheHeader)) || !isCacheHeaderValid(header) || header.nNodes == 0) {
+      LOG_WARN("Ignore an outdated octree cache: " + cacheFilePath);
+      continue;
+    }
+
+    // NOTE: A cache which was not written to the end is rebuilt. Its header is written last.
+    const uint64_t expectedSize = header.nodeTableOffset + sizeof(NodeRecord) * header.nNodes;
+    if (header.nodeTableOffset != sizeof(CacheHeader) + sizeof(PointRecord) * header.nPoints ||
+        (uint64_t)FileUtil::fileSize(cacheFilePath) != expectedSize) {
+      LOG_WARN("Ignore a broken octree cache: " + cacheFilePath);
+      continue;
+    }
+
+    std::vector<NodeRecord> records(header.nNodes);
+    file.seekg((std::streamoff)header.nodeTableOffset);
+    if (!file.read(reinterpret_cast<char *>(records.data()), sizeof(NodeRecord) * records.size())) {
+      LOG_WARN("Ignore a broken octree cache: " + cacheFilePath);
+      continue;
+    }
+
+    _nodes.clear();
+    _nodes.resize(records.size());
+    for (size_t iNode = 0; iNode < records.size(); ++iNode) {
+      _nodes[iNode].record = records[iNode];
+    }
+
+    _minCoords = glm::vec3(header.minCoords[0], header.minCoords[1], header.minCoords[2]);
+    _maxCoords = glm::vec3(header.maxCoords[0], header.maxCoords[1], header.maxCoords[2]);
+    _cacheFilePath = cacheFilePath;
+
+    LOG_INFO("Opened an octree cache with " + std::to_string(header.nPoints) + " points in " + std::to_string(header.nNodes) + " nodes: " + cacheFilePath);
+
+    return true;
+  }
+
+  return false;
+}
+
+bool OctreePointCloud::buildCache() {
+  for (const auto &cacheFilePath : getCacheFilePaths()) {
+    // NOTE: Built in a unique file and renamed into place, so that viewers building the same cache do not share files
+    const std::string tmpFilePath = FileUtil::uniquePath(cacheFilePath) + ".tmp";
+
+    std::error_code error;
+    if (buildCache(tmpFilePath)) {
+      generic_fs::rename(tmpFilePath, cacheFilePath, error);
+
+      if (!error) {
+        LOG_INFO("Wrote an octree cache: " + cacheFilePath);
+        return true;
+      }
+    }
+
+    LOG_WARN("Failed to write an octree cache: " + cacheFilePath);
+
+    generic_fs::remove(tmpFilePath, error);
+  }
+
+  return false;
+}
+
+bool OctreePointCloud::buildCache(const std::string &cacheFilePath) const {
+  std::ofstream cacheFile(cacheFilePath, std::ios::binary | std::ios::trunc);
+  if (!cacheFile) {
+    return false;
+  }
+
+  // NOTE: A blank header until the build is finished, so that an interrupted build is not taken as a cache
+  CacheHeader header{};
+  cacheFile.write(reinterpret_cast<const char *>(&header), sizeof(CacheHeader));
+
+  // ==================================================================================================
+  // Count the points and find their bounds while the source is streamed
+  // ==================================================================================================
+  // NOTE: The bucket files of the octants are named after this file, so they are as unique as 'cacheFilePath'
+  const std::string pointFilePath = cacheFilePath + ".points";
+
+  uint64_t nPoints = 0;
+  glm::vec3 sourceMinCoords, sourceMaxCoords;
+
+  if (!convertSource(pointFilePath, nPoints, sourceMinCoords, sourceMaxCoords)) {
+    std::error_code error;
+    generic_fs::remove(pointFilePath, error);
+    return false;
+  }
+
+  if (nPoints == 0) {
+    LOG_ERROR("No points in " + _filePath);
+
+    std::error_code error;
+    generic_fs::remove(pointFilePath, error);
+    return false;
+  }
+
+  LOG_INFO("Read " + std::to_string(nPoints) + " points from " + _filePath);
+
+  const Placement placement = createPlacement(sourceMinCoords, sourceMaxCoords);
+  const glm::vec3 minCoords = glm::min(placement.apply(sourceMinCoords), placement.apply(sourceMaxCoords));
+  const glm::vec3 maxCoords = glm::max(placement.apply(sourceMinCoords), placement.apply(sourceMaxCoords));
+
+  const glm::vec3 extent = maxCoords - minCoords;
+  float size = std::max(extent.x, std::max(extent.y, extent.z));
+  if (size <= 0.0f) {
+    size = 1.0f;
+  }
+
+  // ==================================================================================================
+  // Build the tree and write the points
+  // ==================================================================================================
+  BuildNode root;
+  root.minCoords = minCoords;
+  root.size = size;
+  root.depth = 0;
+  root.begin = 0;
+  root.nPoints = 0;
+  root.fileOffset = 0;
+
+  if (!partitionNode(pointFilePath, nPoints, &placement, root, cacheFile)) {
+    return false;
+  }
+
+  // ==================================================================================================
+  // Write the node table and the header
+  // ==================================================================================================
+  header = createCacheHeader();
+  header.nPoints = nPoints;
+  header.minCoords[0] = minCoords.x;
+  header.minCoords[1] = minCoords.y;
+  header.minCoords[2] = minCoords.z;
+  header.maxCoords[0] = maxCoords.x;
+  header.maxCoords[1] = maxCoords.y;
+  header.maxCoords[2] = maxCoords.z;
+
+  if (!writeNodeTable(cacheFile, root, header)) {
+    return false;
+  }
+
+  cacheFile.seekp(0);
+  cacheFile.write(reinterpret_cast<const char *>(&header), sizeof(CacheHeader));
+  cacheFile.close();
+
+  return !cacheFile.fail();
+}
+
+bool OctreePointCloud::convertSource(const std::string &pointFilePath,
+                                     uint64_t &nPoints,
+                                     glm::vec3 &minCoords,
+                                     glm::vec3 &maxCoords) const {
+  std::ofstream pointFile(pointFilePath, std::ios::binary | std::ios::trunc);
+  if (!pointFile) {
+    return false;
+  }
+
+  nPoints = 0;
+  minCoords = glm::vec3(std::numeric_limits<float>::max());
+  maxCoords = glm::vec3(std::numeric_limits<float>::lowest());
+
+  const std::string extension = FileUtil::extension(_filePath);
+
+  if (extension == ".las") {
+    // ==================================================================================================
+    // LAS: Chunks are decoded in parallel, and written to their own ranges of the file
+    // ==================================================================================================
+    const auto lasView = llas::LasView::open(_filePath);
+    if (lasView == nullptr) {
+      return false;
+    }
+
+    const llas::PublicHeader &header = lasView->getHeader();
+    const float colorScale = 1.0f / 65535.0f;
+
+    std::mutex mutex;
+
+    lasView->parallelForEachPointChunk(
+        LLAS_DEFAULT_CHUNK_SIZE,
+        [&](const llas::PointDataRecord *records, const size_t iFirstRecord, const size_t nRecords) {
+          std::vector<PointRecord> points(nRecords);
+
+          for (size_t iRecord = 0; iRecord < nRecords; ++iRecord) {
+            const llas::PointDataRecord &record = records[iRecord];
+
+            points[iRecord] = toPointRecord(glm::vec3((float)((double)record.x * header.xScaleFactor + header.xOffset),
+                                                      (float)((double)record.y * header.yScaleFactor + header.yOffset),
+                                                      (float)((double)record.z * header.zScaleFactor + header.zOffset)),
+                                            glm::vec3((float)record.red * colorScale,
+                                                      (float)record.green * colorScale,
+                                                      (float)record.blue * colorScale));
+          }
+
+          glm::vec3 chunkMinCoords = glm::vec3(std::numeric_limits<float>::max());
+          glm::vec3 chunkMaxCoords = glm::vec3(std::numeric_limits<float>::lowest());
+          expandBounds(points, chunkMinCoords, chunkMaxCoords);
+
+          std::lock_guard<std::mutex> lock(mutex);
+          pointFile.seekp((std::streamoff)(sizeof(PointRecord) * iFirstRecord));
+          writePoints(pointFile, points);
+          minCoords = glm::min(minCoords, chunkMinCoords);
+          maxCoords = glm::max(maxCoords, chunkMaxCoords);
+        },
+        [](const size_t nChunks, const auto &func) { parallelForRange(0, (int64_t)nChunks, func); });
+
+    nPoints = lasView->getNumPoints();
+  } else if (extension == ".ply") {
+    // ==================================================================================================
+    // PLY: Ranges of the vertex element are decoded in parallel one after another
+    // ==================================================================================================
+    const PlyFile_t plyFile = PlyFile::open(_filePath);
+    if (plyFile == nullptr) {
+      return false;
+    }
+
+    nPoints = plyFile->getNumVertices();
+
+    std::vector<Vertex> vertices;
+    std::vector<PointRecord> points;
+    bool hasNormals = false;
+
+    for (uint64_t iFirstPoint = 0; iFirstPoint < nPoints; iFirstPoint += STREAM_CHUNK_SIZE) {
+      const size_t nChunkPoints = (size_t)std::min<uint64_t>(STREAM_CHUNK_SIZE, nPoints - iFirstPoint);
+
+      if (!plyFile->readVertices((size_t)iFirstPoint, nChunkPoints, vertices, hasNormals)) {
+        return false;
+      }
+
+      points.resize(nChunkPoints);
+      parallelFor(0, (int64_t)nChunkPoints, [&](const int64_t iPoint) {
+        points[iPoint] = toPointRecord(vertices[iPoint].position, vertices[iPoint].color);
+      });
+
+      expandBounds(points, minCoords, maxCoords);
+      writePoints(pointFile, points);
+    }
+  } else {
+    // ==================================================================================================
+    // Others: No chunked reader, so the file is loaded at once
+    // ==================================================================================================
+    VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+    IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+
+    // NOTE: The placement is applied to the points later
+    ObjectLoader::readFromFile(_filePath, vertices, indices, _offsetX, _offsetY, _offsetZ, false);
+    indices = nullptr;
+
+    nPoints = vertices->size();
+
+    std::vector<PointRecord> points(vertices->size());
+    parallelFor(0, (int64_t)points.size(), [&](const int64_t iPoint) {
+      points[iPoint] = toPointRecord((*vertices)[iPoint].position, (*vertices)[iPoint].color);
+    });
+
+    vertices = nullptr;
+
+    expandBounds(points, minCoords, maxCoords);
+    writePoints(pointFile, points);
+  }
+
+  pointFile.close();
+
+  return !pointFile.fail();
+}
+
+OctreePointCloud::Placement OctreePointCloud::createPlacement(const glm::vec3 &minCoords, const glm::vec3 &maxCoords) const {
+  Placement placement;
+  placement.center = (minCoords + maxCoords) / 2.0f;
+  placement.scale = _scale;
+  placement.offset = glm::vec3(_offsetX, _offsetY, _offsetZ);
+
+  if (_autoScale) {
+    // Automatically adjust model scale to [-1.0, 1.0]
+    const glm::vec3 extent = maxCoords - minCoords;
+    const float extentMax = std::max(extent.x, std::max(extent.y, extent.z));
+
+    if (extentMax > 0.0f) {
+      placement.scale *= 2.0f / extentMax;
+    }
+  }
+
+  return placement;
+}
+
+bool OctreePointCloud::partitionNode(const std::string &pointFilePath,
+                                     const uint64_t nPoints,
+                                     const Placement *placement,
+                                     BuildNode &node,
+                                     std::ofstream &cacheFile) {
+  if (nPoints <= MAX_IN_CORE_POINTS || node.depth >= MAX_DEPTH) {
+    return buildNodeInCore(pointFilePath, nPoints, placement, node, cacheFile);
+  }
+
+  LOG_INFO("Partitioning " + std::to_string(nPoints) + " points at depth " + std::to_string(node.depth));
+
+  // ==================================================================================================
+  // Sample at most one point per grid cell while the file is streamed. The others go to the bucket files of the octants.
+  // ==================================================================================================
+  std::ifstream pointFile(pointFilePath, std::ios::binary);
+
+  std::array<std::string, 8> bucketFilePaths;
+  std::array<std::ofstream, 8> bucketFiles;
+  std::array<uint64_t, 8> nBucketPoints{};
+
+  for (int iOctant = 0; iOctant < 8; ++iOctant) {
+    // NOTE: Bucket files are named after the path from the root, so that they are unique
+    bucketFilePaths[iOctant] = pointFilePath + std::to_string(iOctant);
+  }
+
+  const auto removeBucketFiles = [&](const int iFirstOctant) {
+    for (int iOctant = iFirstOctant; iOctant < 8; ++iOctant) {
+      std::error_code error;
+      generic_fs::remove(bucketFilePaths[iOctant], error);
+    }
+  };
+
+  std::unordered_set<uint32_t> occupiedCells;
+  occupiedCells.reserve(MAX_NODE_POINTS);
+
+  std::vector<PointRecord> sampledPoints;
+  std::vector<PointRecord> points;
+  std::vector<uint32_t> cellKeys;
+  std::vector<uint8_t> octants;
+  std::array<std::vector<PointRecord>, 8> bucketPoints;
+
+  bool isSucceeded = true;
+
+  for (uint64_t iFirstPoint = 0; iFirstPoint < nPoints && isSucceeded; iFirstPoint += STREAM_CHUNK_SIZE) {
+    const size_t nChunkPoints = (size_t)std::min<uint64_t>(STREAM_CHUNK_SIZE, nPoints - iFirstPoint);
+
+    if (!readPoints(pointFile, nChunkPoints, points)) {
+      isSucceeded = false;
+      break;
+    }
+
+    if (placement != nullptr) {
+      placePoints(*placement, points);
+    }
+
+    cellKeys.resize(nChunkPoints);
+    octants.resize(nChunkPoints);
+
+    parallelFor(0, (int64_t)nChunkPoints, [&](const int64_t iPoint) {
+      cellKeys[iPoint] = toCellKey(node, points[iPoint]);
+      octants[iPoint] = (uint8_t)toOctant(node, points[iPoint]);
+    });
+
+    // NOTE: In the order of the file, so that the samples are the same as those of a build in memory
+    for (size_t iPoint = 0; iPoint < nChunkPoints; ++iPoint) {
+      if (sampledPoints.size() < MAX_NODE_POINTS && occupiedCells.insert(cellKeys[iPoint]).second) {
+        sampledPoints.push_back(points[iPoint]);
+      } else {
+        bucketPoints[octants[iPoint]].push_back(points[iPoint]);
+      }
+    }
+
+    for (int iOctant = 0; iOctant < 8; ++iOctant) {
+      if (bucketPoints[iOctant].empty()) {
+        continue;
+      }
+
+      if (!bucketFiles[iOctant].is_open()) {
+        bucketFiles[iOctant].open(bucketFilePaths[iOctant], std::ios::binary | std::ios::trunc);
+      }
+
+      isSucceeded = isSucceeded && writePoints(bucketFiles[iOctant], bucketPoints[iOctant]);
+      nBucketPoints[iOctant] += bucketPoints[iOctant].size();
+      bucketPoints[iOctant].clear();
+    }
+  }
+
+  pointFile.close();
+
+  for (auto &bucketFile : bucketFiles) {
+    if (bucketFile.is_open()) {
+      bucketFile.close();
+      isSucceeded = isSucceeded && !bucketFile.fail();
+    }
+  }
+
+  std::error_code error;
+  generic_fs::remove(pointFilePath, error);
+
+  // NOTE: Free the work space before going down
+  std::unordered_set<uint32_t>().swap(occupiedCells);
+  std::vector<PointRecord>().swap(points);
+  std::vector<uint32_t>().swap(cellKeys);
+  std::vector<uint8_t>().swap(octants);
+
+  node.fileOffset = (uint64_t)cacheFile.tellp();
+  node.nPoints = (uint32_t)sampledPoints.size();
+
+  if (!isSucceeded || !writePoints(cacheFile, sampledPoints)) {
+    removeBucketFiles(0);
+    return false;
+  }
+
+  std::vector<PointRecord>().swap(sampledPoints);
+
+  // ==================================================================================================
+  // Partition the buckets one after another, so that one of them is in memory at a time
+  // ==================================================================================================
+  const float halfSize = 0.5f * node.size;
+
+  for (int iOctant = 0; iOctant < 8; ++iOctant) {
+    if (nBucketPoints[iOctant] == 0) {
+      continue;
+    }
+
+    auto child = std::make_unique<BuildNode>();
+    child->minCoords = node.minCoords + halfSize * glm::vec3((iOctant & 1) ? 1.0f : 0.0f,
+                                                             (iOctant & 2) ? 1.0f : 0.0f,
+                                                             (iOctant & 4) ? 1.0f : 0.0f);
+    child->size = halfSize;
+    child->depth = node.depth + 1;
+    child->begin = 0;
+    child->nPoints = 0;
+    child->fileOffset = 0;
+
+    if (!partitionNode(bucketFilePaths[iOctant], nBucketPoints[iOctant], nullptr, *child, cacheFile)) {
+      removeBucketFiles(iOctant + 1);
+      return false;
+    }
+
+    node.children[iOctant] = std::move(child);
+  }
+
+  return true;
+}
+
+bool OctreePointCloud::buildNodeInCore(const std::string &pointFilePath,
+                                       const uint64_t nPoints,
+                                       const Placement *placement,
+                                       BuildNode &node,
+                                       std::ofstream &cacheFile) {
+  if (nPoints > (uint64_t)UINT32_MAX) {
+    LOG_ERROR("Too many duplicated points in an octree node");
+    return false;
+  }
+
+  std::vector<PointRecord> points;
+
+  {
+    std::ifstream pointFile(pointFilePath, std::ios::binary);
+    const bool isRead = readPoints(pointFile, (size_t)nPoints, points);
+    pointFile.close();
+
+    std::error_code error;
+    generic_fs::remove(pointFilePath, error);
+
+    if (!isRead) {
+      return false;
+    }
+  }
+
+  if (placement != nullptr) {
+    placePoints(*placement, points);
+  }
+
+  std::vector<uint32_t> permutation(points.size());
+  std::iota(permutation.begin(), permutation.end(), 0);
+  std::vector<uint32_t> buffer(points.size());
+
+  node.begin = 0;
+  buildNode(points, permutation, buffer, node, (uint32_t)points.size());
+
+  std::vector<uint32_t>().swap(buffer);
+
+  return writeNodePoints(points, permutation, node, cacheFile);
+}
+
+void OctreePointCloud::buildNode(const std::vector<PointRecord> &points,
+                                 std::vector<uint32_t> &permutation,
+                                 std::vector<uint32_t> &buffer,
+                                 BuildNode &node,
+                                 const uint32_t end) {
+  const uint32_t nPoints = end - node.begin;
+
+  if (nPoints <= MAX_NODE_POINTS || node.depth >= MAX_DEPTH) {
+    node.nPoints = nPoints;
+    return;
+  }
+
+  // ==================================================================================================
+  // Sample at most one point per grid cell. The others are moved to the buffer.
+  // ==================================================================================================
+  std::unordered_set<uint32_t> occupiedCells;
+  occupiedCells.reserve(MAX_NODE_POINTS);
+
+  uint32_t nSampled = 0;
+  uint32_t nRest = 0;
+
+  for (uint32_t iPoint = node.begin; iPoint < end; ++iPoint) {
+    const uint32_t iVertex = permutation[iPoint];
+
+    // NOTE: Writing behind the read cursor is safe, because nSampled never exceeds the number of visited points
+    if (nSampled < MAX_NODE_POINTS && occupiedCells.insert(toCellKey(node, points[iVertex])).second) {
+      permutation[node.begin + nSampled++] = iVertex;
+    } else {
+      buffer[node.begin + nRest++] = iVertex;
+    }
+  }
+
+  node.nPoints = nSampled;
+
+  // ==================================================================================================
+  // Sort the rest by octants
+  // ==================================================================================================
+  const float halfSize = 0.5f * node.size;
+
+  std::array<uint32_t, 8> octantHeads{};
+  for (uint32_t iPoint = node.begin; iPoint < node.begin + nRest; ++iPoint) {
+    ++octantHeads[toOctant(node, points[buffer[iPoint]])];
+  }
+
+  uint32_t head = node.begin + nSampled;
+  for (auto &octantHead : octantHeads) {
+    const uint32_t nOctantPoints = octantHead;
+    octantHead = head;
+    head += nOctantPoints;
+  }
+
+  std::array<uint32_t, 8> octantBegins = octantHeads;
+  for (uint32_t iPoint = node.begin; iPoint < node.begin + nRest; ++iPoint) {
+    const uint32_t iVertex = buffer[iPoint];
+    permutation[octantHeads[toOctant(node, points[iVertex])]++] = iVertex;
+  }
+
+  // ==================================================================================================
+  // Build children. The ranges of the children are disjoint, so large subtrees are built in parallel.
+  // ==================================================================================================
+  TaskGroup group;
+
+  for (int iOctant = 0; iOctant < 8; ++iOctant) {
+    const uint32_t childBegin = octantBegins[iOctant];
+    const uint32_t childEnd = octantHeads[iOctant];
+
+    if (childBegin == childEnd) {
+      continue;
+    }
+
+    auto child = std::make_unique<BuildNode>();
+    child->minCoords = node.minCoords + halfSize * glm::vec3((iOctant & 1) ? 1.0f : 0.0f,
+                                                             (iOctant & 2) ? 1.0f : 0.0f,
+                                                             (iOctant & 4) ? 1.0f : 0.0f);
+    child->size = halfSize;
+    child->depth = node.depth + 1;
+    child->begin = childBegin;
+    child->nPoints = 0;
+    child->fileOffset = 0;
+
+    BuildNode *childPtr = child.get();
+    node.children[iOctant] = std::move(child);
+
+    if (childEnd - childBegin >= PARALLEL_BUILD_THRESHOLD) {
+      group.run([&points, &permutation, &buffer, childPtr, childEnd]() {
+        buildNode(points, permutation, buffer, *childPtr, childEnd);
+      });
+    } else {
+      buildNode(points, permutation, buffer, *childPtr, childEnd);
+    }
+  }
+
+  group.wait();
+}
+
+bool OctreePointCloud::writeNodePoints(const std::vector<PointRecord> &points,
+                                       const std::vector<uint32_t> &permutation,
+                                       BuildNode &node,
+                                       std::ofstream &cacheFile) {
+  std::vector<PointRecord> nodePoints(node.nPoints);
+  for (uint32_t iPoint = 0; iPoint < node.nPoints; ++iPoint) {
+    nodePoints[iPoint] = points[permutation[node.begin + iPoint]];
+  }
+
+  node.fileOffset = (uint64_t)cacheFile.tellp();
+
+  if (!writePoints(cacheFile, nodePoints)) {
+    return false;
+  }
+
+  for (const auto &child : node.children) {
+    if (child != nullptr && !writeNodePoints(points, permutation, *child, cacheFile)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool OctreePointCloud::writeNodeTable(std::ofstream &cacheFile,
+                                      const BuildNode &root,
+                                      CacheHeader &header) {
+  // ==================================================================================================
+  // Flatten the tree in the breadth-first order
+  // ==================================================================================================
+  std::vector<const BuildNode *> buildNodes = {&root};
+  std::vector<NodeRecord> records;
+
+  for (size_t iNode = 0; iNode < buildNodes.size(); ++iNode) {
+    const BuildNode *buildNode = buildNodes[iNode];
+
+    NodeRecord record{};
+    record.minCoords[0] = buildNode->minCoords.x;
+    record.minCoords[1] = buildNode->minCoords.y;
+    record.minCoords[2] = buildNode->minCoords.z;
+    record.size = buildNode->size;
+    record.fileOffset = buildNode->fileOffset;
+    record.nPoints = buildNode->nPoints;
+    record.depth = buildNode->depth;
+
+    for (int iOctant = 0; iOctant < 8; ++iOctant) {
+      record.children[iOctant] = -1;
+
+      if (buildNode->children[iOctant] != nullptr) {
+        record.children[iOctant] = (int32_t)buildNodes.size();
+        buildNodes.push_back(buildNode->children[iOctant].get());
+      }
+    }
+
+    records.push_back(record);
+  }
+
+  header.nNodes = (uint32_t)records.size();
+  header.nodeTableOffset = (uint64_t)cacheFile.tellp();
+
+  cacheFile.write(reinterpret_cast<const char *>(records.data()), sizeof(NodeRecord) * records.size());
+
+  return !cacheFile.fail();
+}
+
+OctreePointCloud::PointRecord OctreePointCloud::toPointRecord(const glm::vec3 &position, const glm::vec3 &color) {
+  const glm::vec3 scaledColor = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+
+  PointRecord point;
+  point.position[0] = position.x;
+  point.position[1] = position.y;
+  point.position[2] = position.z;
+  point.color[0] = (uint8_t)scaledColor.r;
+  point.color[1] = (uint8_t)scaledColor.g;
+  point.color[2] = (uint8_t)scaledColor.b;
+  point.color[3] = 255;
+  return point;
+}
+
+void OctreePointCloud::placePoints(const Placement &placement, std::vector<PointRecord> &points) {
+  parallelFor(0, (int64_t)points.size(), [&](const int64_t iPoint) {
+    float *position = points[iPoint].position;
+    const glm::vec3 placed = placement.apply(glm::vec3(position[0], position[1], position[2]));
+    position[0] = placed.x;
+    position[1] = placed.y;
+    position[2] = placed.z;
+  });
+}
+
+void OctreePointCloud::expandBounds(const std::vector<PointRecord> &points, glm::vec3 &minCoords, glm::vec3 &maxCoords) {
+  for (const PointRecord &point : points) {
+    const glm::vec3 position(point.position[0], point.position[1], point.position[2]);
+    minCoords = glm::min(minCoords, position);
+    maxCoords = glm::max(maxCoords, position);
+  }
+}
+
+uint32_t OctreePointCloud::toCellKey(const BuildNode &node, const PointRecord &point) {
+  const float cellScale = (float)SAMPLING_GRID_SIZE / node.size;
+  const float maxCell = (float)(SAMPLING_GRID_SIZE - 1);
+
+  const glm::vec3 position(point.position[0], point.position[1], point.position[2]);
+  const glm::vec3 cell = glm::clamp((position - node.minCoords) * cellScale, 0.0f, maxCell);
+
+  return ((uint32_t)cell.z * SAMPLING_GRID_SIZE + (uint32_t)cell.y) * SAMPLING_GRID_SIZE + (uint32_t)cell.x;
+}
+
+int OctreePointCloud::toOctant(const BuildNode &node, const PointRecord &point) {
+  const glm::vec3 center = node.minCoords + 0.5f * node.size;
+
+  return (point.position[0] >= center.x ? 1 : 0) | (point.position[1] >= center.y ? 2 : 0) | (point.position[2] >= center.z ? 4 : 0);
+}
+
+bool OctreePointCloud::readPoints(std::ifstream &file, const size_t nPoints, std::vector<PointRecord> &points) {
+  points.resize(nPoints);
+  return (bool)file.read(reinterpret_cast<char *>(points.data()), sizeof(PointRecord) * points.size());
+}
+
+bool OctreePointCloud::writePoints(std::ofstream &file, const std::vector<PointRecord> &points) {
+  file.write(reinterpret_cast<const char *>(points.data()), sizeof(PointRecord) * points.size());
+  return !file.fail();
+}
+
+void OctreePointCloud::readNode(const std::string &cacheFilePath, const NodeRecord &record, NodeChunk &chunk) {
+  try {
+    std::ifstream file(cacheFilePath, std::ios::binary);
+    std::vector<PointRecord> pointRecords(record.nPoints);
+
+    file.seekg((std::streamoff)record.fileOffset);
+
+    if (file.read(reinterpret_cast<char *>(pointRecords.data()), sizeof(PointRecord) * pointRecords.size())) {
+      std::vector<Vertex> vertices(record.nPoints);
+
+      for (uint32_t iPoint = 0; iPoint < record.nPoints; ++iPoint) {
+        const PointRecord &pointRecord = pointRecords[iPoint];
+        vertices[iPoint].position = glm::vec3(pointRecord.position[0], pointRecord.position[1], pointRecord.position[2]);
+        vertices[iPoint].color = glm::vec3(pointRecord.color[0], pointRecord.color[1], pointRecord.color[2]) / 255.0f;
+      }
+
+      chunk.packedVertices = chunk.layout.encode(vertices);
+    } else {
+      chunk.isFailed = true;
+    }
+  } catch (const std::exception &exception) {
+    LOG_ERROR("Failed to read an octree node: " + std::string(exception.what()));
+    chunk.isFailed = true;
+  }
+
+  chunk.isReady = true;
+
+  // NOTE: Wake up the GL thread, which may be blocked waiting for events
+  glfwPostEmptyEvent();
+}
+
+// ==================================================================================================
+// Loading
+// ==================================================================================================
+bool OctreePointCloud::loadData() {
+  if (!FileUtil::isFile(_filePath)) {
+    LOG_ERROR("File not found: " + _filePath);
+    return false;
+  }
+
+  if (openCache()) {
+    return true;
+  }
+
+  LOG_INFO("Building an octree of " + _filePath);
+
+  return buildCache() && openCache();
+}
+
+float OctreePointCloud::uploadData(const size_t maxBytes) {
+  // NOTE: Nodes are streamed while rendering. Only the bounding box is created here.
+  _bbox = std::make_shared<AxisAlignedBoundingBox>(_minCoords, _maxCoords);
+  return 1.0f;
+}
+
+bool OctreePointCloud::needsFrame() const {
+  // NOTE: Loaded nodes wait for 'uploadNodes', and the children of non-resident nodes for 'selectNodes'
+  return _isVisible && (!_loadingNodes.empty() || !_isSelectionRefined);
+}
+
+void OctreePointCloud::initVAO() {
+  if (loadData()) {
+    uploadData(0);
+  }
+}
+
+// ==================================================================================================
+// Streaming
+// ==================================================================================================
+void OctreePointCloud::selectNodes(const glm::mat4 &mvpMat, const glm::mat4 &mvMat, const glm::mat4 &projMat) {
+  _visibleNodes.clear();
+  _nVisiblePoints = 0;
+  _isSelectionRefined = true;
+
+  GLint viewport[4];
+  glGetIntegerv(GL_VIEWPORT, viewport);
+
+  // NOTE: Pixels per unit length at the unit distance (perspective) or at any distance (orthographic)
+  const float pixelsPerUnit = 0.5f * (float)viewport[3] * projMat[1][1];
+  const bool isPerspective = projMat[3][3] == 0.0f;
+
+  const Frustum frustum(mvpMat);
+
+  const auto calcProjectedSize = [&](const NodeRecord &record) {
+    if (!isPerspective) {
+      return record.size * pixelsPerUnit;
+    }
+
+    const float radius = 0.5f * std::sqrt(3.0f) * record.size;
+    const glm::vec3 center = glm::vec3(record.minCoords[0], record.minCoords[1], record.minCoords[2]) + 0.5f * record.size;
+    const float distance = glm::length(glm::vec3(mvMat * glm::vec4(center, 1.0f)));
+
+    // NOTE: The nearest point of the bounding sphere, so that a node around the camera gets the highest priority
+    return record.size * pixelsPerUnit / std::max(distance - radius, 1e-3f * radius);
+  };
+
+  const auto isNodeInFrustum = [&](const NodeRecord &record) {
+    const glm::vec3 minCoords(record.minCoords[0], record.minCoords[1], record.minCoords[2]);
+    return frustum.intersects(minCoords, minCoords + record.size);
+  };
+
+  // NOTE: Nodes with larger projected sizes first
+  std::priority_queue<std::pair<float, int32_t>> queue;
+
+  if (isNodeInFrustum(_nodes[0].record)) {
+    queue.emplace(calcProjectedSize(_nodes[0].record), 0);
+  }
+
+  while (!queue.empty()) {
+    const float projectedSize = queue.top().first;
+    const int32_t iNode = queue.top().second;
+    queue.pop();
+
+    Node &node = _nodes[iNode];
+
+    if (_nVisiblePoints + node.record.nPoints > _pointBudget) {
+      break;
+    }
+
+    _visibleNodes.push_back(iNode);
+    _nVisiblePoints += node.record.nPoints;
+    node.lastUsedFrame = _frameIndex;
+
+    if (!node.isResident) {
+      // NOTE: Children are refined after their parent is drawn, so that the cloud does not get holes while streaming
+      _isSelectionRefined &= node.isFailed;
+      continue;
+    }
+
+    _lruNodes.splice(_lruNodes.begin(), _lruNodes, node.lruIterator);
+
+    if (projectedSize / (float)SAMPLING_GRID_SIZE <= MAX_POINT_SPACING) {
+      continue;
+    }
+
+    for (const int32_t iChild : node.record.children) {
+      if (iChild >= 0 && isNodeInFrustum(_nodes[iChild].record)) {
+        queue.emplace(calcProjectedSize(_nodes[iChild].record), iChild);
+      }
+    }
+  }
+}
+
+void OctreePointCloud::requestNodes() {
+  TaskScheduler &scheduler = TaskScheduler::getInstance();
+
+  for (const int32_t iNode : _visibleNodes) {
+    if (_loadingNodes.size() >= MAX_LOADS_IN_FLIGHT) {
+      break;
+    }
+
+    Node &node = _nodes[iNode];
+
+    if (node.isResident || node.isFailed || node.chunk != nullptr) {
+      continue;
+    }
+
+    NodeChunk_t chunk = std::make_shared<NodeChunk>();
+    node.chunk = chunk;
+    _loadingNodes.push_back(iNode);
+
+    scheduler.enqueue([chunk, cacheFilePath = _cacheFilePath, record = node.record]() {
+      readNode(cacheFilePath, record, *chunk);
+    });
+  }
+}
+
+void OctreePointCloud::uploadNodes() {
+  size_t nUploadedBytes = 0;
+
+  for (auto iterator = _loadingNodes.begin(); iterator != _loadingNodes.end();) {
+    Node &node = _nodes[*iterator];
+
+    if (!node.chunk->isReady) {
+      ++iterator;
+      continue;
+    }
+
+    if (nUploadedBytes >= MAX_UPLOAD_BYTES_PER_FRAME) {
+      break;
+    }
+
+    if (node.chunk->isFailed) {
+      LOG_ERROR("Failed to read a node of " + _cacheFilePath);
+      node.isFailed = true;
+    } else {
+      const std::vector<uint8_t> &packedVertices = node.chunk->packedVertices;
+
+      node.vaoId.create();
+      GLStateCache::getInstance().bindVertexArray(node.vaoId);
+
+      node.vertexBufferId.create();
+      glBindBuffer(GL_ARRAY_BUFFER, node.vertexBufferId);
+      glBufferData(GL_ARRAY_BUFFER, packedVertices.size(), packedVertices.data(), GL_STATIC_DRAW);
+
+      node.chunk->layout.setupAttributes();
+
+      GLStateCache::getInstance().bindVertexArray(0);
+      glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+      // NOTE: The decoding scale and offset are fitted to the bounds of each node
+      node.layout = node.chunk->layout;
+      node.isResident = true;
+      node.lruIterator = _lruNodes.insert(_lruNodes.begin(), *iterator);
+
+      _nResidentPoints += node.record.nPoints;
+      nUploadedBytes += packedVertices.size();
+    }
+
+    node.chunk = nullptr;
+    iterator = _loadingNodes.erase(iterator);
+  }
+}
+
+void OctreePointCloud::evictNodes() {
+  while (_nResidentPoints > _cacheCapacity && !_lruNodes.empty()) {
+    Node &node = _nodes[_lruNodes.back()];
+
+    // NOTE: Nodes drawn in this frame are kept even if the cache is over capacity
+    if (node.lastUsedFrame == _frameIndex) {
+      break;
+    }
+
+    releaseNode(node);
+  }
+}
+
+void OctreePointCloud::releaseNode(Node &node) {
+  if (!node.isResident) {
+    return;
+  }
+
+  node.vertexBufferId.reset();
+  node.vaoId.reset();
+  node.isResident = false;
+
+  _lruNodes.erase(node.lruIterator);
+  _nResidentPoints -= node.record.nPoints;
+}
+
+// ==================================================================================================
+// Rendering
+// ==================================================================================================
+void OctreePointCloud::paintGL(
+    const TransformationContext &transCtx,  // transCtx
+    const LightingContext &lightingCtx,     // lightingCtx
+    const RenderingContext &renderingCtx    // renderingCtx
+) {
+  if (_isVisible && !_nodes.empty()) {
+    const glm::mat4 &mvtMat = transCtx.mvMat * glm::translate(_position);
+    const glm::mat4 &mvptMat = transCtx.mvpMat * glm::translate(_position);
+    const glm::mat4 &normMat = glm::transpose(glm::inverse(mvtMat));
+    const glm::mat4 &lightMvptMat = transCtx.lightMvpMat * glm::translate(_position);
+
+    paintBBOX(mvtMat, mvptMat, normMat);
+
+    ++_frameIndex;
+
+    uploadNodes();
+    selectNodes(mvptMat, mvtMat, transCtx.projMat);
+    requestNodes();
+    evictNodes();
+
+    bindShader(
+        mvtMat,                        // mvMat
+        mvptMat,                       // mvpMat
+        normMat,                       // normMat
+        transCtx.lightMat,             // lightMat
+        lightingCtx.lightPos,          // lightPos
+        lightingCtx.shininess,         // shininess
+        lightingCtx.ambientIntensity,  // ambientIntensity
+        glm::vec3(0.0f),               // ambientColor
+        glm::vec3(0.0f),               // diffuseColor
+        glm::vec3(0.0f),               // specularColor
+        getRenderType(),               // renderType
+        renderingCtx.wireFrameColor,   // wireFrameColor
+        renderingCtx.wireFrameWidth,   // wireFrameWidth
+        renderingCtx.depthTextureId,   // depthTextureId
+        lightMvptMat,                  // lightMvpMat
+        false,                         // isEnabledShadowMapping
+        false,                         // disableDepthTest
+        false                          // isEnabledNormalMap
+    );
+
+    drawGL();
+
+    unbindShader();
+  }
+}
+
+void OctreePointCloud::drawGL(const int &index) {
+  glPointSize(_pointSize);
+
+  for (const int32_t iNode : _visibleNodes) {
+    const Node &node = _nodes[iNode];
+
+    if (node.isResident) {
+      setVertexLayoutUniforms(node.layout);
+
+      GLStateCache::getInstance().bindVertexArray(node.vaoId);
+      glDrawArrays(GL_POINTS, 0, (GLsizei)node.record.nPoints);
+    }
+  }
+}
+
+void OctreePointCloud::drawAllGL(const glm::mat4 &lightMvpMat) {
+  if (_isVisible) {
+    const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
+
+    // NOTE: Draw the nodes selected for the camera in the last frame
+    for (const int32_t iNode : _visibleNodes) {
+      const Node &node = _nodes[iNode];
+
+      if (node.isResident) {
+        _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+        _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_POSITION_SCALE, node.layout.getPositionScale());
+        _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_POSITION_OFFSET, node.layout.getPositionOffset());
+
+        GLStateCache::getInstance().bindVertexArray(node.vaoId);
+        glDrawArrays(GL_POINTS, 0, (GLsizei)node.record.nPoints);
+      }
+    }
+  }
+}
+
+}  // namespace model
+}  // namespace simview
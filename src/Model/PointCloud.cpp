@@ -21,6 +21,33 @@ PointCloud::PointCloud(const std::string &filePath,
       _scale(scale),
       _pointSize(pointSize),
       _autoScale(autoScale) {
+  _vertexLayout = VertexLayout::createPointCloud();
+}
+
+bool PointCloud::loadData() {
+  VertexArray_t points = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+
+  ObjectLoader::readFromFile(_filePath, points, indices, _offsetX, _offsetY, _offsetZ, _autoScale);
+  ObjectLoader::placeObject(points, glm::vec3(_scale), glm::vec3(_offsetX, _offsetY, _offsetZ));
+
+  LOG_INFO("Loaded point cloud data with " + std::to_string(points->size()) + " points.");
+
+  return setLoadedData(points, indices);
+}
+
+float PointCloud::uploadData(const size_t maxBytes) {
+  const float progress = uploadLoadedData(_vaoId, _vertexBufferId, _indexBufferId, maxBytes);
+
+  if (progress >= 1.0f) {
+    glm::vec3 minCoords, maxCoords;
+    std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(_loadedVertices);
+    _bbox = std::make_shared<AxisAlignedBoundingBox>(minCoords, maxCoords);
+
+    clearLoadedData();
+  }
+
+  return progress;
 }
 
 void PointCloud::initVAO() {
@@ -28,9 +55,7 @@ void PointCloud::initVAO() {
   IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
 
   ObjectLoader::readFromFile(_filePath, points, indices, _offsetX, _offsetY, _offsetZ, _autoScale);
-  ObjectLoader::moveToOrigin(points);
-  ObjectLoader::scaleObject(points, _scale);
-  ObjectLoader::translateObject(points, _offsetX, _offsetY, _offsetZ);
+  ObjectLoader::placeObject(points, glm::vec3(_scale), glm::vec3(_offsetX, _offsetY, _offsetZ));
 
   LOG_INFO("Loaded point cloud data with " + std::to_string(points->size()) + " points.");
 
@@ -73,9 +98,7 @@ void PointCloud::initVAO(const std::shared_ptr<std::vector<vec3f_t>> positions,
     indices->push_back(iVertex);
   }
 
-  ObjectLoader::moveToOrigin(points);
-  ObjectLoader::scaleObject(points, _scale);
-  ObjectLoader::translateObject(points, _offsetX, _offsetY, _offsetZ);
+  ObjectLoader::placeObject(points, glm::vec3(_scale), glm::vec3(_offsetX, _offsetY, _offsetZ));
 
   LOG_INFO("Num of points : " + std::to_string(points->size()));
 
@@ -85,42 +108,27 @@ void PointCloud::initVAO(const std::shared_ptr<std::vector<vec3f_t>> positions,
 void PointCloud::initVAO(const VertexArray_t &points,
                          const IndexArray_t &indices) {
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * points->size(), points->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(points);
 
   // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, id));
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
+  _nEvictableBytes = _vertexLayout.getStride() * points->size() + sizeof(uint32_t) * indices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(points);
@@ -169,22 +177,19 @@ void PointCloud::paintGL(
 
 void PointCloud::drawGL(const int &index) {
   // Enable VAO
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   glPointSize(_pointSize);
 
   // Draw triangles
   // (GLenum mode, GLsizei count, GLenum type, const void *indices)
   glDrawElements(GL_POINTS, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  // Disable VAO
-  glBindVertexArray(0);
 }
 
 void PointCloud::drawAllGL(const glm::mat4 &lightMvpMat) {
   if (_isVisible) {
     const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+    setDepthShaderUniforms(lightMvptMat);
 
     drawGL();
   }
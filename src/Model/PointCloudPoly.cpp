@@ -13,7 +13,8 @@ PointCloudPoly::PointCloudPoly(const std::string &filePath,  // filePath
                                const float scale,            // scale
                                const float pointSize,        // pointSize
                                const bool isDoubled,         // isDoubled
-                               const bool autoScale          // autoScale
+                               const bool autoScale,         // autoScale
+                               const RenderMode renderMode   // renderMode
                                )
     : Primitive(),
       _filePath(filePath),
@@ -23,87 +24,167 @@ PointCloudPoly::PointCloudPoly(const std::string &filePath,  // filePath
       _scale(scale),
       _pointSize(pointSize),
       _isDoubled(isDoubled),
-      _autoScale(autoScale) {
+      _autoScale(autoScale),
+      _renderMode(renderMode),
+      _nSpheres(0),
+      _impostorShader(nullptr),
+      _impostorDepthShader(nullptr) {
+  if (_renderMode == RenderMode::IMPOSTOR) {
+    _vertexLayout = VertexLayout::createSphereImpostor();
+  } else {
+    _vertexLayout = VertexLayout()
+                        .add(VertexAttribute::POSITION, VertexEncoding::FLOAT32)
+                        .add(VertexAttribute::COLOR, VertexEncoding::UNORM8)
+                        .add(VertexAttribute::NORMAL, VertexEncoding::OCT_SNORM16);
+  }
 }
 
 void PointCloudPoly::initVAO() {
-  VertexArray_t points = std::make_shared<std::vector<Vertex>>();
+  VertexArray_t spheres = std::make_shared<std::vector<Vertex>>();
   IndexArray_t pointsIndices = std::make_shared<std::vector<uint32_t>>();
 
-  ObjectLoader::readFromFile(_filePath, points, pointsIndices, _offsetX, _offsetY, _offsetZ, _autoScale);
-  ObjectLoader::moveToOrigin(points);
-  ObjectLoader::scaleObject(points, _scale);
-  ObjectLoader::translateObject(points, _offsetX, _offsetY, _offsetZ);
-
-  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
-  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
-
-  int index = 0;
+  ObjectLoader::readFromFile(_filePath, spheres, pointsIndices, _offsetX, _offsetY, _offsetZ, _autoScale);
+  ObjectLoader::placeObject(spheres, glm::vec3(_scale), glm::vec3(_offsetX, _offsetY, _offsetZ));
 
-  vertices->resize((NUM_DIVISIONS - 1) * (2 * NUM_DIVISIONS - 1) * 6 * (int)points->size());
-  indices->resize((NUM_DIVISIONS - 1) * (2 * NUM_DIVISIONS - 1) * 6 * (int)points->size());
+  // NOTE: The radius of each sphere is kept in 'Vertex::id'
+  for (auto &sphere : *spheres) {
+    sphere.id = _pointSize;
+  }
 
-  VertexArray_t primitiveVertices = std::make_shared<std::vector<Vertex>>();
-  IndexArray_t primitiveIndices = std::make_shared<std::vector<uint32_t>>();
-  {
-    Sphere::createSphere(NUM_DIVISIONS, primitiveVertices, primitiveIndices, _isDoubled);
-    ObjectLoader::moveToOrigin(primitiveVertices);
-    ObjectLoader::scaleObject(primitiveVertices, _pointSize);
+  if (_renderMode == RenderMode::IMPOSTOR) {
+    initImpostorVAO(spheres);
+  } else {
+    initMeshVAO(spheres);
   }
+}
+
+void PointCloudPoly::initVAO(const std::shared_ptr<std::vector<vec3f_t>> positions,
+                             const std::shared_ptr<std::vector<vec3f_t>> colors,
+                             const std::shared_ptr<std::vector<float>> radii) {
+  VertexArray_t spheres = std::make_shared<std::vector<Vertex>>(positions->size());
 
-  for (int iPoint = 0; iPoint < (int)points->size(); ++iPoint) {
-    const Vertex point = (*points)[iPoint];
+  const int64_t nSpheres = (int64_t)positions->size();
 
-    VertexArray_t iVertices = std::make_shared<std::vector<Vertex>>(*primitiveVertices);
-    IndexArray_t iIndices = std::make_shared<std::vector<uint32_t>>(*primitiveIndices);
+  parallelFor(0, nSpheres, [&](const int64_t iSphere) {
+    Vertex &sphere = (*spheres)[iSphere];
 
-    ObjectLoader::translateObject(iVertices, point.position[0], point.position[1], point.position[2]);
+    sphere.position = glm::vec3((*positions)[iSphere][0],
+                                (*positions)[iSphere][1],
+                                (*positions)[iSphere][2]);
 
-    for (int iVertex = 0; iVertex < (int)iVertices->size(); ++iVertex) {
-      (*vertices)[index + iVertex] = (*iVertices)[iVertex];
-      (*indices)[index + iVertex] = index + (*iIndices)[iVertex];
+    sphere.color = glm::vec3(0.0f);
+    if (colors != nullptr) {
+      sphere.color = glm::vec3((*colors)[iSphere][0],
+                               (*colors)[iSphere][1],
+                               (*colors)[iSphere][2]);
     }
 
-    index += (int)iVertices->size();
+    sphere.normal = glm::vec3(0.0f);
+    sphere.bary = glm::vec3(0.0f);
+    sphere.uv = glm::vec2(0.0f);
+
+    // NOTE: Radii are scaled together with the positions
+    sphere.id = radii != nullptr ? (*radii)[iSphere] * _scale : _pointSize;
+  });
+
+  ObjectLoader::placeObject(spheres, glm::vec3(_scale), glm::vec3(_offsetX, _offsetY, _offsetZ));
+
+  LOG_INFO("Num of spheres : " + std::to_string(spheres->size()));
+
+  if (_renderMode == RenderMode::IMPOSTOR) {
+    initImpostorVAO(spheres);
+  } else {
+    initMeshVAO(spheres);
+  }
+}
+
+void PointCloudPoly::initImpostorVAO(const VertexArray_t &spheres) {
+  if (_impostorShader == nullptr) {
+    _impostorShader = std::make_shared<ModelShader>(DefaultSphereImpostorShader::VERT_SHADER,
+                                                    DefaultSphereImpostorShader::FRAG_SHADER);
+    _impostorDepthShader = std::make_shared<DepthShader>(DefaultSphereImpostorShader::VERT_SHADER,
+                                                         DefaultSphereImpostorShader::DEPTH_FRAG_SHADER);
   }
 
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(spheres);
 
-  // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
+  // Setup attributes for vertex buffer object. One sphere per instance.
+  _vertexLayout.setupAttributes(1);
+
+  _nSpheres = (int)spheres->size();
+
+  // Temporarily disable VAO
+  GLStateCache::getInstance().bindVertexArray(0);
+
+  float maxRadius = 0.0f;
+  for (const auto &sphere : *spheres) {
+    maxRadius = std::max(maxRadius, sphere.id);
+  }
+
+  glm::vec3 minCoords, maxCoords;
+  std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(spheres);
+  _bbox = std::make_shared<AxisAlignedBoundingBox>(minCoords - maxRadius, maxCoords + maxRadius);
+}
 
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
+void PointCloudPoly::initMeshVAO(const VertexArray_t &spheres) {
+  VertexArray_t primitiveVertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t primitiveIndices = std::make_shared<std::vector<uint32_t>>();
+  Sphere::createSphere(NUM_DIVISIONS, primitiveVertices, primitiveIndices, _isDoubled);
+
+  const int64_t nSpheres = (int64_t)spheres->size();
+  const int64_t nPrimitiveVertices = (int64_t)primitiveVertices->size();
+  const int64_t nPrimitiveIndices = (int64_t)primitiveIndices->size();
+
+  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>(nSpheres * nPrimitiveVertices);
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>(nSpheres * nPrimitiveIndices);
+
+  // NOTE: Each sphere is written in place. The unit sphere keeps its normals under the scaling and translation.
+  parallelFor(0, nSpheres, [&](const int64_t iSphere) {
+    const Vertex &sphere = (*spheres)[iSphere];
+    const int64_t vertexHead = iSphere * nPrimitiveVertices;
+    const int64_t indexHead = iSphere * nPrimitiveIndices;
+
+    for (int64_t iVertex = 0; iVertex < nPrimitiveVertices; ++iVertex) {
+      Vertex vertex = (*primitiveVertices)[iVertex];
+      vertex.position = sphere.position + sphere.id * vertex.position;
+      vertex.color = sphere.color;
+      (*vertices)[vertexHead + iVertex] = vertex;
+    }
 
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, normal));
+    for (int64_t iIndex = 0; iIndex < nPrimitiveIndices; ++iIndex) {
+      (*indices)[indexHead + iIndex] = (uint32_t)vertexHead + (*primitiveIndices)[iIndex];
+    }
+  });
 
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, bary));
+  // Create VAO
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, uv));
+  // Create vertex buffer object
+  _vertexBufferId.create();
+  glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+  _vertexLayout.upload(vertices);
 
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, id));
+  // Setup attributes for vertex buffer object
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
+  _nSpheres = (int)nSpheres;
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(vertices);
@@ -128,6 +209,12 @@ void PointCloudPoly::paintGL(
     paintBBOX(mvtMat, mvptMat, normMat);
 
     if (_wireFrameMode != WireFrameMode::ONLY) {
+      // NOTE: 'bindShader' transfers the uniform variables to '_shader', so the impostor program is swapped in for this draw
+      const ModelShader_t modelShader = _shader;
+      if (_renderMode == RenderMode::IMPOSTOR) {
+        _shader = _impostorShader;
+      }
+
       bindShader(
           mvtMat,                        // mvMat
           mvptMat,                       // mvpMat
@@ -149,32 +236,53 @@ void PointCloudPoly::paintGL(
           false                          // isEnabledNormalMap
       );
 
+      if (_renderMode == RenderMode::IMPOSTOR) {
+        _shader->setUniformVariable(DefaultSphereImpostorShader::UNIFORM_NAME_INV_MVP_MAT, glm::inverse(mvptMat));
+      }
+
       drawGL();
 
       unbindShader();
+
+      _shader = modelShader;
     }
   }
 }
 
 void PointCloudPoly::drawGL(const int &index) {
   // Enable VAO
-  glBindVertexArray(_vaoId);
-
-  // Draw triangles
-  glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  // Disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
+
+  if (_renderMode == RenderMode::IMPOSTOR) {
+    // Draw a quad per sphere
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, _nSpheres);
+  } else {
+    // Draw triangles
+    glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
+  }
 }
 
 void PointCloudPoly::drawAllGL(const glm::mat4 &lightMvpMat) {
   if (_isVisible) {
     const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
 
-    drawGL();
+    if (_renderMode == RenderMode::IMPOSTOR) {
+      // NOTE: Spheres are ray-cast from the light, so that their shadows are round
+      _impostorDepthShader->bind();
+      _impostorDepthShader->setUniformVariable(DefaultSphereImpostorShader::UNIFORM_NAME_MVP_MAT, lightMvptMat);
+      _impostorDepthShader->setUniformVariable(DefaultSphereImpostorShader::UNIFORM_NAME_INV_MVP_MAT, glm::inverse(lightMvptMat));
+
+      drawGL();
+
+      // NOTE: The other objects draw with the depth shader bound by the model
+      _depthShader->bind();
+    } else {
+      setDepthShaderUniforms(lightMvptMat);
+
+      drawGL();
+    }
   }
 }
 
 }  // namespace model
-}  // namespace simview
\ No newline at end of file
+}  // namespace simview
@@ -0,0 +1,82 @@
+#include <SimView/Model/ResidencyManager.hpp>
+
+namespace simview {
+namespace model {
+
+ResidencyManager::ResidencyManager()
+    : _budgetBytes(DEFAULT_BUDGET_BYTES),
+      _nResidentBytes(0),
+      _nEvictedBytes(0),
+      _nEvictedObjects(0),
+      _candidates() {
+}
+
+void ResidencyManager::use(Primitive& object) {
+  if (!object.getIsVisible()) {
+    return;
+  }
+
+  object.setLastUsedTime(std::chrono::steady_clock::now());
+
+  if (object.getIsEvicted()) {
+    object.restoreBuffers();
+  }
+}
+
+void ResidencyManager::endFrame(const std::vector<Primitive_t>& objects) {
+  _nResidentBytes = 0;
+  _nEvictedBytes = 0;
+  _nEvictedObjects = 0;
+  _candidates.clear();
+
+  const auto idleSince = std::chrono::steady_clock::now() - MIN_IDLE_DURATION;
+
+  for (const auto& object : objects) {
+    const size_t nBytes = object->getEvictableBytes();
+    if (nBytes == 0) {
+      continue;
+    }
+
+    if (object->getIsEvicted()) {
+      _nEvictedBytes += nBytes;
+      ++_nEvictedObjects;
+      continue;
+    }
+
+    _nResidentBytes += nBytes;
+
+    if (!object->getIsVisible() || object->getLastUsedTime() <= idleSince) {
+      _candidates.push_back(object.get());
+    }
+  }
+
+  if (_budgetBytes > 0 && _nResidentBytes > _budgetBytes) {
+    const size_t targetBytes = (size_t)(EVICTION_TARGET_RATIO * (double)_budgetBytes);
+
+    // NOTE: Hidden objects first, then the least recently drawn ones
+    std::sort(_candidates.begin(), _candidates.end(), [](const Primitive* object0, const Primitive* object1) {
+      if (object0->getIsVisible() != object1->getIsVisible()) {
+        return !object0->getIsVisible();
+      }
+      return object0->getLastUsedTime() < object1->getLastUsedTime();
+    });
+
+    for (Primitive* object : _candidates) {
+      if (_nResidentBytes <= targetBytes) {
+        break;
+      }
+
+      if (object->evictBuffers()) {
+        const size_t nBytes = object->getEvictableBytes();
+        _nResidentBytes -= nBytes;
+        _nEvictedBytes += nBytes;
+        ++_nEvictedObjects;
+
+        LOG_INFO("[Residency] Evicted " + object->getName() + " (" + std::to_string(nBytes / 1024) + " KiB)");
+      }
+    }
+  }
+}
+
+}  // namespace model
+}  // namespace simview
@@ -23,7 +23,10 @@ Sphere::Sphere(const int nDivs,       // nDivs
       _scaleX(scaleX),
       _scaleY(scaleY),
       _scaleZ(scaleZ),
-      _color(color) {
+      _color(color),
+      _vaoId(),
+      _vertexBufferId(),
+      _indexBufferId() {
 }
 
 Sphere::~Sphere() = default;
@@ -34,47 +37,31 @@ void Sphere::initVAO() {
 
   createSphere(_nDivs, _color, vertices, indices);
 
-  ObjectLoader::moveToOrigin(vertices);
-  ObjectLoader::scaleObject(vertices, _scaleX / 2.0f, _scaleY / 2.0f, _scaleZ / 2.0f);
-  ObjectLoader::translateObject(vertices, _offsetX, _offsetY, _offsetZ);
+  ObjectLoader::placeObject(vertices, glm::vec3(_scaleX, _scaleY, _scaleZ) / 2.0f, glm::vec3(_offsetX, _offsetY, _offsetZ));
 
-  // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  if (!allocateBatchedBuffers(vertices, indices)) {
+    // Create VAO
+    _vaoId.create();
+    GLStateCache::getInstance().bindVertexArray(_vaoId);
 
-  // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
-  glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+    // Create vertex buffer object
+    _vertexBufferId.create();
+    glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+    _vertexLayout.upload(vertices);
 
-  // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
+    // Setup attributes for vertex buffer object
+    _vertexLayout.setupAttributes();
 
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
+    // Create index buffer object
+    _indexBufferId.create();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, normal));
+    _indexBufferSize = (int)indices->size();
 
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, id));
-
-  // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
-
-  _indexBufferSize = (int)indices->size();
-
-  // Temporarily disable VAO
-  glBindVertexArray(0);
+    // Temporarily disable VAO
+    GLStateCache::getInstance().bindVertexArray(0);
+  }
 
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(vertices);
@@ -98,7 +85,7 @@ void Sphere::paintGL(
 
     paintBBOX(mvtMat, mvptMat, normMat);
 
-    if (_wireFrameMode != WireFrameMode::ONLY) {
+    if (_wireFrameMode != WireFrameMode::ONLY && !addToBatch(0, false)) {
       bindShader(
           mvtMat,                        // mvMat
           mvptMat,                       // mvpMat
@@ -128,20 +115,22 @@ void Sphere::paintGL(
 }
 
 void Sphere::drawGL(const int &index) {
+  if (isBatched()) {
+    drawBatchedBuffers();
+    return;
+  }
+
   // Enable VAO
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Draw triangles
   glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  // Disable VAO
-  glBindVertexArray(0);
 }
 
 void Sphere::drawAllGL(const glm::mat4 &lightMvpMat) {
-  if (_isVisible) {
+  if (_isVisible && !addShadowCasterToBatch()) {
     const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+    setDepthShaderUniforms(lightMvptMat);
 
     drawGL();
   }
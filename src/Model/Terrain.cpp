@@ -45,8 +45,9 @@ void Terrain::initVAO() {
   vertices->resize((height - 1) * (width - 1) * 6);
   indices->resize((height - 1) * (width - 1) * 6);
 
-#pragma omp parallel for
-  for (int h_texture = 0; h_texture < height - 1; h_texture++) {
+  parallelFor(0, height - 1, [&](const int64_t iRow) {
+    const int h_texture = (int)iRow;
+
     for (int w_texture = 0; w_texture < width - 1; w_texture++) {
       const int index = 6 * (h_texture * (width - 1) + w_texture);
 
@@ -83,51 +84,33 @@ void Terrain::initVAO() {
         (*indices)[index + i_vert + 3] = index + i_vert + 3;
       }
     }
-  }
+  });
 
   LOG_INFO("### Initialized terrain with " + std::to_string(vertices->size() / 3) + " polygons");
 
-  ObjectLoader::moveToOrigin(vertices);
-  ObjectLoader::scaleObject(vertices, _scaleX, _scaleH, _scaleY);
-  ObjectLoader::translateObject(vertices, _offsetX, _offsetY, _offsetZ);
+  ObjectLoader::placeObject(vertices, glm::vec3(_scaleX, _scaleH, _scaleY), glm::vec3(_offsetX, _offsetY, _offsetZ));
 
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), GL_STATIC_DRAW);
+  _vertexLayout.upload(vertices);
 
   // Setup attributes for vertex buffer object
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, normal));
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, bary));
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, uv));
-
-  glEnableVertexAttribArray(5);
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, id));
+  _vertexLayout.setupAttributes();
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * indices->size(), indices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)indices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(vertices);
@@ -187,19 +170,16 @@ void Terrain::paintGL(
 
 void Terrain::drawGL(const int &index) {
   // Enable VAO
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Draw triangles
   glDrawElements(GL_TRIANGLES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  // Disable VAO
-  glBindVertexArray(0);
 }
 
 void Terrain::drawAllGL(const glm::mat4 &lightMvpMat) {
   if (_isVisible) {
     const glm::mat4 &lightMvptMat = lightMvpMat * glm::translate(_position);
-    _depthShader->setUniformVariable(DefaultDepthShader::UNIFORM_NAME_LIGHT_MVP_MAT, lightMvptMat);
+    setDepthShaderUniforms(lightMvptMat);
 
     drawGL();
   }
@@ -65,8 +65,22 @@ void ViewerModel::paintGL(
   const int &nObjects = getNumObjects();
   for (int iModel = 0; iModel < nObjects; ++iModel) {
     getObject(iModel)->update();
-    getObject(iModel)->paintGL(transCtx, lightingCtx, renderingCtx);
   }
+
+  // NOTE: Objects are culled after their update, since it may move them
+  cullObjects(transCtx.mvpMat, _nDrawnObjects, _nCulledObjects);
+
+  for (int iModel = 0; iModel < nObjects; ++iModel) {
+    if (_isObjectDrawn[iModel]) {
+      _residencyManager.use(*getObject(iModel));
+      getObject(iModel)->paintGL(transCtx, lightingCtx, renderingCtx);
+    }
+  }
+
+  // NOTE: Objects in the buffer arenas were added to the batch instead of drawn
+  _drawBatcher->paintGL(transCtx, lightingCtx, renderingCtx);
+
+  _residencyManager.endFrame(*_objects);
 }
 
 void ViewerModel::setAxesConeState(const bool &isShown) {
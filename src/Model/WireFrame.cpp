@@ -16,40 +16,48 @@ WireFrame::WireFrame(const VertexArray_t& vertices, const IndexArray_t& indices)
 WireFrame::~WireFrame() = default;
 
 void WireFrame::initVAO(const VertexArray_t& vertices, const IndexArray_t& indices) {
+  // NOTE: Line vertices correspond to the mesh vertices one by one, so that an indexed mesh shares its vertices here too.
   auto lineVertices = std::make_shared<std::vector<LineVertex>>();
   IndexArray_t lineIndices = std::make_shared<std::vector<uint32_t>>();
-  int idx = 0;
 
+  const size_t nVertices = vertices->size();
+  lineVertices->resize(nVertices);
+
+  for (size_t iVertex = 0ULL; iVertex < nVertices; ++iVertex) {
+    (*lineVertices)[iVertex] = LineVertex((*vertices)[iVertex].position);
+  }
+
+  // Collect edges. An edge shared by two triangles is drawn once.
   const size_t nTriangles = indices->size() / 3ULL;
+  std::vector<uint64_t> edges(3ULL * nTriangles);
+
   for (size_t iTriangle = 0ULL; iTriangle < nTriangles; ++iTriangle) {
     const size_t offset = 3ULL * iTriangle;
 
-    const LineVertex vertex0((*vertices)[(*indices)[offset + 0]].position);
-    const LineVertex vertex1((*vertices)[(*indices)[offset + 1]].position);
-    const LineVertex vertex2((*vertices)[(*indices)[offset + 2]].position);
+    for (size_t iEdge = 0ULL; iEdge < 3ULL; ++iEdge) {
+      const uint32_t index0 = (*indices)[offset + iEdge];
+      const uint32_t index1 = (*indices)[offset + (iEdge + 1ULL) % 3ULL];
 
-    lineVertices->push_back(vertex0);
-    lineVertices->push_back(vertex1);
-    lineVertices->push_back(vertex2);
-
-    lineIndices->push_back(idx + 0);
-    lineIndices->push_back(idx + 1);
+      edges[offset + iEdge] = ((uint64_t)std::min(index0, index1) << 32) | (uint64_t)std::max(index0, index1);
+    }
+  }
 
-    lineIndices->push_back(idx + 1);
-    lineIndices->push_back(idx + 2);
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-    lineIndices->push_back(idx + 2);
-    lineIndices->push_back(idx + 0);
+  lineIndices->resize(2ULL * edges.size());
 
-    idx += 3;
+  for (size_t iEdge = 0ULL; iEdge < edges.size(); ++iEdge) {
+    (*lineIndices)[2ULL * iEdge + 0ULL] = (uint32_t)(edges[iEdge] >> 32);
+    (*lineIndices)[2ULL * iEdge + 1ULL] = (uint32_t)(edges[iEdge] & 0xFFFFFFFFULL);
   }
 
   // Create VAO
-  glGenVertexArrays(1, &_vaoId);
-  glBindVertexArray(_vaoId);
+  _vaoId.create();
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
   // Create vertex buffer object
-  glGenBuffers(1, &_vertexBufferId);
+  _vertexBufferId.create();
   glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
   glBufferData(GL_ARRAY_BUFFER, sizeof(LineVertex) * lineVertices->size(), lineVertices->data(), GL_STATIC_DRAW);
 
@@ -58,30 +66,25 @@ void WireFrame::initVAO(const VertexArray_t& vertices, const IndexArray_t& indic
   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(LineVertex), (void*)offsetof(LineVertex, position));
 
   // Create index buffer object
-  glGenBuffers(1, &_indexBufferId);
+  _indexBufferId.create();
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * lineIndices->size(), lineIndices->data(), GL_STATIC_DRAW);
 
   _indexBufferSize = (int)lineIndices->size();
 
   // Temporarily disable VAO
-  glBindVertexArray(0);
+  GLStateCache::getInstance().bindVertexArray(0);
 }
 
 void WireFrame::draw(const float& lineWidth) const {
-  glBindVertexArray(_vaoId);
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
 
-  glEnable(GL_LINE_SMOOTH);
-  glEnable(GL_BLEND);
+  GLStateCache::getInstance().enable(GL_LINE_SMOOTH);
+  GLStateCache::getInstance().enable(GL_BLEND);
 
   glLineWidth(lineWidth);
 
   glDrawElements(GL_LINES, _indexBufferSize, GL_UNSIGNED_INT, 0);
-
-  glDisable(GL_LINE_SMOOTH);
-  glDisable(GL_BLEND);
-
-  glBindVertexArray(0);
 }
 
 }  // namespace model
@@ -4,6 +4,7 @@ namespace simview {
 namespace renderer {
 
 using namespace shader;
+using namespace util;
 
 DepthRenderer::DepthRenderer(DepthShader_t shader) : _shader(shader) {
   initDepthMap();
@@ -22,10 +23,10 @@ void DepthRenderer::unbind() {
 }
 
 void DepthRenderer::initDepthMap() {
-  glGenFramebuffers(1, &_depthMapFBO);
+  _depthMapFBO.create();
 
-  glGenTextures(1, &_depthMap);
-  glBindTexture(GL_TEXTURE_2D, _depthMap);
+  _depthMap.create();
+  GLStateCache::getInstance().bindTexture2D(_depthMap);
   glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT16, DEPTH_MAP_WIDTH, DEPTH_MAP_HEIGHT, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -3,75 +3,74 @@
 namespace simview {
 namespace renderer {
 
-FrameBuffer::FrameBuffer(const float width, const float height) {
-  glGenFramebuffers(1, &_fbo);
-  glBindFramebuffer(GL_FRAMEBUFFER, _fbo);
-
-  glGenTextures(1, &_texture);
-  glBindTexture(GL_TEXTURE_2D, _texture);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-#ifdef USE_MIP_MAP
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-  glGenerateMipmap(GL_TEXTURE_2D);
-#else
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-#endif
-  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
-  glGenRenderbuffers(1, &_rbo);
-  glBindRenderbuffer(GL_RENDERBUFFER, _rbo);
-  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
-  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _rbo);
-
-  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-    LOG_ERROR("ERROR::FRAMEBUFFER:: Framebuffer is not complete!");
-  }
+using namespace util;
 
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
-  glBindTexture(GL_TEXTURE_2D, 0);
-  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+FrameBuffer::FrameBuffer(const float width, const float height, const int nSamples)
+    : _width(std::max((int)width, 1)),
+      _height(std::max((int)height, 1)),
+      _nSamples(nSamples),
+      _target(RenderTargetPool::getInstance().acquire(_width, _height, nSamples)) {
 }
 
-FrameBuffer::~FrameBuffer() {}
+FrameBuffer::~FrameBuffer() {
+  RenderTargetPool::getInstance().release(_target);
+}
 
 unsigned int FrameBuffer::getFrameTexture() {
-  return _texture;
+  return _target->texture;
 }
 
 void FrameBuffer::rescaleFrameBuffer(const float width, const float height) {
-  bind();
-
-  glBindTexture(GL_TEXTURE_2D, _texture);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-#ifdef USE_MIP_MAP
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-  glGenerateMipmap(GL_TEXTURE_2D);
-#else
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-#endif
-  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
-
-  glBindRenderbuffer(GL_RENDERBUFFER, _rbo);
-  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
-  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _rbo);
-
-  glBindTexture(GL_TEXTURE_2D, 0);
-  glBindRenderbuffer(GL_RENDERBUFFER, 0);
-
-  unbind();
+  const int newWidth = std::max((int)width, 1);
+  const int newHeight = std::max((int)height, 1);
+
+  if (newWidth == _width && newHeight == _height) {
+    return;
+  }
+
+  _width = newWidth;
+  _height = newHeight;
+
+  // NOTE: Kept during live window drags unless the size outgrows the target
+  if (RenderTargetPool::fits(*_target, _width, _height)) {
+    return;
+  }
+
+  RenderTargetPool& pool = RenderTargetPool::getInstance();
+  pool.release(_target);
+  _target = pool.acquire(_width, _height, _nSamples);
 }
 
 void FrameBuffer::bind() const {
-  glBindFramebuffer(GL_FRAMEBUFFER, _fbo);
+  glBindFramebuffer(GL_FRAMEBUFFER, _target->fbo);
 }
 
 void FrameBuffer::unbind() const {
   glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+void FrameBuffer::resolve() const {
+  if (_target->nSamples <= 1) {
+    return;
+  }
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, _target->fbo);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _target->resolveFbo);
+  glBlitFramebuffer(0, 0, _width, _height, 0, 0, _width, _height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void FrameBuffer::readPixels(unsigned char *bytes) const {
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, _target->getResolvedFbo());
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glReadPixels(0, 0, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, bytes);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+}
+
+glm::vec2 FrameBuffer::getUVMax() const {
+  return glm::vec2((float)_width / (float)_target->width, (float)_height / (float)_target->height);
+}
+
 void FrameBuffer::setPixelValue(const int &x,
                                 const int &y,
                                 const uint8_t &&r,
@@ -80,11 +79,9 @@ void FrameBuffer::setPixelValue(const int &x,
                                 const uint8_t &&a) {
   const GLubyte pixel[4] = {r, g, b, a};
 
-  bind();
-  {
-    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
-  }
-  unbind();
+  GLStateCache::getInstance().bindTexture2D(_target->texture);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+  GLStateCache::getInstance().bindTexture2D(0);
 }
 
 }  // namespace renderer
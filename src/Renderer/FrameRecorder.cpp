@@ -0,0 +1,292 @@
+#include <SimView/Renderer/FrameRecorder.hpp>
+
+namespace simview {
+namespace renderer {
+
+using namespace util;
+
+FrameRecorder::FrameRecorder(TaskScheduler& scheduler)
+    : _screenCapture(scheduler),
+      _scheduler(scheduler),
+      _session(nullptr),
+      _nRenderedFrames(0),
+      _nCapturedFrames(0),
+      _isSizeWarned(false),
+      _threads(),
+      _jobs(),
+      _jobMutex(),
+      _jobCondition(),
+      _isStopped(false),
+      _nFramesInFlight(0),
+      _nWrittenFrames(0),
+      _nFailedFrames(0) {
+  // NOTE: Encoding is mostly serial per frame, so frames are encoded concurrently. The rest of the cores are left to the scheduler.
+  const size_t nThreads = std::min(MAX_ENCODER_THREADS, std::max<size_t>(1, std::thread::hardware_concurrency() / 2));
+
+  for (size_t iThread = 0; iThread < nThreads; ++iThread) {
+    _threads.emplace_back([this]() { encoderLoop(); });
+  }
+}
+
+FrameRecorder::~FrameRecorder() {
+  stop();
+
+  {
+    std::lock_guard<std::mutex> lock(_jobMutex);
+    _isStopped = true;
+  }
+
+  _jobCondition.notify_all();
+
+  // NOTE: Encoders write the remaining frames before they exit
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+bool FrameRecorder::start(const Settings& settings, const int width, const int height) {
+  if (isRecording()) {
+    stop();
+  }
+
+  auto session = std::make_shared<Session>();
+  session->settings = settings;
+  session->settings.frameStep = std::max(settings.frameStep, 1);
+  session->settings.frameRate = std::max(settings.frameRate, 1);
+  session->width = width;
+  session->height = height;
+
+  if (settings.format == Format::Y4M) {
+    try {
+      const std::string dirPath = FileUtil::dirPath(settings.outputPath);
+      if (!dirPath.empty() && !FileUtil::exists(dirPath)) {
+        FileUtil::mkdirs(dirPath);
+      }
+    } catch (std::exception& error) {
+      LOG_ERROR(error.what());
+    }
+
+    session->stream.open(settings.outputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!session->stream.is_open()) {
+      LOG_ERROR("Failed to open " + settings.outputPath);
+      return false;
+    }
+
+    // NOTE: 'C420jpeg' is full range BT.601 with centered chroma samples
+    session->stream << "YUV4MPEG2 W" << width << " H" << height << " F" << session->settings.frameRate << ":1 Ip A1:1 C420jpeg\n";
+  }
+
+  _session = session;
+  _nRenderedFrames = 0;
+  _nCapturedFrames = 0;
+  _isSizeWarned = false;
+  _nWrittenFrames = 0;
+  _nFailedFrames = 0;
+
+  LOG_INFO("Start recording to " + settings.outputPath);
+
+  return true;
+}
+
+void FrameRecorder::stop() {
+  if (!isRecording()) {
+    return;
+  }
+
+  LOG_INFO("Stop recording to " + _session->settings.outputPath + " (" + std::to_string(_nCapturedFrames) + " frames)");
+
+  // NOTE: The frames in flight keep the session until they are written
+  _session = nullptr;
+}
+
+bool FrameRecorder::isReady() const {
+  return _nFramesInFlight < MAX_FRAMES_IN_FLIGHT && !_screenCapture.isFull();
+}
+
+void FrameRecorder::record(const FrameBuffer& frameBuffer) {
+  if (!isRecording()) {
+    return;
+  }
+
+  const int iRenderedFrame = _nRenderedFrames++;
+  if (iRenderedFrame % _session->settings.frameStep != 0) {
+    return;
+  }
+
+  if (_session->settings.format == Format::Y4M &&
+      (frameBuffer.getWidth() != _session->width || frameBuffer.getHeight() != _session->height)) {
+    // NOTE: The size of a Y4M stream is fixed by its header
+    if (!_isSizeWarned) {
+      LOG_WARN("Frames are skipped while the scene size differs from the start of the recording.");
+      _isSizeWarned = true;
+    }
+    return;
+  }
+
+  const int iFrame = _nCapturedFrames++;
+  ++_nFramesInFlight;
+
+  _screenCapture.capture(frameBuffer, [this, session = _session, iFrame](const CapturedFrame& frame) {
+    EncodeJob job;
+    job.session = session;
+    job.iFrame = iFrame;
+    job.frame = frame;
+
+    {
+      std::lock_guard<std::mutex> lock(_jobMutex);
+      _jobs.push_back(std::move(job));
+    }
+
+    _jobCondition.notify_one();
+  });
+}
+
+void FrameRecorder::update() {
+  _screenCapture.update();
+}
+
+void FrameRecorder::encoderLoop() {
+  while (true) {
+    EncodeJob job;
+
+    {
+      std::unique_lock<std::mutex> lock(_jobMutex);
+      _jobCondition.wait(lock, [this]() { return _isStopped || !_jobs.empty(); });
+
+      if (_jobs.empty()) {
+        return;
+      }
+
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+
+    encode(job);
+
+    // NOTE: Released before the count, so that the memory is bounded by 'MAX_FRAMES_IN_FLIGHT'
+    job = EncodeJob();
+    --_nFramesInFlight;
+  }
+}
+
+void FrameRecorder::encode(EncodeJob& job) {
+  Session& session = *job.session;
+  bool isWritten = false;
+
+  if (session.settings.format == Format::Y4M) {
+    std::vector<unsigned char> yuvBytes;
+    bool isConverted = false;
+
+    if (job.frame.bytes != nullptr) {
+      try {
+        convertToYUV420(job.frame, yuvBytes, _scheduler);
+        isConverted = true;
+      } catch (std::exception& error) {
+        LOG_ERROR(error.what());
+      }
+    }
+
+    // NOTE: Also for failed frames, so that the following frames are not blocked
+    isWritten = writeY4MFrame(session, job.iFrame, isConverted ? &yuvBytes : nullptr);
+  } else if (job.frame.bytes != nullptr) {
+    ScreenCapture::flipRows(job.frame, _scheduler);
+
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), FRAME_FILE_NAME_FORMAT, job.iFrame);
+    const std::string extension = session.settings.format == Format::PNG ? ".png" : ".jpg";
+    const std::string filePath = FileUtil::join(session.settings.outputPath, fileName + extension);
+
+    isWritten = stb::saveImage(job.frame.width, job.frame.height, 4, job.frame.bytes.get(), filePath);
+  }
+
+  if (isWritten) {
+    ++_nWrittenFrames;
+  } else {
+    LOG_ERROR("Failed to record frame " + std::to_string(job.iFrame) + " to " + session.settings.outputPath);
+    ++_nFailedFrames;
+  }
+}
+
+bool FrameRecorder::writeY4MFrame(Session& session, const int iFrame, const std::vector<unsigned char>* yuvBytes) {
+  std::unique_lock<std::mutex> lock(session.writeMutex);
+
+  // NOTE: Jobs are taken in the order of the frames, so the preceding frames are already taken by other encoders,
+  //       which wait only for frames before them. The wait therefore always ends.
+  session.writeCondition.wait(lock, [&]() { return session.iNextWrittenFrame == iFrame; });
+
+  bool isWritten = false;
+
+  if (yuvBytes != nullptr) {
+    session.stream << "FRAME\n";
+    session.stream.write(reinterpret_cast<const char*>(yuvBytes->data()), yuvBytes->size());
+    isWritten = session.stream.good();
+  }
+
+  ++session.iNextWrittenFrame;
+
+  lock.unlock();
+  session.writeCondition.notify_all();
+
+  return isWritten;
+}
+
+void FrameRecorder::convertToYUV420(const CapturedFrame& frame, std::vector<unsigned char>& yuvBytes, TaskScheduler& scheduler) {
+  const int width = frame.width;
+  const int height = frame.height;
+  const int chromaWidth = (width + 1) / 2;
+  const int chromaHeight = (height + 1) / 2;
+
+  yuvBytes.resize((size_t)width * height + 2 * (size_t)chromaWidth * chromaHeight);
+
+  unsigned char* yPlane = yuvBytes.data();
+  unsigned char* uPlane = yPlane + (size_t)width * height;
+  unsigned char* vPlane = uPlane + (size_t)chromaWidth * chromaHeight;
+  const unsigned char* rgbaBytes = frame.bytes.get();
+
+  const auto toByte = [](const float value) { return (unsigned char)std::clamp(value + 0.5f, 0.0f, 255.0f); };
+
+  // NOTE: One pair of rows per iteration, which shares a row of chroma samples
+  parallelFor(
+      0,
+      chromaHeight,
+      [&](const int64_t iChromaRow) {
+        for (int iChromaCol = 0; iChromaCol < chromaWidth; ++iChromaCol) {
+          float sumR = 0.0f;
+          float sumG = 0.0f;
+          float sumB = 0.0f;
+          int nSamples = 0;
+
+          for (int y = 2 * (int)iChromaRow; y < std::min(2 * (int)iChromaRow + 2, height); ++y) {
+            // NOTE: The bottom row comes first in the frame, and the top row in the video
+            const unsigned char* rgbaRow = rgbaBytes + (size_t)(height - y - 1) * width * 4;
+
+            for (int x = 2 * iChromaCol; x < std::min(2 * iChromaCol + 2, width); ++x) {
+              const float r = (float)rgbaRow[4 * x + 0];
+              const float g = (float)rgbaRow[4 * x + 1];
+              const float b = (float)rgbaRow[4 * x + 2];
+
+              yPlane[(size_t)y * width + x] = toByte(0.299f * r + 0.587f * g + 0.114f * b);
+
+              sumR += r;
+              sumG += g;
+              sumB += b;
+              ++nSamples;
+            }
+          }
+
+          const float r = sumR / (float)nSamples;
+          const float g = sumG / (float)nSamples;
+          const float b = sumB / (float)nSamples;
+          const size_t iChroma = (size_t)iChromaRow * chromaWidth + iChromaCol;
+
+          uPlane[iChroma] = toByte(128.0f - 0.168736f * r - 0.331264f * g + 0.5f * b);
+          vPlane[iChroma] = toByte(128.0f + 0.5f * r - 0.418688f * g - 0.081312f * b);
+        }
+      },
+      0,
+      scheduler);
+}
+
+}  // namespace renderer
+}  // namespace simview
@@ -0,0 +1,138 @@
+#include <SimView/Renderer/RenderTargetPool.hpp>
+
+namespace simview {
+namespace renderer {
+
+using namespace util;
+
+RenderTargetPool::RenderTargetPool()
+    : _freeTargets(),
+      _nAllocations(0),
+      _nLiveTargets(0) {
+  // NOTE: Statics are destroyed in the reverse order of construction, so the queue is constructed first
+  //       to outlive the free targets, whose handles are queued when the pool is destroyed at exit
+  GLDeletionQueue::getInstance();
+}
+
+RenderTargetPool& RenderTargetPool::getInstance() {
+  static RenderTargetPool instance;
+  return instance;
+}
+
+bool RenderTargetPool::fits(const RenderTarget& target, const int width, const int height) {
+  return width <= target.width &&
+         height <= target.height &&
+         (size_t)target.width * target.height <= (size_t)MAX_WASTED_AREA_RATIO * width * height;
+}
+
+RenderTarget_t RenderTargetPool::acquire(const int width, const int height, const int nSamples) {
+  const int clampedWidth = std::max(width, 1);
+  const int clampedHeight = std::max(height, 1);
+
+  // NOTE: The smallest free target which fits
+  auto bestIter = _freeTargets.end();
+  for (auto iter = _freeTargets.begin(); iter != _freeTargets.end(); ++iter) {
+    const RenderTarget& target = **iter;
+    if (target.nSamples != nSamples || !fits(target, clampedWidth, clampedHeight)) {
+      continue;
+    }
+    if (bestIter == _freeTargets.end() || target.width * target.height < (*bestIter)->width * (*bestIter)->height) {
+      bestIter = iter;
+    }
+  }
+
+  if (bestIter != _freeTargets.end()) {
+    RenderTarget_t target = *bestIter;
+    _freeTargets.erase(bestIter);
+    return target;
+  }
+
+  const int allocatedWidth = ((int)(clampedWidth * GROWTH_FACTOR) + SIZE_GRANULARITY - 1) / SIZE_GRANULARITY * SIZE_GRANULARITY;
+  const int allocatedHeight = ((int)(clampedHeight * GROWTH_FACTOR) + SIZE_GRANULARITY - 1) / SIZE_GRANULARITY * SIZE_GRANULARITY;
+
+  return allocate(allocatedWidth, allocatedHeight, nSamples);
+}
+
+void RenderTargetPool::release(const RenderTarget_t& target) {
+  if (target == nullptr) {
+    return;
+  }
+
+  _freeTargets.push_back(target);
+
+  if (_freeTargets.size() > MAX_FREE_TARGETS) {
+    // NOTE: The handles queue the GL objects for deletion
+    _freeTargets.erase(_freeTargets.begin());
+    --_nLiveTargets;
+  }
+}
+
+RenderTarget_t RenderTargetPool::allocate(const int width, const int height, const int nSamples) {
+  GLint maxSamples = 1;
+  glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+
+  RenderTarget_t target = std::make_shared<RenderTarget>();
+  target->width = width;
+  target->height = height;
+  target->nSamples = std::max(std::min(nSamples, (int)maxSamples), 1);
+
+  GLStateCache& stateCache = GLStateCache::getInstance();
+
+  // Resolved color
+  target->texture.create();
+  stateCache.bindTexture2D(target->texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  stateCache.bindTexture2D(0);
+
+  target->depthBuffer.create();
+  glBindRenderbuffer(GL_RENDERBUFFER, target->depthBuffer);
+
+  if (target->nSamples > 1) {
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, target->nSamples, GL_DEPTH24_STENCIL8, width, height);
+
+    target->colorBuffer.create();
+    glBindRenderbuffer(GL_RENDERBUFFER, target->colorBuffer);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, target->nSamples, GL_RGBA8, width, height);
+
+    target->fbo.create();
+    glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target->colorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target->depthBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+      LOG_ERROR("ERROR::FRAMEBUFFER:: Multisampled framebuffer is not complete!");
+    }
+
+    target->resolveFbo.create();
+    glBindFramebuffer(GL_FRAMEBUFFER, target->resolveFbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target->texture, 0);
+  } else {
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+
+    target->fbo.create();
+    glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target->texture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target->depthBuffer);
+  }
+
+  if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    LOG_ERROR("ERROR::FRAMEBUFFER:: Framebuffer is not complete!");
+  }
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  ++_nAllocations;
+  ++_nLiveTargets;
+
+  LOG_DEBUG("[RenderTargetPool] Allocated " + std::to_string(width) + "x" + std::to_string(height) + " (" + std::to_string(target->nSamples) + " samples)");
+
+  return target;
+}
+
+}  // namespace renderer
+}  // namespace simview
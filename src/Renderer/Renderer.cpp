@@ -4,6 +4,7 @@ namespace simview {
 namespace renderer {
 
 using namespace model;
+using namespace util;
 
 Renderer::Renderer(const int* windowWidth,
                    const int* windowHeight,
@@ -54,8 +55,10 @@ void Renderer::initLightMatrices() {
 }
 
 void Renderer::initializeGL() {
-  glEnable(GL_DEPTH_TEST);
-  glEnable(GL_MULTISAMPLE);
+  GLStateCache& stateCache = GLStateCache::getInstance();
+  stateCache.invalidate();
+  stateCache.enable(GL_DEPTH_TEST);
+  stateCache.enable(GL_MULTISAMPLE);
 
   auto RGBA = _model->getBackgroundColor();
   glClearColor(RGBA[0], RGBA[1], RGBA[2], RGBA[3]);
@@ -65,8 +68,18 @@ void Renderer::initializeGL() {
 }
 
 void Renderer::paintGL(const bool& renderShadowMap) {
-  glEnable(GL_DEPTH_TEST);
-  glEnable(GL_MULTISAMPLE);
+  const auto startTime = std::chrono::steady_clock::now();
+
+  // NOTE: The GUI changes the GL state behind the cache between frames
+  GLStateCache& stateCache = GLStateCache::getInstance();
+  stateCache.invalidate();
+  stateCache.resetStatistics();
+
+  // NOTE: GL objects released since the last frame, possibly on other threads
+  GLDeletionQueue::getInstance().flush();
+
+  stateCache.enable(GL_DEPTH_TEST);
+  stateCache.enable(GL_MULTISAMPLE);
 
   const glm::mat4& modelMat = _acTransMat * _acRotMat * _acScaleMat;
   const glm::mat4& lightMvpMat = _lightProjMat * getLightViewMat(modelMat) * modelMat;
@@ -82,12 +95,12 @@ void Renderer::paintGL(const bool& renderShadowMap) {
       _depthRenderer->bind();
       glDepthFunc(GL_LESS);
 
-      glEnable(GL_CULL_FACE);
+      stateCache.enable(GL_CULL_FACE);
       glCullFace(GL_BACK);
 
       _model->drawGL(lightMvpMat);
 
-      glDisable(GL_CULL_FACE);
+      stateCache.disable(GL_CULL_FACE);
       _depthRenderer->unbind();
     }
   }
@@ -128,6 +141,7 @@ void Renderer::paintGL(const bool& renderShadowMap) {
   }
 
   if (_frameBuffer != nullptr) {
+    _frameBuffer->resolve();
     _frameBuffer->unbind();
   }
 
@@ -135,6 +149,13 @@ void Renderer::paintGL(const bool& renderShadowMap) {
   // Update time state
   // ====================================================================
   _model->tick(TICK_VALUE);
+
+  // ====================================================================
+  // Statistics
+  // ====================================================================
+  _nIssuedStateCalls = stateCache.getNumIssuedCalls();
+  _nElidedStateCalls = stateCache.getNumElidedCalls();
+  _paintTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
 }
 
 void Renderer::resizeGL() {
@@ -0,0 +1,162 @@
+#include <SimView/Renderer/ScreenCapture.hpp>
+
+namespace simview {
+namespace renderer {
+
+using namespace util;
+
+ScreenCapture::ScreenCapture(TaskScheduler& scheduler)
+    : _pixelBuffers(),
+      _iNextBuffer(0),
+      _scheduler(scheduler) {
+}
+
+ScreenCapture::~ScreenCapture() {
+  // NOTE: Fences of pending captures are left to the context, which may already be destroyed.
+  //       Their callbacks are not called.
+}
+
+void ScreenCapture::capture(const FrameBuffer& frameBuffer, CaptureCallback onCaptured) {
+  if (isFull()) {
+    // NOTE: All of the older captures are completed, not only the reused one, to keep the order of the callbacks
+    for (size_t iBuffer = 0; iBuffer < NUM_PIXEL_BUFFERS; ++iBuffer) {
+      PixelBuffer& olderBuffer = _pixelBuffers[(_iNextBuffer + iBuffer) % NUM_PIXEL_BUFFERS];
+
+      if (olderBuffer.fence != nullptr) {
+        complete(olderBuffer, true);
+      }
+    }
+  }
+
+  PixelBuffer& pixelBuffer = _pixelBuffers[_iNextBuffer];
+  _iNextBuffer = (_iNextBuffer + 1) % NUM_PIXEL_BUFFERS;
+
+  pixelBuffer.width = frameBuffer.getWidth();
+  pixelBuffer.height = frameBuffer.getHeight();
+  pixelBuffer.onCaptured = std::move(onCaptured);
+
+  const size_t nBytes = sizeof(unsigned char) * pixelBuffer.width * pixelBuffer.height * 4;
+
+  if (!pixelBuffer.buffer.isValid()) {
+    pixelBuffer.buffer.create();
+  }
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer.buffer);
+  if (pixelBuffer.bufferSize < nBytes) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, nBytes, nullptr, GL_STREAM_READ);
+    pixelBuffer.bufferSize = nBytes;
+  }
+
+  // NOTE: With a pack buffer bound, the pointer is an offset in the buffer and the call does not wait for the GPU
+  frameBuffer.readPixels(nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  pixelBuffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+std::future<bool> ScreenCapture::capture(const FrameBuffer& frameBuffer, const std::string& filePath) {
+  // NOTE: Shared, since the callback has to be copyable
+  auto promise = std::make_shared<std::promise<bool>>();
+  std::future<bool> future = promise->get_future();
+
+  capture(frameBuffer, [scheduler = &_scheduler, filePath, promise](const CapturedFrame& frame) {
+    if (frame.bytes == nullptr) {
+      LOG_ERROR("Failed to read back the screen shot for " + filePath);
+      promise->set_value(false);
+      return;
+    }
+
+    scheduler->enqueue([scheduler, filePath, promise, frame]() {
+      flipRows(frame, *scheduler);
+
+      const bool isSaved = stb::saveImage(frame.width, frame.height, 4, frame.bytes.get(), filePath);
+      LOG_INFO((isSaved ? "Saved screen shot to " : "Failed to save screen shot to ") + filePath);
+      promise->set_value(isSaved);
+    });
+  });
+
+  return future;
+}
+
+void ScreenCapture::update() {
+  // NOTE: In the order of the captures. Stops at the first one not finished, so that the callbacks keep the order.
+  for (size_t iBuffer = 0; iBuffer < NUM_PIXEL_BUFFERS; ++iBuffer) {
+    PixelBuffer& pixelBuffer = _pixelBuffers[(_iNextBuffer + iBuffer) % NUM_PIXEL_BUFFERS];
+
+    if (pixelBuffer.fence != nullptr && !complete(pixelBuffer, false)) {
+      break;
+    }
+  }
+}
+
+size_t ScreenCapture::getNumPendingCaptures() const {
+  size_t nCaptures = 0;
+  for (const auto& pixelBuffer : _pixelBuffers) {
+    if (pixelBuffer.fence != nullptr) {
+      ++nCaptures;
+    }
+  }
+  return nCaptures;
+}
+
+bool ScreenCapture::complete(PixelBuffer& pixelBuffer, const bool toWait) {
+  // NOTE: Flushed, so that the fence is signaled even if nothing else is submitted
+  const GLuint64 timeout = toWait ? GL_TIMEOUT_IGNORED : 0;
+  const GLenum status = glClientWaitSync(pixelBuffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+
+  if (status == GL_TIMEOUT_EXPIRED) {
+    return false;
+  }
+
+  glDeleteSync(pixelBuffer.fence);
+  pixelBuffer.fence = nullptr;
+
+  CapturedFrame frame;
+  frame.width = pixelBuffer.width;
+  frame.height = pixelBuffer.height;
+
+  if (status == GL_WAIT_FAILED) {
+    LOG_ERROR("Failed to wait for the readback.");
+  } else {
+    const size_t nBytes = sizeof(unsigned char) * frame.width * frame.height * 4;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer.buffer);
+    const unsigned char* mappedBytes = static_cast<const unsigned char*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, nBytes, GL_MAP_READ_BIT));
+
+    if (mappedBytes != nullptr) {
+      frame.bytes = std::shared_ptr<unsigned char[]>(new unsigned char[nBytes]);
+      std::memcpy(frame.bytes.get(), mappedBytes, nBytes);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    } else {
+      LOG_ERROR("Failed to map the readback.");
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  CaptureCallback onCaptured = std::move(pixelBuffer.onCaptured);
+  pixelBuffer.onCaptured = nullptr;
+  onCaptured(frame);
+
+  return true;
+}
+
+void ScreenCapture::flipRows(const CapturedFrame& frame, TaskScheduler& scheduler) {
+  const size_t rowSize = sizeof(unsigned char) * frame.width * 4;
+  const int height = frame.height;
+  unsigned char* bytes = frame.bytes.get();
+
+  // NOTE: Rows are swapped in place in parallel
+  parallelFor(
+      0,
+      height / 2,
+      [&](const int64_t iRow) {
+        unsigned char* row = bytes + rowSize * iRow;
+        std::swap_ranges(row, row + rowSize, bytes + rowSize * (height - iRow - 1));
+      },
+      0,
+      scheduler);
+}
+
+}  // namespace renderer
+}  // namespace simview
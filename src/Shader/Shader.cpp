@@ -3,6 +3,8 @@
 namespace simview {
 namespace shader {
 
+using namespace util;
+
 Shader::~Shader() = default;
 
 void Shader::setShaders(const std::string& vertShaderCode,
@@ -10,68 +12,115 @@ void Shader::setShaders(const std::string& vertShaderCode,
   LOG_INFO("Start compiling shaders");
   _shaderID = ShaderCompiler::buildShaderProgram(vertShaderCode, fragShaderCode);
   LOG_INFO("Finish compiling shaders: " + std::to_string(_shaderID));
+
+  // Resolve the locations of all uniform names once
+  _uniformLocations.resize(UniformName::getNumNames());
+  for (size_t id = 0; id < _uniformLocations.size(); ++id) {
+    _uniformLocations[id] = glGetUniformLocation(_shaderID, UniformName::getName(id));
+  }
+  _namedUniformLocations.clear();
+}
+
+GLint Shader::getUniformLocation(const UniformName& name) const {
+  // NOTE: Names constructed after linking, e.g. in other translation units, are resolved on first use
+  if (name.getId() >= _uniformLocations.size()) {
+    const size_t nResolved = _uniformLocations.size();
+    _uniformLocations.resize(UniformName::getNumNames());
+    for (size_t id = nResolved; id < _uniformLocations.size(); ++id) {
+      _uniformLocations[id] = glGetUniformLocation(_shaderID, UniformName::getName(id));
+    }
+  }
+
+  return _uniformLocations[name.getId()];
+}
+
+GLint Shader::getUniformLocation(const std::string& name) const {
+  const auto iter = _namedUniformLocations.find(name);
+  if (iter != _namedUniformLocations.end()) {
+    return iter->second;
+  }
+
+  const GLint location = glGetUniformLocation(_shaderID, name.c_str());
+  _namedUniformLocations.emplace(name, location);
+  return location;
 }
 
 void Shader::bind(const bool& disableDepthTest) {
   _textureCounter = _textureCounterOffset;
 
+  GLStateCache& stateCache = GLStateCache::getInstance();
+
   // Enable shader program
-  glUseProgram(_shaderID);
+  stateCache.useProgram(_shaderID);
 
-  if (disableDepthTest) {
-    glDisable(GL_DEPTH_TEST);
-  }
+  stateCache.setEnabled(GL_DEPTH_TEST, !disableDepthTest);
+  stateCache.disable(GL_BLEND);
+  stateCache.disable(GL_LINE_SMOOTH);
 }
 
 void Shader::unbind() {
-  glEnable(GL_DEPTH_TEST);
-
-  // Unbind all texture
-  for (int iTexture = 0; iTexture < _textureCounter - _textureCounterOffset;
-       iTexture++) {
-    glBindTexture(GL_TEXTURE_2D, 0);
-  }
+  GLStateCache::getInstance().enable(GL_DEPTH_TEST);
 
   _textureCounter = _textureCounterOffset;
+}
+
+void Shader::setUniformVariable(const UniformName& name, const glm::mat4& matrix) const {
+  glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
+}
 
-  // Disable shader program
-  glUseProgram(0);
+void Shader::setUniformVariable(const UniformName& name, const glm::vec3& vec) const {
+  glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(vec));
+}
+
+void Shader::setUniformVariable(const UniformName& name, const float& value) const {
+  glUniform1f(getUniformLocation(name), value);
+}
+
+void Shader::setUniformVariable(const UniformName& name, const int& value) const {
+  glUniform1f(getUniformLocation(name), (float)value);
+}
+
+void Shader::setUniformVariable(const UniformName& name, const bool& value) const {
+  glUniform1f(getUniformLocation(name), (float)value);
+}
+
+void Shader::setUniformTexture(const UniformName& name, const GLuint& textureId) {
+  GLStateCache& stateCache = GLStateCache::getInstance();
+  stateCache.activeTexture((GLuint)_textureCounter);
+  stateCache.bindTexture2D(textureId);
+  glUniform1i(getUniformLocation(name), _textureCounter);
+  _textureCounter++;
 }
 
 void Shader::setUniformVariable(const std::string& name,
                                 const glm::mat4& matrix) const {
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniformMatrix4fv(uid, 1, GL_FALSE, glm::value_ptr(matrix));
+  glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
 }
 
 void Shader::setUniformVariable(const std::string& name, const glm::vec3& vec) const {
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniform3fv(uid, 1, glm::value_ptr(vec));
+  glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(vec));
 }
 
 void Shader::setUniformVariable(const std::string& name, const float& value) const {
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniform1f(uid, value);
+  glUniform1f(getUniformLocation(name), value);
 }
 
 void Shader::setUniformVariable(const std::string& name, const int& value) const {
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniform1f(uid, (float)value);
+  glUniform1f(getUniformLocation(name), (float)value);
 }
 
 void Shader::setUniformVariable(const std::string& name, const bool& value) const {
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniform1f(uid, (float)value);
+  glUniform1f(getUniformLocation(name), (float)value);
 }
 
 void Shader::setUniformTexture(const std::string& name,
                                const GLuint& textureId) {
-  glActiveTexture(GL_TEXTURE_IDS[_textureCounter]);
-  glBindTexture(GL_TEXTURE_2D, textureId);
-  const GLuint& uid = glGetUniformLocation(_shaderID, name.c_str());
-  glUniform1i(uid, _textureCounter);
+  GLStateCache& stateCache = GLStateCache::getInstance();
+  stateCache.activeTexture((GLuint)_textureCounter);
+  stateCache.bindTexture2D(textureId);
+  glUniform1i(getUniformLocation(name), _textureCounter);
   _textureCounter++;
 }
 
 }  // namespace shader
-}  // namespace simview
\ No newline at end of file
+}  // namespace simview
@@ -115,7 +115,7 @@ GLuint ShaderCompiler::buildShaderProgram(const std::string& vertexShaderCode,
   }
 
   // Disable shader program and return its ID
-  glUseProgram(0);
+  util::GLStateCache::getInstance().useProgram(0);
 
   return programId;
 }
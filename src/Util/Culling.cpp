@@ -0,0 +1,225 @@
+#include <SimView/Util/Culling.hpp>
+
+namespace simview {
+namespace util {
+
+// ==================================================================================================
+// Frustum
+// ==================================================================================================
+Frustum::Frustum() {
+  _planes.fill(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+Frustum::Frustum(const glm::mat4 &mvpMat) {
+  const glm::mat4 rows = glm::transpose(mvpMat);
+
+  _planes = {
+      rows[3] + rows[0],  // left
+      rows[3] - rows[0],  // right
+      rows[3] + rows[1],  // bottom
+      rows[3] - rows[1],  // top
+      rows[3] + rows[2],  // near
+      rows[3] - rows[2]   // far
+  };
+}
+
+bool Frustum::intersects(const glm::vec3 &minCoords, const glm::vec3 &maxCoords) const {
+  for (const auto &plane : _planes) {
+    // NOTE: The box is outside if its corner farthest along the plane normal is behind the plane
+    const glm::vec3 corner(plane.x >= 0.0f ? maxCoords.x : minCoords.x,
+                           plane.y >= 0.0f ? maxCoords.y : minCoords.y,
+                           plane.z >= 0.0f ? maxCoords.z : minCoords.z);
+
+    if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// ==================================================================================================
+// Bounding volume hierarchy
+// ==================================================================================================
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+    : _nodes(),
+      _itemIds(),
+      _boxes() {}
+
+void BoundingVolumeHierarchy::build(const std::vector<Box> &boxes) {
+  const uint32_t nItems = (uint32_t)boxes.size();
+
+  _boxes = boxes;
+  _itemIds.resize(nItems);
+  std::iota(_itemIds.begin(), _itemIds.end(), 0);
+
+  _nodes.clear();
+  if (nItems == 0) {
+    return;
+  }
+  _nodes.reserve(nItems);
+
+  std::vector<glm::vec3> centers(nItems);
+  for (uint32_t iItem = 0; iItem < nItems; ++iItem) {
+    centers[iItem] = 0.5f * (boxes[iItem].minCoords + boxes[iItem].maxCoords);
+  }
+
+  buildNode(centers, 0, nItems);
+}
+
+int32_t BoundingVolumeHierarchy::buildNode(const std::vector<glm::vec3> &centers, const uint32_t first, const uint32_t nItems) {
+  const int32_t iNode = (int32_t)_nodes.size();
+  _nodes.push_back({calcBounds(first, nItems), -1, first, nItems});
+
+  if (nItems <= MAX_LEAF_ITEMS) {
+    return iNode;
+  }
+
+  // NOTE: Split at the median of the longest axis of the centers, so that the tree is balanced
+  glm::vec3 minCenter = centers[_itemIds[first]];
+  glm::vec3 maxCenter = minCenter;
+  for (uint32_t iItem = first + 1; iItem < first + nItems; ++iItem) {
+    minCenter = glm::min(minCenter, centers[_itemIds[iItem]]);
+    maxCenter = glm::max(maxCenter, centers[_itemIds[iItem]]);
+  }
+
+  const glm::vec3 extent = maxCenter - minCenter;
+  int axis = 0;
+  if (extent.y > extent[axis]) {
+    axis = 1;
+  }
+  if (extent.z > extent[axis]) {
+    axis = 2;
+  }
+
+  const uint32_t nLeftItems = nItems / 2;
+  std::nth_element(_itemIds.begin() + first,
+                   _itemIds.begin() + first + nLeftItems,
+                   _itemIds.begin() + first + nItems,
+                   [&](const uint32_t iItem0, const uint32_t iItem1) {
+                     return centers[iItem0][axis] < centers[iItem1][axis];
+                   });
+
+  buildNode(centers, first, nLeftItems);
+  const int32_t iRight = buildNode(centers, first + nLeftItems, nItems - nLeftItems);
+
+  // NOTE: '_nodes' may have been reallocated by the children
+  _nodes[iNode].right = iRight;
+
+  return iNode;
+}
+
+void BoundingVolumeHierarchy::refit(const std::vector<Box> &boxes) {
+  if (boxes.size() != _boxes.size()) {
+    LOG_WARN("The number of boxes differs from the built one. Rebuild the hierarchy.");
+    build(boxes);
+    return;
+  }
+
+  _boxes = boxes;
+
+  // NOTE: Leaves first in parallel, then inner nodes from the back, since children come after their parent
+  parallelFor(
+      0,
+      (int64_t)_nodes.size(),
+      [&](const int64_t iNode) {
+        Node &node = _nodes[iNode];
+        if (node.right < 0) {
+          node.bounds = calcBounds(node.first, node.nItems);
+        }
+      },
+      PARALLEL_QUERY_THRESHOLD);
+
+  for (int64_t iNode = (int64_t)_nodes.size() - 1; iNode >= 0; --iNode) {
+    Node &node = _nodes[iNode];
+    if (node.right >= 0) {
+      node.bounds = merge(_nodes[iNode + 1].bounds, _nodes[node.right].bounds);
+    }
+  }
+}
+
+void BoundingVolumeHierarchy::query(const Frustum &frustum, std::vector<uint8_t> &isInside) const {
+  isInside.assign(_itemIds.size(), 0);
+
+  if (_nodes.empty()) {
+    return;
+  }
+
+  if (_itemIds.size() <= PARALLEL_QUERY_THRESHOLD) {
+    querySubtree(frustum, 0, isInside);
+    return;
+  }
+
+  // NOTE: The top levels are traversed here, and the subtrees below them are handed to the workers.
+  //       Each item belongs to one subtree, so the workers write disjoint flags.
+  std::vector<int32_t> subtrees;
+  std::vector<int32_t> stack = {0};
+
+  while (!stack.empty()) {
+    const int32_t iNode = stack.back();
+    stack.pop_back();
+
+    const Node &node = _nodes[iNode];
+    if (!frustum.intersects(node.bounds.minCoords, node.bounds.maxCoords)) {
+      continue;
+    }
+
+    if (node.nItems <= PARALLEL_QUERY_THRESHOLD || node.right < 0) {
+      subtrees.push_back(iNode);
+    } else {
+      stack.push_back(node.right);
+      stack.push_back(iNode + 1);
+    }
+  }
+
+  parallelFor(
+      0,
+      (int64_t)subtrees.size(),
+      [&](const int64_t iSubtree) {
+        querySubtree(frustum, subtrees[iSubtree], isInside);
+      },
+      1);
+}
+
+void BoundingVolumeHierarchy::querySubtree(const Frustum &frustum, const int32_t iRoot, std::vector<uint8_t> &isInside) const {
+  std::vector<int32_t> stack = {iRoot};
+
+  while (!stack.empty()) {
+    const int32_t iNode = stack.back();
+    stack.pop_back();
+
+    const Node &node = _nodes[iNode];
+    if (!frustum.intersects(node.bounds.minCoords, node.bounds.maxCoords)) {
+      continue;
+    }
+
+    if (node.right >= 0) {
+      stack.push_back(node.right);
+      stack.push_back(iNode + 1);
+      continue;
+    }
+
+    for (uint32_t iItem = node.first; iItem < node.first + node.nItems; ++iItem) {
+      const uint32_t itemId = _itemIds[iItem];
+      const Box &box = _boxes[itemId];
+      isInside[itemId] = frustum.intersects(box.minCoords, box.maxCoords) ? 1 : 0;
+    }
+  }
+}
+
+BoundingVolumeHierarchy::Box BoundingVolumeHierarchy::calcBounds(const uint32_t first, const uint32_t nItems) const {
+  Box bounds = _boxes[_itemIds[first]];
+
+  for (uint32_t iItem = first + 1; iItem < first + nItems; ++iItem) {
+    bounds = merge(bounds, _boxes[_itemIds[iItem]]);
+  }
+
+  return bounds;
+}
+
+BoundingVolumeHierarchy::Box BoundingVolumeHierarchy::merge(const Box &box0, const Box &box1) {
+  return {glm::min(box0.minCoords, box1.minCoords), glm::max(box0.maxCoords, box1.maxCoords)};
+}
+
+}  // namespace util
+}  // namespace simview
@@ -1,4 +1,7 @@
 #include <SimView/Util/FileUtil.hpp>
+#include <atomic>
+#include <cstdio>
+#include <random>
 
 namespace simview {
 namespace util {
@@ -29,6 +32,13 @@ bool FileUtil::isFile(const std::string path) { return generic_fs::is_regular_fi
 
 bool FileUtil::isAbsolute(const std::string path) { return Path_t(path).is_absolute(); }
 
+uintmax_t FileUtil::fileSize(const std::string path) { return generic_fs::file_size(generic_fs::absolute(Path_t(path))); }
+
+int64_t FileUtil::lastWriteTime(const std::string path) {
+  const auto lastWriteTime = generic_fs::last_write_time(generic_fs::absolute(Path_t(path)));
+  return (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(lastWriteTime.time_since_epoch()).count();
+}
+
 std::string FileUtil::getTimeStamp() {
   const time_t t = time(NULL);
   const tm *local = localtime(&t);
@@ -41,5 +51,16 @@ std::string FileUtil::getTimeStamp() {
   return timeStamp;
 }
 
+std::string FileUtil::uniquePath(const std::string path) {
+  // NOTE: The random number tells the processes apart, and the counter the calls in this process
+  static const uint64_t processId = ((uint64_t)std::random_device()() << 32) | (uint64_t)std::random_device()();
+  static std::atomic<uint64_t> counter(0);
+
+  char buf[64];
+  snprintf(buf, sizeof(buf), ".%016llx-%llu", (unsigned long long)processId, (unsigned long long)counter++);
+
+  return path + buf;
+}
+
 }  // namespace util
 }  // namespace simview
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <SimView/Util/GLResource.hpp>
+
+namespace simview {
+namespace util {
+
+GLDeletionQueue::GLDeletionQueue()
+    : _mutex(),
+      _pendingNames(),
+      _flushedNames(),
+      _nDeletedNames(0) {
+}
+
+GLDeletionQueue& GLDeletionQueue::getInstance() {
+  static GLDeletionQueue instance;
+  return instance;
+}
+
+void GLDeletionQueue::push(const GLResourceType type, const GLuint name) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _pendingNames[(int)type].push_back(name);
+}
+
+size_t GLDeletionQueue::flush() {
+  {
+    // NOTE: Swapped out under the lock, so handles destroyed on other threads are not blocked by the GL calls
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t iType = 0; iType < NUM_RESOURCE_TYPES; ++iType) {
+      _flushedNames[iType].swap(_pendingNames[iType]);
+    }
+  }
+
+  GLStateCache& stateCache = GLStateCache::getInstance();
+  size_t nDeletedNames = 0;
+
+  for (size_t iType = 0; iType < NUM_RESOURCE_TYPES; ++iType) {
+    std::vector<GLuint>& names = _flushedNames[iType];
+    if (names.empty()) {
+      continue;
+    }
+
+    const GLsizei nNames = (GLsizei)names.size();
+
+    switch ((GLResourceType)iType) {
+      case GLResourceType::BUFFER:
+        glDeleteBuffers(nNames, names.data());
+        break;
+      case GLResourceType::VERTEX_ARRAY:
+        for (const GLuint name : names) {
+          stateCache.forgetVertexArray(name);
+        }
+        glDeleteVertexArrays(nNames, names.data());
+        break;
+      case GLResourceType::TEXTURE:
+        for (const GLuint name : names) {
+          stateCache.forgetTexture(name);
+        }
+        glDeleteTextures(nNames, names.data());
+        break;
+      case GLResourceType::FRAMEBUFFER:
+        glDeleteFramebuffers(nNames, names.data());
+        break;
+      case GLResourceType::RENDERBUFFER:
+        glDeleteRenderbuffers(nNames, names.data());
+        break;
+    }
+
+    nDeletedNames += names.size();
+    names.clear();
+  }
+
+  _nDeletedNames += nDeletedNames;
+
+  return nDeletedNames;
+}
+
+size_t GLDeletionQueue::getNumPendingNames() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  size_t nNames = 0;
+  for (const auto& names : _pendingNames) {
+    nNames += names.size();
+  }
+
+  return nNames;
+}
+
+}  // namespace util
+}  // namespace simview
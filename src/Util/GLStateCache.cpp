@@ -0,0 +1,138 @@
+#include <SimView/Util/GLStateCache.hpp>
+
+namespace simview {
+namespace util {
+
+GLStateCache::GLStateCache()
+    : _program(UNKNOWN_NAME),
+      _vertexArray(UNKNOWN_NAME),
+      _activeTextureUnit(UNKNOWN_NAME),
+      _textures2D(),
+      _capabilities(),
+      _nIssuedCalls(0),
+      _nElidedCalls(0) {
+  invalidate();
+}
+
+GLStateCache& GLStateCache::getInstance() {
+  static GLStateCache instance;
+  return instance;
+}
+
+void GLStateCache::invalidate() {
+  _program = UNKNOWN_NAME;
+  _vertexArray = UNKNOWN_NAME;
+  _activeTextureUnit = UNKNOWN_NAME;
+  _textures2D.fill(UNKNOWN_NAME);
+  _capabilities.fill(CapabilityState::UNKNOWN);
+}
+
+void GLStateCache::useProgram(const GLuint program) {
+  if (_program == program) {
+    ++_nElidedCalls;
+    return;
+  }
+
+  glUseProgram(program);
+  _program = program;
+  ++_nIssuedCalls;
+}
+
+void GLStateCache::bindVertexArray(const GLuint vertexArray) {
+  if (_vertexArray == vertexArray) {
+    ++_nElidedCalls;
+    return;
+  }
+
+  glBindVertexArray(vertexArray);
+  _vertexArray = vertexArray;
+  ++_nIssuedCalls;
+}
+
+void GLStateCache::activeTexture(const GLuint unit) {
+  if (_activeTextureUnit == unit) {
+    ++_nElidedCalls;
+    return;
+  }
+
+  glActiveTexture(GL_TEXTURE0 + unit);
+  _activeTextureUnit = unit;
+  ++_nIssuedCalls;
+}
+
+void GLStateCache::bindTexture2D(const GLuint texture) {
+  // NOTE: The binding of an unknown unit can not be recorded
+  const bool isKnownUnit = _activeTextureUnit < MAX_NUM_TEXTURE_UNITS;
+
+  if (isKnownUnit && _textures2D[_activeTextureUnit] == texture) {
+    ++_nElidedCalls;
+    return;
+  }
+
+  glBindTexture(GL_TEXTURE_2D, texture);
+  if (isKnownUnit) {
+    _textures2D[_activeTextureUnit] = texture;
+  }
+  ++_nIssuedCalls;
+}
+
+void GLStateCache::enable(const GLenum capability) {
+  setEnabled(capability, true);
+}
+
+void GLStateCache::disable(const GLenum capability) {
+  setEnabled(capability, false);
+}
+
+void GLStateCache::setEnabled(const GLenum capability, const bool isEnabled) {
+  const CapabilityState state = isEnabled ? CapabilityState::ENABLED : CapabilityState::DISABLED;
+  const int iCapability = findCapability(capability);
+
+  if (iCapability >= 0 && _capabilities[iCapability] == state) {
+    ++_nElidedCalls;
+    return;
+  }
+
+  if (isEnabled) {
+    glEnable(capability);
+  } else {
+    glDisable(capability);
+  }
+
+  if (iCapability >= 0) {
+    _capabilities[iCapability] = state;
+  }
+  ++_nIssuedCalls;
+}
+
+void GLStateCache::forgetVertexArray(const GLuint vertexArray) {
+  if (_vertexArray == vertexArray) {
+    _vertexArray = UNKNOWN_NAME;
+  }
+}
+
+void GLStateCache::forgetTexture(const GLuint texture) {
+  for (auto& boundTexture : _textures2D) {
+    if (boundTexture == texture) {
+      boundTexture = UNKNOWN_NAME;
+    }
+  }
+}
+
+void GLStateCache::resetStatistics() {
+  _nIssuedCalls = 0;
+  _nElidedCalls = 0;
+}
+
+int GLStateCache::findCapability(const GLenum capability) {
+  for (size_t iCapability = 0; iCapability < NUM_TRACKED_CAPABILITIES; ++iCapability) {
+    if (TRACKED_CAPABILITIES[iCapability] == capability) {
+      return (int)iCapability;
+    }
+  }
+
+  return -1;
+}
+
+}  // namespace util
+}  // namespace simview
@@ -3,126 +3,275 @@
 namespace simview {
 namespace util {
 
-TriangleBucket::TriangleBucket()
+UniformGrid::UniformGrid()
     : _interval(0.0f),
       _minCoords({0.0f, 0.0f, 0.0f}),
       _maxCoords({0.0f, 0.0f, 0.0f}),
-      _nBucketsX(0),
-      _nBucketsY(0),
-      _nBucketsZ(0),
-      _bucket(nullptr) {}
+      _nCells({0, 0, 0}),
+      _cellOffsets(),
+      _itemIds() {}
+
+UniformGrid::~UniformGrid() {}
+
+float UniformGrid::calcInterval(const vec3f_t &minCoords,
+                                const vec3f_t &maxCoords,
+                                const int nDivs) {
+  const float maxModelWidth = std::max(std::max(maxCoords[0] - minCoords[0],
+                                                maxCoords[1] - minCoords[1]),
+                                       maxCoords[2] - minCoords[2]);
+  return maxModelWidth / (float)std::max(nDivs, 1);
+}
+
+void UniformGrid::build(const vecf_pt &coords, const float interval) {
+  build(coords->data(), coords->size() / 3, interval);
+}
+
+void UniformGrid::build(const float *coords,
+                        const size_t nItems,
+                        const float interval) {
+  const int64_t nPoints = static_cast<int64_t>(nItems);
+
+  _cellOffsets.clear();
+  _itemIds.clear();
+
+  // Calc bounds
+  _minCoords = {0.0f, 0.0f, 0.0f};
+  _maxCoords = {0.0f, 0.0f, 0.0f};
+
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+      const float coord = coords[3 * iPoint + iAxis];
+      _minCoords[iAxis] = (iPoint == 0) ? coord : std::min(_minCoords[iAxis], coord);
+      _maxCoords[iAxis] = (iPoint == 0) ? coord : std::max(_maxCoords[iAxis], coord);
+    }
+  }
+
+  // Calc resolution
+  const float maxModelWidth = std::max(std::max(_maxCoords[0] - _minCoords[0],
+                                                _maxCoords[1] - _minCoords[1]),
+                                       _maxCoords[2] - _minCoords[2]);
 
-TriangleBucket::~TriangleBucket() {}
+  _interval = (interval > 0.0f) ? interval : std::max(maxModelWidth, 1.0f);
+
+  while (true) {
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+      _nCells[iAxis] = (int)((_maxCoords[iAxis] - _minCoords[iAxis]) / _interval) + 1;
+    }
 
-void TriangleBucket::initBucket(const float &interval,
-                                const vec3f_t &minCoords,
-                                const vec3f_t &maxCoords) {
-  _interval = interval;
+    if ((size_t)_nCells[0] * (size_t)_nCells[1] * (size_t)_nCells[2] <= MAX_NUM_CELLS) {
+      break;
+    }
 
-  _minCoords = minCoords;
-  _maxCoords = maxCoords;
+    _interval *= COEFF_FOR_INTERVAL;
+  }
 
-  _nBucketsX = (int)((_maxCoords[0] - _minCoords[0]) / _interval) + 1;
-  _nBucketsY = (int)((_maxCoords[1] - _minCoords[1]) / _interval) + 1;
-  _nBucketsZ = (int)((_maxCoords[2] - _minCoords[2]) / _interval) + 1;
+  const size_t nCells = (size_t)_nCells[0] * (size_t)_nCells[1] * (size_t)_nCells[2];
 
-  LOG_INFO("[Bucket Info]");
+  LOG_INFO("[Grid Info]");
   LOG_INFO("  interval  = " + std::to_string(_interval));
   LOG_INFO("  minCoords = (" + std::to_string(_minCoords[0]) + ", " + std::to_string(_minCoords[1]) + ", " + std::to_string(_minCoords[2]) + ")");
   LOG_INFO("  maxCoords = (" + std::to_string(_maxCoords[0]) + ", " + std::to_string(_maxCoords[1]) + ", " + std::to_string(_maxCoords[2]) + ")");
-  LOG_INFO("  nBuckets  = (" + std::to_string(_nBucketsX) + ", " + std::to_string(_nBucketsY) + ", " + std::to_string(_nBucketsZ) + ")");
-
-  resetBuckets();
-}
-
-void TriangleBucket::resetBuckets() {
-  _bucket = std::make_shared<std::vector<vec_pt<vec_pt<vec_pt<int>>>>>();
+  LOG_INFO("  nCells    = (" + std::to_string(_nCells[0]) + ", " + std::to_string(_nCells[1]) + ", " + std::to_string(_nCells[2]) + ")");
+
+  // Calc cell of each item and count items per cell
+  std::vector<uint32_t> cellIndices(nPoints);
+  _cellOffsets.assign(nCells + 1, 0U);
+
+  parallelFor(0, nPoints, [&](const int64_t iPoint) {
+    const float *coord = coords + 3 * iPoint;
+    cellIndices[iPoint] = static_cast<uint32_t>(toFlatIndex(toCellIndexX(coord[0]),
+                                                            toCellIndexY(coord[1]),
+                                                            toCellIndexZ(coord[2])));
+  });
+
+  // NOTE: Counting is a plain increment per item, which is cheaper serially than with atomics
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    _cellOffsets[cellIndices[iPoint] + 1]++;
+  }
 
-  for (int x = 0; x < _nBucketsX; ++x) {
-    _bucket->push_back(std::make_shared<std::vector<vec_pt<vec_pt<int>>>>());
+  // Prefix sum
+  for (size_t iCell = 0; iCell < nCells; ++iCell) {
+    _cellOffsets[iCell + 1] += _cellOffsets[iCell];
+  }
 
-    for (int y = 0; y < _nBucketsY; ++y) {
-      (*_bucket)[x]->push_back(std::make_shared<std::vector<vec_pt<int>>>());
+  // Scatter
+  // NOTE: This pass is sequential to keep the ids in each cell in ascending order
+  _itemIds.resize(nPoints);
+  {
+    std::vector<uint32_t> cursors(_cellOffsets.begin(), _cellOffsets.end() - 1);
 
-      for (int z = 0; z < _nBucketsZ; ++z) {
-        (*(*_bucket)[x])[y]->push_back(std::make_shared<std::vector<int>>());
-      }
+    for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+      _itemIds[cursors[cellIndices[iPoint]]++] = static_cast<uint32_t>(iPoint);
     }
   }
 }
 
-int TriangleBucket::toBucketIndexX(const float &x) const {
-  int index = (int)((x - _minCoords[0]) / _interval);
+int UniformGrid::toCellIndexX(const float &x) const {
+  // NOTE: Clamp before casting so that far away coordinates do not overflow
+  const float index = std::floor((x - _minCoords[0]) / _interval);
+  return (int)std::min(std::max(index, 0.0f), (float)(_nCells[0] - 1));
+}
 
-  if (index < 0) {
-    index = 0;
-  }
+int UniformGrid::toCellIndexY(const float &y) const {
+  // NOTE: Clamp before casting so that far away coordinates do not overflow
+  const float index = std::floor((y - _minCoords[1]) / _interval);
+  return (int)std::min(std::max(index, 0.0f), (float)(_nCells[1] - 1));
+}
+
+int UniformGrid::toCellIndexZ(const float &z) const {
+  // NOTE: Clamp before casting so that far away coordinates do not overflow
+  const float index = std::floor((z - _minCoords[2]) / _interval);
+  return (int)std::min(std::max(index, 0.0f), (float)(_nCells[2] - 1));
+}
+
+UniformGrid::CellRange UniformGrid::getIdsInCell(const int &x,
+                                                 const int &y,
+                                                 const int &z) const {
+  CellRange range = {nullptr, nullptr};
 
-  if (index >= _nBucketsX) {
-    index = _nBucketsX - 1;
+  if (x >= 0 && x < _nCells[0] && y >= 0 && y < _nCells[1] && z >= 0 && z < _nCells[2] && !_itemIds.empty()) {
+    const size_t iCell = toFlatIndex(x, y, z);
+    range.first = _itemIds.data() + _cellOffsets[iCell];
+    range.last = _itemIds.data() + _cellOffsets[iCell + 1];
   }
 
-  return index;
+  return range;
 }
 
-int TriangleBucket::toBucketIndexY(const float &y) const {
-  int index = (int)((y - _minCoords[1]) / _interval);
+UniformGrid::CellRange UniformGrid::getIdsInCell(const float &x,
+                                                 const float &y,
+                                                 const float &z) const {
+  return getIdsInCell(toCellIndexX(x), toCellIndexY(y), toCellIndexZ(z));
+}
 
-  if (index < 0) {
-    index = 0;
+SparseGrid::SparseGrid()
+    : _interval(0.0f),
+      _minCoords({0.0f, 0.0f, 0.0f}),
+      _slotKeys(),
+      _slotCells(),
+      _cellKeys(),
+      _cellOffsets(),
+      _itemIds() {}
+
+SparseGrid::~SparseGrid() {}
+
+void SparseGrid::build(const float *coords,
+                       const size_t nItems,
+                       const float interval) {
+  const int64_t nPoints = static_cast<int64_t>(nItems);
+
+  _slotKeys.clear();
+  _slotCells.clear();
+  _cellKeys.clear();
+  _cellOffsets.clear();
+  _itemIds.clear();
+
+  // Calc bounds
+  vec3f_t maxCoords = {0.0f, 0.0f, 0.0f};
+  _minCoords = {0.0f, 0.0f, 0.0f};
+
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+      const float coord = coords[3 * iPoint + iAxis];
+      _minCoords[iAxis] = (iPoint == 0) ? coord : std::min(_minCoords[iAxis], coord);
+      maxCoords[iAxis] = (iPoint == 0) ? coord : std::max(maxCoords[iAxis], coord);
+    }
   }
 
-  if (index >= _nBucketsY) {
-    index = _nBucketsY - 1;
+  // Calc resolution
+  // NOTE: The lower limit keeps the quantized coords within the bits of a key, even for a zero interval
+  const float maxModelWidth = std::max(std::max(maxCoords[0] - _minCoords[0],
+                                                maxCoords[1] - _minCoords[1]),
+                                       maxCoords[2] - _minCoords[2]);
+
+  _interval = std::max(interval, maxModelWidth / (float)MAX_CELL_INDEX);
+  if (!(_interval > 0.0f)) {
+    _interval = 1.0f;
   }
 
-  return index;
-}
+  // Calc key of each item
+  std::vector<uint64_t> cellKeys(nPoints);
 
-int TriangleBucket::toBucketIndexZ(const float &z) const {
-  int index = (int)((z - _minCoords[2]) / _interval);
+  parallelFor(0, nPoints, [&](const int64_t iPoint) {
+    const float *coord = coords + 3 * iPoint;
+    cellKeys[iPoint] = toCellKey(toCellIndex(coord[0], 0), toCellIndex(coord[1], 1), toCellIndex(coord[2], 2));
+  });
 
-  if (index < 0) {
-    index = 0;
+  // Number cells in order of their first items
+  // NOTE: The table is at most half full, so that probe sequences stay short
+  size_t nSlots = 16;
+  while (nSlots < 2 * nItems) {
+    nSlots *= 2;
   }
 
-  if (index >= _nBucketsZ) {
-    index = _nBucketsZ - 1;
+  _slotKeys.assign(nSlots, EMPTY_KEY);
+  _slotCells.assign(nSlots, INVALID_CELL);
+
+  std::vector<uint32_t> cellIndices(nPoints);
+
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    const uint64_t key = cellKeys[iPoint];
+
+    size_t iSlot = toSlot(key);
+    while (_slotKeys[iSlot] != EMPTY_KEY && _slotKeys[iSlot] != key) {
+      iSlot = (iSlot + 1) & (nSlots - 1);
+    }
+
+    if (_slotKeys[iSlot] == EMPTY_KEY) {
+      _slotKeys[iSlot] = key;
+      _slotCells[iSlot] = static_cast<uint32_t>(_cellKeys.size());
+      _cellKeys.push_back(key);
+    }
+
+    cellIndices[iPoint] = _slotCells[iSlot];
   }
 
-  return index;
-}
+  LOG_INFO("[Sparse Grid Info]");
+  LOG_INFO("  interval  = " + std::to_string(_interval));
+  LOG_INFO("  nCells    = " + std::to_string(_cellKeys.size()));
+
+  // Count items per cell
+  const size_t nCells = _cellKeys.size();
+  _cellOffsets.assign(nCells + 1, 0U);
 
-vec_pt<int> TriangleBucket::getIdsInBucket(const int &x,
-                                           const int &y,
-                                           const int &z) const {
-  vec_pt<int> paticleIds = nullptr;
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    _cellOffsets[cellIndices[iPoint] + 1]++;
+  }
 
-  if (x >= 0 && x < _nBucketsX && y >= 0 && y < _nBucketsY && z >= 0 && z < _nBucketsZ) {
-    paticleIds = (*(*(*_bucket)[x])[y])[z];
+  // Prefix sum
+  for (size_t iCell = 0; iCell < nCells; ++iCell) {
+    _cellOffsets[iCell + 1] += _cellOffsets[iCell];
   }
 
-  return paticleIds;
+  // Scatter
+  // NOTE: This pass is sequential to keep the ids in each cell in ascending order
+  _itemIds.resize(nPoints);
+  {
+    std::vector<uint32_t> cursors(_cellOffsets.begin(), _cellOffsets.end() - 1);
+
+    for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+      _itemIds[cursors[cellIndices[iPoint]]++] = static_cast<uint32_t>(iPoint);
+    }
+  }
 }
 
-vec_pt<int> TriangleBucket::getIdsInBucket(const float &x,
-                                           const float &y,
-                                           const float &z) const {
-  const int bucketIndexX = toBucketIndexX(x);
-  const int bucketIndexY = toBucketIndexY(y);
-  const int bucketIndexZ = toBucketIndexZ(z);
-  return getIdsInBucket(bucketIndexX, bucketIndexY, bucketIndexZ);
+int64_t SparseGrid::toCellIndex(const float &coord, const int &iAxis) const {
+  // NOTE: Clamp before casting so that far away coordinates do not overflow
+  const float index = std::floor((coord - _minCoords[iAxis]) / _interval);
+  return (int64_t)std::min(std::max(index, 0.0f), (float)MAX_CELL_INDEX);
 }
 
-void TriangleBucket::addToBucket(const float &x,
-                                 const float &y,
-                                 const float &z,
-                                 const int &index) {
-  const int bucketIndexX = toBucketIndexX(x);
-  const int bucketIndexY = toBucketIndexY(y);
-  const int bucketIndexZ = toBucketIndexZ(z);
+uint32_t SparseGrid::findCell(const uint64_t &key) const {
+  size_t iSlot = toSlot(key);
 
-  (*(*(*_bucket)[bucketIndexX])[bucketIndexY])[bucketIndexZ]->push_back(index);
+  while (_slotKeys[iSlot] != EMPTY_KEY) {
+    if (_slotKeys[iSlot] == key) {
+      return _slotCells[iSlot];
+    }
+    iSlot = (iSlot + 1) & (_slotKeys.size() - 1);
+  }
+
+  return INVALID_CELL;
 }
 
 template <class Indexing_t, class Coord_t>
@@ -178,174 +327,381 @@ std::pair<vec3_t<Coord_t>, vec3_t<Coord_t>> Geometry::calcModelBounds(const vec_
   return {std::move(minCoords), std::move(maxCoords)};
 }
 
-template <class Indexing_t, class Coord_t>
-vec_pt<Indexing_t> Geometry::extractSurfaceTriangle(const int &nDivsBucket,
-                                                    const vec_pt<Indexing_t> &originalTriangles,
-                                                    const vec_pt<Coord_t> &vertexCoords) {
-  const Indexing_t nTriangles = static_cast<Indexing_t>(originalTriangles->size()) / 3U;
+template <class Indexing_t>
+vec_pt<Indexing_t> Geometry::extractSurfaceTriangle(const vec_pt<Indexing_t> &originalTriangles) {
+  // NOTE:
+  // A triangle is on the surface if its vertex triple appears exactly once, regardless of orientation.
+  // Triangles are grouped by their smallest vertex index with a counting sort, so that each group only holds
+  // triangles around one vertex and the groups can be resolved independently in parallel.
+  const int64_t nTriangles = static_cast<int64_t>(originalTriangles->size() / 3ULL);
+
+  vec_pt<Indexing_t> surfaceTriangles = std::make_shared<std::vector<Indexing_t>>();
 
-  // Calc bary centric coords of each triangle
-  const vec_pt<Coord_t> &baryCentricCoords = calcBaryCentricCoord(originalTriangles, vertexCoords);
+  if (nTriangles == 0) {
+    return surfaceTriangles;
+  }
 
-  // Calc model scale
-  const auto [minCoords, maxCoords] = calcModelBounds(vertexCoords);
+  // Canonical (sorted) vertex triple of each triangle
+  std::vector<std::array<Indexing_t, 3>> faceKeys(nTriangles);
 
-  // Create bucket
-  TriangleBucket bucket;
+  parallelFor(0, nTriangles, [&](const int64_t iTriangle) {
+    const int64_t offset = 3 * iTriangle;
 
-  const Coord_t modelWidhtX = maxCoords[0] - minCoords[0];
-  const Coord_t modelWidhtY = maxCoords[1] - minCoords[1];
-  const Coord_t modelWidhtZ = maxCoords[2] - minCoords[2];
-  const Coord_t maxModelWidth = std::max(std::max(modelWidhtX, modelWidhtY), modelWidhtZ);
-  const Coord_t interval = maxModelWidth / (Coord_t)nDivsBucket;
+    Indexing_t index0 = (*originalTriangles)[offset + 0];
+    Indexing_t index1 = (*originalTriangles)[offset + 1];
+    Indexing_t index2 = (*originalTriangles)[offset + 2];
+    sort3Elems(index0, index1, index2);
 
-  bucket.initBucket(interval, minCoords, maxCoords);
+    faceKeys[iTriangle] = {index0, index1, index2};
+  });
 
-  // Register to bucket
-  for (Indexing_t iTriangle = 0U; iTriangle < nTriangles; ++iTriangle) {
-    const Indexing_t offset = 3U * iTriangle;
-    const Coord_t baryCenterX = (*baryCentricCoords)[offset + 0U];
-    const Coord_t baryCenterY = (*baryCentricCoords)[offset + 1U];
-    const Coord_t baryCenterZ = (*baryCentricCoords)[offset + 2U];
-    bucket.addToBucket(baryCenterX, baryCenterY, baryCenterZ, iTriangle);
+  // Counting sort by the smallest vertex index
+  Indexing_t maxVertexIndex = 0;
+  for (const auto &faceKey : faceKeys) {
+    maxVertexIndex = std::max(maxVertexIndex, faceKey[2]);
   }
 
-  // Extract surface
-  vec_pt<Indexing_t> surfaceTriangles = std::make_shared<std::vector<Indexing_t>>();
+  const int64_t nVertices = static_cast<int64_t>(maxVertexIndex) + 1;
 
-  for (Indexing_t iTriangle = 0U; iTriangle < nTriangles; ++iTriangle) {
-    bool isSurface = true;
+  std::vector<int64_t> groupOffsets(nVertices + 1, 0);
+  for (const auto &faceKey : faceKeys) {
+    ++groupOffsets[faceKey[0] + 1];
+  }
+  for (int64_t iVertex = 0; iVertex < nVertices; ++iVertex) {
+    groupOffsets[iVertex + 1] += groupOffsets[iVertex];
+  }
 
-    const Indexing_t iOffset = 3U * iTriangle;
-    Indexing_t iIndex0 = (*originalTriangles)[iOffset + 0U];
-    Indexing_t iIndex1 = (*originalTriangles)[iOffset + 1U];
-    Indexing_t iIndex2 = (*originalTriangles)[iOffset + 2U];
+  std::vector<int64_t> groupedTriangles(nTriangles);
+  {
+    std::vector<int64_t> cursors(groupOffsets.begin(), groupOffsets.end() - 1);
+    for (int64_t iTriangle = 0; iTriangle < nTriangles; ++iTriangle) {
+      groupedTriangles[cursors[faceKeys[iTriangle][0]]++] = iTriangle;
+    }
+  }
 
-    const auto &idsInBucket = bucket.getIdsInBucket((*baryCentricCoords)[iOffset + 0U],
-                                                    (*baryCentricCoords)[iOffset + 1U],
-                                                    (*baryCentricCoords)[iOffset + 2U]);
-    const Indexing_t nInBucket = static_cast<Indexing_t>(idsInBucket->size());
+  // Count duplicates within each group
+  std::vector<uint8_t> isSurface(nTriangles, 0);
 
-    sort3Elems(iIndex0, iIndex1, iIndex2);
+  parallelFor(0, nVertices, [&](const int64_t iVertex) {
+    const auto groupBegin = groupedTriangles.begin() + groupOffsets[iVertex];
+    const auto groupEnd = groupedTriangles.begin() + groupOffsets[iVertex + 1];
 
-    for (Indexing_t jTriangle = 0U; jTriangle < nInBucket; ++jTriangle) {
-      const Indexing_t id = (*idsInBucket)[jTriangle];
+    std::sort(groupBegin, groupEnd, [&faceKeys](const int64_t &left, const int64_t &right) {
+      return faceKeys[left] < faceKeys[right];
+    });
 
-      if (id == iTriangle) {
-        continue;
+    for (auto runBegin = groupBegin; runBegin != groupEnd;) {
+      auto runEnd = runBegin + 1;
+      while (runEnd != groupEnd && faceKeys[*runEnd] == faceKeys[*runBegin]) {
+        ++runEnd;
       }
 
-      const Indexing_t jOffset = 3U * id;
-
-      Indexing_t jIndex0 = (*originalTriangles)[jOffset + 0U];
-      Indexing_t jIndex1 = (*originalTriangles)[jOffset + 1U];
-      Indexing_t jIndex2 = (*originalTriangles)[jOffset + 2U];
-      sort3Elems(jIndex0, jIndex1, jIndex2);
-
-      if (iIndex0 == jIndex0 && iIndex1 == jIndex1 && iIndex2 == jIndex2) {
-        isSurface = false;
-        break;
+      if (runEnd - runBegin == 1) {
+        isSurface[*runBegin] = 1;
       }
+
+      runBegin = runEnd;
     }
+  });
+
+  // Keep the original order and orientation of surface triangles
+  size_t nSurfaceTriangles = 0;
+  for (const auto &flag : isSurface) {
+    nSurfaceTriangles += flag;
+  }
 
-    if (isSurface) {
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 0U]);
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 1U]);
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 2U]);
+  surfaceTriangles->reserve(3ULL * nSurfaceTriangles);
+
+  for (int64_t iTriangle = 0; iTriangle < nTriangles; ++iTriangle) {
+    if (isSurface[iTriangle]) {
+      const int64_t offset = 3 * iTriangle;
+      surfaceTriangles->push_back((*originalTriangles)[offset + 0]);
+      surfaceTriangles->push_back((*originalTriangles)[offset + 1]);
+      surfaceTriangles->push_back((*originalTriangles)[offset + 2]);
     }
   }
 
   return surfaceTriangles;
 }
 
-template <>
-vec_pt<uint32_t> Geometry::extractSurfaceTriangle<uint32_t, float>(const int &nDivsBucket,
-                                                                   const vec_pt<uint32_t> &originalTriangles,
-                                                                   const vec_pt<float> &vertexCoords) {
-  const uint32_t nTriangles = static_cast<uint32_t>(originalTriangles->size()) / 3U;
+// Explicit instantiation
+template vec_pt<uint32_t> Geometry::extractSurfaceTriangle<uint32_t>(const vec_pt<uint32_t> &);
+
+void Geometry::calcFaceNormals(const vecf_pt &vertexCoords,
+                               const vec_pt<uint32_t> &triangles,
+                               FaceNormals &faceNormals) {
+  const int64_t nTriangles = static_cast<int64_t>(triangles->size() / 3);
+
+  faceNormals.x.resize(nTriangles);
+  faceNormals.y.resize(nTriangles);
+  faceNormals.z.resize(nTriangles);
+  faceNormals.invLength.resize(nTriangles);
+
+  const float *coords = vertexCoords->data();
+  const uint32_t *nodeIds = triangles->data();
+
+  float *normalX = faceNormals.x.data();
+  float *normalY = faceNormals.y.data();
+  float *normalZ = faceNormals.z.data();
+  float *invLength = faceNormals.invLength.data();
+
+  parallelFor(0, nTriangles, [&](const int64_t iTriangle) {
+    const float *coord0 = coords + 3 * static_cast<size_t>(nodeIds[3 * iTriangle + 0]);
+    const float *coord1 = coords + 3 * static_cast<size_t>(nodeIds[3 * iTriangle + 1]);
+    const float *coord2 = coords + 3 * static_cast<size_t>(nodeIds[3 * iTriangle + 2]);
+
+    const float relVec0X = coord1[0] - coord0[0];
+    const float relVec0Y = coord1[1] - coord0[1];
+    const float relVec0Z = coord1[2] - coord0[2];
+
+    const float relVec1X = coord2[0] - coord0[0];
+    const float relVec1Y = coord2[1] - coord0[1];
+    const float relVec1Z = coord2[2] - coord0[2];
+
+    const float x = relVec0Y * relVec1Z - relVec0Z * relVec1Y;
+    const float y = relVec0Z * relVec1X - relVec0X * relVec1Z;
+    const float z = relVec0X * relVec1Y - relVec0Y * relVec1X;
+    const float length = std::sqrt(x * x + y * y + z * z);
+
+    normalX[iTriangle] = x;
+    normalY[iTriangle] = y;
+    normalZ[iTriangle] = z;
+    invLength[iTriangle] = length > 0.0f ? 1.0f / length : 0.0f;
+  });
+}
+
+void Geometry::calcVertexToFaceAdjacency(const vec_pt<uint32_t> &triangles,
+                                         const size_t nNodes,
+                                         std::vector<uint32_t> &offsets,
+                                         std::vector<uint32_t> &faceIds) {
+  const int64_t nCorners = static_cast<int64_t>(triangles->size() / 3 * 3);
+  const uint32_t *nodeIds = triangles->data();
+
+  // Count faces per vertex
+  offsets.assign(nNodes + 1, 0U);
 
-  // Calc bary centric coords of each triangle
-  const vec_pt<float> &baryCentricCoords = calcBaryCentricCoord(originalTriangles, vertexCoords);
+  // NOTE: A plain increment per corner, which is cheaper serially than with atomics
+  for (int64_t iCorner = 0; iCorner < nCorners; ++iCorner) {
+    offsets[nodeIds[iCorner] + 1]++;
+  }
+
+  // Prefix sum
+  for (size_t iNode = 0; iNode < nNodes; ++iNode) {
+    offsets[iNode + 1] += offsets[iNode];
+  }
 
-  // Calc model scale
-  const auto [minCoords, maxCoords] = calcModelBounds(vertexCoords);
+  // Scatter
+  std::vector<std::atomic<uint32_t>> cursors(nNodes);
 
-  // Create bucket
-  TriangleBucket bucket;
+  parallelFor(0, static_cast<int64_t>(nNodes), [&](const int64_t iNode) {
+    cursors[iNode].store(offsets[iNode], std::memory_order_relaxed);
+  });
 
-  const float modelWidhtX = maxCoords[0] - minCoords[0];
-  const float modelWidhtY = maxCoords[1] - minCoords[1];
-  const float modelWidhtZ = maxCoords[2] - minCoords[2];
-  const float maxModelWidth = std::max(std::max(modelWidhtX, modelWidhtY), modelWidhtZ);
-  const float interval = maxModelWidth / (float)nDivsBucket;
+  faceIds.resize(nCorners);
 
-  bucket.initBucket(interval, minCoords, maxCoords);
+  parallelFor(0, nCorners, [&](const int64_t iCorner) {
+    const uint32_t slot = cursors[nodeIds[iCorner]].fetch_add(1U, std::memory_order_relaxed);
+    faceIds[slot] = static_cast<uint32_t>(iCorner / 3);
+  });
 
-  // Register to bucket
-  for (uint32_t iTriangle = 0U; iTriangle < nTriangles; ++iTriangle) {
-    const uint32_t offset = 3U * iTriangle;
-    const float baryCenterX = (*baryCentricCoords)[offset + 0U];
-    const float baryCenterY = (*baryCentricCoords)[offset + 1U];
-    const float baryCenterZ = (*baryCentricCoords)[offset + 2U];
-    bucket.addToBucket(baryCenterX, baryCenterY, baryCenterZ, iTriangle);
-  }
+  // NOTE: The scatter order depends on the threads. Sort so that sums over the faces are reproducible.
+  parallelFor(0, static_cast<int64_t>(nNodes), [&](const int64_t iNode) {
+    std::sort(faceIds.begin() + offsets[iNode], faceIds.begin() + offsets[iNode + 1]);
+  });
+}
+
+vecf_pt Geometry::calcVertexNormals(const vecf_pt &vertexCoords,
+                                    const vec_pt<uint32_t> &triangles) {
+  const size_t nNodes = vertexCoords->size() / 3;
 
-  // Extract surface
-  vec_pt<uint32_t> surfaceTriangles = std::make_shared<std::vector<uint32_t>>();
+  FaceNormals faceNormals;
+  calcFaceNormals(vertexCoords, triangles, faceNormals);
 
-  for (uint32_t iTriangle = 0U; iTriangle < nTriangles; ++iTriangle) {
-    bool isSurface = true;
+  std::vector<uint32_t> offsets, faceIds;
+  calcVertexToFaceAdjacency(triangles, nNodes, offsets, faceIds);
 
-    const uint32_t iOffset = 3U * iTriangle;
-    uint32_t iIndex0 = (*originalTriangles)[iOffset + 0U];
-    uint32_t iIndex1 = (*originalTriangles)[iOffset + 1U];
-    uint32_t iIndex2 = (*originalTriangles)[iOffset + 2U];
+  vecf_pt vertexNormals = std::make_shared<std::vector<float>>(3 * nNodes, 0.0f);
+  float *normals = vertexNormals->data();
 
-    const auto &idsInBucket = bucket.getIdsInBucket((*baryCentricCoords)[iOffset + 0U],
-                                                    (*baryCentricCoords)[iOffset + 1U],
-                                                    (*baryCentricCoords)[iOffset + 2U]);
-    const uint32_t nInBucket = static_cast<uint32_t>(idsInBucket->size());
+  parallelFor(0, static_cast<int64_t>(nNodes), [&](const int64_t iNode) {
+    float x = 0.0f, y = 0.0f, z = 0.0f;
 
-    sort3Elems(iIndex0, iIndex1, iIndex2);
+    for (uint32_t iAdjacent = offsets[iNode]; iAdjacent < offsets[iNode + 1]; ++iAdjacent) {
+      const uint32_t iFace = faceIds[iAdjacent];
+      x += faceNormals.x[iFace];
+      y += faceNormals.y[iFace];
+      z += faceNormals.z[iFace];
+    }
 
-    for (uint32_t jTriangle = 0U; jTriangle < nInBucket; ++jTriangle) {
-      const uint32_t id = (*idsInBucket)[jTriangle];
+    const float length = std::sqrt(x * x + y * y + z * z);
 
-      if (id == iTriangle) {
-        continue;
+    if (length > 0.0f) {
+      normals[3 * iNode + 0] = x / length;
+      normals[3 * iNode + 1] = y / length;
+      normals[3 * iNode + 2] = z / length;
+    }
+  });
+
+  return vertexNormals;
+}
+
+vecf_pt Geometry::calcCornerNormals(const vecf_pt &vertexCoords,
+                                    const vec_pt<uint32_t> &triangles,
+                                    const float creaseAngle) {
+  const size_t nNodes = vertexCoords->size() / 3;
+  const int64_t nTriangles = static_cast<int64_t>(triangles->size() / 3);
+  const uint32_t *nodeIds = triangles->data();
+
+  FaceNormals faceNormals;
+  calcFaceNormals(vertexCoords, triangles, faceNormals);
+
+  std::vector<uint32_t> offsets, faceIds;
+  calcVertexToFaceAdjacency(triangles, nNodes, offsets, faceIds);
+
+  const float cosCreaseAngle = std::cos(creaseAngle);
+
+  vecf_pt cornerNormals = std::make_shared<std::vector<float>>(9 * static_cast<size_t>(nTriangles), 0.0f);
+  float *normals = cornerNormals->data();
+
+  parallelFor(0, nTriangles, [&](const int64_t iTriangle) {
+    const float unitX = faceNormals.x[iTriangle] * faceNormals.invLength[iTriangle];
+    const float unitY = faceNormals.y[iTriangle] * faceNormals.invLength[iTriangle];
+    const float unitZ = faceNormals.z[iTriangle] * faceNormals.invLength[iTriangle];
+
+    for (int64_t iCorner = 3 * iTriangle; iCorner < 3 * iTriangle + 3; ++iCorner) {
+      const uint32_t iNode = nodeIds[iCorner];
+      float x = 0.0f, y = 0.0f, z = 0.0f;
+
+      for (uint32_t iAdjacent = offsets[iNode]; iAdjacent < offsets[iNode + 1]; ++iAdjacent) {
+        const uint32_t iFace = faceIds[iAdjacent];
+        const float cosAngle = (faceNormals.x[iFace] * unitX + faceNormals.y[iFace] * unitY + faceNormals.z[iFace] * unitZ) * faceNormals.invLength[iFace];
+
+        if (static_cast<int64_t>(iFace) == iTriangle || cosAngle >= cosCreaseAngle) {
+          x += faceNormals.x[iFace];
+          y += faceNormals.y[iFace];
+          z += faceNormals.z[iFace];
+        }
       }
 
-      const uint32_t jOffset = 3U * id;
+      if (x == 0.0f && y == 0.0f && z == 0.0f) {
+        // NOTE: The own face is degenerate. Fall back to all the faces around the vertex.
+        for (uint32_t iAdjacent = offsets[iNode]; iAdjacent < offsets[iNode + 1]; ++iAdjacent) {
+          const uint32_t iFace = faceIds[iAdjacent];
+          x += faceNormals.x[iFace];
+          y += faceNormals.y[iFace];
+          z += faceNormals.z[iFace];
+        }
+      }
+
+      const float length = std::sqrt(x * x + y * y + z * z);
+
+      if (length > 0.0f) {
+        normals[3 * iCorner + 0] = x / length;
+        normals[3 * iCorner + 1] = y / length;
+        normals[3 * iCorner + 2] = z / length;
+      }
+    }
+  });
 
-      uint32_t jIndex0 = (*originalTriangles)[jOffset + 0U];
-      uint32_t jIndex1 = (*originalTriangles)[jOffset + 1U];
-      uint32_t jIndex2 = (*originalTriangles)[jOffset + 2U];
-      sort3Elems(jIndex0, jIndex1, jIndex2);
+  return cornerNormals;
+}
 
-      if (iIndex0 == jIndex0 && iIndex1 == jIndex1 && iIndex2 == jIndex2) {
-        isSurface = false;
+std::vector<uint32_t> Geometry::calcCreaseGroups(const vec_pt<uint32_t> &triangles,
+                                                 const size_t nNodes,
+                                                 const vecf_pt &cornerNormals) {
+  const uint32_t invalidCorner = std::numeric_limits<uint32_t>::max();
+  const size_t nCorners = triangles->size();
+  const float *normals = cornerNormals->data();
+
+  // NOTE: Heads of the first corners of the groups at each node, chained through 'nextGroupHeads'.
+  //       A node has only a few groups, so the chains are short.
+  std::vector<uint32_t> groupHeads(nNodes, invalidCorner);
+  std::vector<uint32_t> nextGroupHeads(nCorners, invalidCorner);
+  std::vector<uint32_t> firstCorners(nCorners);
+
+  for (size_t iCorner = 0; iCorner < nCorners; ++iCorner) {
+    const uint32_t iNode = (*triangles)[iCorner];
+    const float *normal = normals + 3 * iCorner;
+
+    uint32_t iFirstCorner = groupHeads[iNode];
+    while (iFirstCorner != invalidCorner) {
+      // NOTE: Corners in the same group sum the same faces in the same order, so their normals are bitwise equal
+      const float *firstNormal = normals + 3 * static_cast<size_t>(iFirstCorner);
+      if (normal[0] == firstNormal[0] && normal[1] == firstNormal[1] && normal[2] == firstNormal[2]) {
         break;
       }
+      iFirstCorner = nextGroupHeads[iFirstCorner];
     }
 
-    if (isSurface) {
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 0U]);
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 1U]);
-      surfaceTriangles->push_back((*originalTriangles)[iOffset + 2U]);
+    if (iFirstCorner == invalidCorner) {
+      iFirstCorner = static_cast<uint32_t>(iCorner);
+      nextGroupHeads[iCorner] = groupHeads[iNode];
+      groupHeads[iNode] = iFirstCorner;
     }
+
+    firstCorners[iCorner] = iFirstCorner;
   }
 
-  return surfaceTriangles;
+  return firstCorners;
 }
 
-template <class Coord_t>
-void Geometry::calcVertexNormals(const int &nNodes,
-                                 const vec_pt<Coord_t> &triangles) {
-  // Count
-  ReservedArrayi countNodes(nNodes);
-  for (const auto &triangleId : *triangles) {
-    countNodes.setValue(triangleId, countNodes.getValue(triangleId) + 1);
+template <class IsCompatible>
+std::vector<uint32_t> Geometry::calcWeldMap(const float *coords,
+                                            const size_t nVertices,
+                                            const float threshold,
+                                            IsCompatible &&isCompatible) {
+  const int64_t nPoints = static_cast<int64_t>(nVertices);
+
+  // NOTE:
+  // Any cell size not smaller than the threshold finds all partners in the 3x3x3 neighborhood.
+  // Cells of the threshold size keep the candidates of a vertex to the vertices nearby, however large the model is.
+  SparseGrid grid;
+  grid.build(coords, nVertices, threshold);
+
+  // Find the lowest-indexed partner of each vertex
+  std::vector<uint32_t> weldMap(nPoints);
+
+  parallelFor(0, (int64_t)grid.getNumCells(), [&](const int64_t iCell) {
+    // NOTE: The neighbor cells are shared by all vertices in the cell
+    std::array<SparseGrid::CellRange, 27> neighborCells;
+    int nNeighborCells = 0;
+
+    grid.forEachNeighborCell(static_cast<uint32_t>(iCell), [&](const SparseGrid::CellRange &range) {
+      neighborCells[nNeighborCells++] = range;
+    });
+
+    for (const uint32_t &iPoint : grid.getIdsInCell(static_cast<uint32_t>(iCell))) {
+      const float *coord = coords + 3 * (int64_t)iPoint;
+      uint32_t partner = iPoint;
+
+      for (int iNeighborCell = 0; iNeighborCell < nNeighborCells; ++iNeighborCell) {
+        for (const uint32_t &jPoint : neighborCells[iNeighborCell]) {
+          // NOTE: Ids in a cell are in ascending order
+          if (jPoint >= partner) {
+            break;
+          }
+
+          const float *jCoord = coords + 3 * (int64_t)jPoint;
+
+          if (std::abs(coord[0] - jCoord[0]) <= threshold &&  // X
+              std::abs(coord[1] - jCoord[1]) <= threshold &&  // Y
+              std::abs(coord[2] - jCoord[2]) <= threshold &&  // Z
+              isCompatible(iPoint, jPoint)) {
+            partner = jPoint;
+          }
+        }
+      }
+
+      weldMap[iPoint] = partner;
+    }
+  });
+
+  // Resolve chains. Partners always have lower indices, so one forward pass is enough.
+  for (int64_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+    weldMap[iPoint] = weldMap[weldMap[iPoint]];
   }
+
+  return weldMap;
 }
 
 void Geometry::removeDuplecatedVertices(
@@ -357,49 +713,88 @@ void Geometry::removeDuplecatedVertices(
   distVertices->clear();
   distIndices->clear();
 
-  const int nSrcCoords = srcVertices->size() / 3;
+  const size_t nSrcCoords = srcVertices->size() / 3;
+
+  const std::vector<uint32_t> &weldMap = calcWeldMap(srcVertices->data(),
+                                                     nSrcCoords,
+                                                     threshold,
+                                                     [](const uint32_t &, const uint32_t &) { return true; });
 
   std::vector<int> indexMap(nSrcCoords);  // "Vertex Id" to "non-deplication id"
 
-  for (int iSrcCoord = 0; iSrcCoord < nSrcCoords; ++iSrcCoord) {
-    const int srcOffset = 3 * iSrcCoord;
-    const float srcCoordX = (*srcVertices)[srcOffset + 0];
-    const float srcCoordY = (*srcVertices)[srcOffset + 1];
-    const float srcCoordZ = (*srcVertices)[srcOffset + 2];
-
-    bool isDeplicated = false;
-    const int indexMapSize = iSrcCoord;
-    int iCoord;
-
-    for (iCoord = 0; iCoord < indexMapSize; ++iCoord) {
-      const int iOffset = 3 * iCoord;
-      const float iCoordX = (*distVertices)[iOffset + 0];
-      const float iCoordY = (*distVertices)[iOffset + 1];
-      const float iCoordZ = (*distVertices)[iOffset + 2];
-
-      if (std::abs(srcCoordX - iCoordX) < threshold &&  // X
-          std::abs(srcCoordY - iCoordY) < threshold &&  // Y
-          std::abs(srcCoordZ - iCoordZ) < threshold     // Z
-      ) {
-        isDeplicated = true;
-        break;
-      }
+  for (size_t iSrcCoord = 0; iSrcCoord < nSrcCoords; ++iSrcCoord) {
+    if (weldMap[iSrcCoord] == iSrcCoord) {
+      const size_t srcOffset = 3 * iSrcCoord;
+      indexMap[iSrcCoord] = static_cast<int>(distVertices->size() / 3);
+      distVertices->push_back((*srcVertices)[srcOffset + 0]);
+      distVertices->push_back((*srcVertices)[srcOffset + 1]);
+      distVertices->push_back((*srcVertices)[srcOffset + 2]);
+    } else {
+      indexMap[iSrcCoord] = indexMap[weldMap[iSrcCoord]];
     }
+  }
 
-    if (isDeplicated) {
-      indexMap[iSrcCoord] = iCoord;
+  const size_t nIndices = srcIndices->size();
+  distIndices->resize(nIndices);
+
+  for (size_t index = 0; index < nIndices; ++index) {
+    (*distIndices)[index] = indexMap[(*srcIndices)[index]];
+  }
+}
+
+void Geometry::removeDuplecatedVertices(
+    const VertexArray_t &srcVertices,
+    const IndexArray_t &srcIndices,
+    VertexArray_t &distVertices,
+    IndexArray_t &distIndices,
+    const float &threshold) {
+  distVertices->clear();
+  distIndices->clear();
+
+  const size_t nSrcVertices = srcVertices->size();
+
+  std::vector<float> coords(3 * nSrcVertices);
+  for (size_t iVertex = 0; iVertex < nSrcVertices; ++iVertex) {
+    coords[3 * iVertex + 0] = (*srcVertices)[iVertex].position.x;
+    coords[3 * iVertex + 1] = (*srcVertices)[iVertex].position.y;
+    coords[3 * iVertex + 2] = (*srcVertices)[iVertex].position.z;
+  }
+
+  const auto isClose = [](const float *left, const float *right, const int nElems) {
+    for (int iElem = 0; iElem < nElems; ++iElem) {
+      if (std::abs(left[iElem] - right[iElem]) > WELD_ATTRIBUTE_THRESHOLD) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const std::vector<uint32_t> &weldMap = calcWeldMap(coords.data(),
+                                                     nSrcVertices,
+                                                     threshold,
+                                                     [&](const uint32_t &i, const uint32_t &j) {
+                                                       const Vertex &vi = (*srcVertices)[i];
+                                                       const Vertex &vj = (*srcVertices)[j];
+                                                       return isClose(&vi.color.x, &vj.color.x, 3) &&
+                                                              isClose(&vi.normal.x, &vj.normal.x, 3) &&
+                                                              isClose(&vi.uv.x, &vj.uv.x, 2);
+                                                     });
+
+  std::vector<uint32_t> indexMap(nSrcVertices);  // "Vertex Id" to "non-deplication id"
+
+  for (size_t iSrcVertex = 0; iSrcVertex < nSrcVertices; ++iSrcVertex) {
+    if (weldMap[iSrcVertex] == iSrcVertex) {
+      indexMap[iSrcVertex] = static_cast<uint32_t>(distVertices->size());
+      distVertices->push_back((*srcVertices)[iSrcVertex]);
     } else {
-      indexMap[iSrcCoord] = distVertices->size() / 3;
-      distVertices->push_back(srcCoordX);
-      distVertices->push_back(srcCoordY);
-      distVertices->push_back(srcCoordZ);
+      indexMap[iSrcVertex] = indexMap[weldMap[iSrcVertex]];
     }
   }
 
-  const int nIndices = srcIndices->size();
+  const size_t nIndices = srcIndices->size();
   distIndices->resize(nIndices);
 
-  for (int index = 0; index < nIndices; ++index) {
+  for (size_t index = 0; index < nIndices; ++index) {
     (*distIndices)[index] = indexMap[(*srcIndices)[index]];
   }
 }
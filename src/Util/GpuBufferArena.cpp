@@ -0,0 +1,210 @@
+#include <SimView/Util/GpuBufferArena.hpp>
+
+namespace simview {
+namespace util {
+
+// ==================================================================================================
+// Free list
+// ==================================================================================================
+GpuBufferArena::FreeList::FreeList()
+    : _freeRanges(),
+      _capacity(0) {}
+
+size_t GpuBufferArena::FreeList::allocate(const size_t size) {
+  for (auto iter = _freeRanges.begin(); iter != _freeRanges.end(); ++iter) {
+    if (iter->second < size) {
+      continue;
+    }
+
+    const size_t offset = iter->first;
+    const size_t remainingSize = iter->second - size;
+
+    _freeRanges.erase(iter);
+    if (remainingSize > 0) {
+      _freeRanges.emplace(offset + size, remainingSize);
+    }
+
+    return offset;
+  }
+
+  return INVALID_OFFSET;
+}
+
+void GpuBufferArena::FreeList::release(const size_t offset, const size_t size) {
+  if (size == 0) {
+    return;
+  }
+
+  size_t mergedSize = size;
+
+  // Merge with the next free range
+  const auto next = _freeRanges.find(offset + size);
+  if (next != _freeRanges.end()) {
+    mergedSize += next->second;
+    _freeRanges.erase(next);
+  }
+
+  // Merge with the previous free range
+  auto prev = _freeRanges.lower_bound(offset);
+  if (prev != _freeRanges.begin()) {
+    --prev;
+    if (prev->first + prev->second == offset) {
+      prev->second += mergedSize;
+      return;
+    }
+  }
+
+  _freeRanges.emplace(offset, mergedSize);
+}
+
+void GpuBufferArena::FreeList::grow(const size_t capacity) {
+  if (capacity <= _capacity) {
+    return;
+  }
+
+  const size_t oldCapacity = _capacity;
+  _capacity = capacity;
+  release(oldCapacity, capacity - oldCapacity);
+}
+
+// ==================================================================================================
+// Arena
+// ==================================================================================================
+GpuBufferArena::GpuBufferArena(const VertexLayout& vertexLayout)
+    : _vertexLayout(vertexLayout),
+      _vaoId(),
+      _vertexBufferId(),
+      _indexBufferId(),
+      _vertexRanges(),
+      _indexRanges(),
+      _nUsedVertices(0),
+      _nUsedIndices(0),
+      _nRanges(0) {
+  _vaoId.create();
+
+  _vertexBufferId = reallocateBuffer(0, 0, _vertexLayout.getStride() * INITIAL_NUM_VERTICES);
+  _indexBufferId = reallocateBuffer(0, 0, sizeof(uint32_t) * INITIAL_NUM_INDICES);
+  _vertexRanges.grow(INITIAL_NUM_VERTICES);
+  _indexRanges.grow(INITIAL_NUM_INDICES);
+
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
+  glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+  _vertexLayout.setupAttributes();
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+  GLStateCache::getInstance().bindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+GpuBufferArena::Range GpuBufferArena::allocate(const std::vector<uint8_t>& packedVertices,
+                                               const std::vector<uint32_t>& indices) {
+  const GLuint stride = _vertexLayout.getStride();
+  const size_t nVertices = packedVertices.size() / stride;
+  const size_t nIndices = indices.size();
+
+  Range range;
+  if (nVertices == 0 || nIndices == 0) {
+    return range;
+  }
+
+  // ================================================================================================
+  // Find free ranges
+  // ================================================================================================
+  size_t baseVertex = _vertexRanges.allocate(nVertices);
+  if (baseVertex == FreeList::INVALID_OFFSET) {
+    growVertexBuffer(nVertices);
+    baseVertex = _vertexRanges.allocate(nVertices);
+  }
+
+  size_t firstIndex = _indexRanges.allocate(nIndices);
+  if (firstIndex == FreeList::INVALID_OFFSET) {
+    growIndexBuffer(nIndices);
+    firstIndex = _indexRanges.allocate(nIndices);
+  }
+
+  // ================================================================================================
+  // Upload
+  // ================================================================================================
+  // NOTE: Copied through the copy target, so that the element buffer binding of the current VAO is not changed
+  glBindBuffer(GL_COPY_WRITE_BUFFER, _vertexBufferId);
+  glBufferSubData(GL_COPY_WRITE_BUFFER, stride * baseVertex, stride * nVertices, packedVertices.data());
+  glBindBuffer(GL_COPY_WRITE_BUFFER, _indexBufferId);
+  glBufferSubData(GL_COPY_WRITE_BUFFER, sizeof(uint32_t) * firstIndex, sizeof(uint32_t) * nIndices, indices.data());
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  range.baseVertex = (GLuint)baseVertex;
+  range.nVertices = (GLuint)nVertices;
+  range.firstIndex = (GLuint)firstIndex;
+  range.nIndices = (GLuint)nIndices;
+
+  _nUsedVertices += nVertices;
+  _nUsedIndices += nIndices;
+  ++_nRanges;
+
+  return range;
+}
+
+void GpuBufferArena::release(const Range& range) {
+  if (range.nIndices == 0) {
+    return;
+  }
+
+  _vertexRanges.release(range.baseVertex, range.nVertices);
+  _indexRanges.release(range.firstIndex, range.nIndices);
+
+  _nUsedVertices -= range.nVertices;
+  _nUsedIndices -= range.nIndices;
+  --_nRanges;
+}
+
+void GpuBufferArena::growVertexBuffer(const size_t nVertices) {
+  const GLuint stride = _vertexLayout.getStride();
+  const size_t oldCapacity = _vertexRanges.getCapacity();
+  const size_t newCapacity = std::max(2 * oldCapacity, oldCapacity + nVertices);
+
+  _vertexBufferId = reallocateBuffer(_vertexBufferId, stride * oldCapacity, stride * newCapacity);
+  _vertexRanges.grow(newCapacity);
+
+  // NOTE: The attribute pointers keep the buffer bound at the time they were set up
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
+  glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+  _vertexLayout.setupAttributes();
+  GLStateCache::getInstance().bindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  LOG_INFO("[Buffer Arena] Vertex capacity: " + std::to_string(oldCapacity) + " -> " + std::to_string(newCapacity));
+}
+
+void GpuBufferArena::growIndexBuffer(const size_t nIndices) {
+  const size_t oldCapacity = _indexRanges.getCapacity();
+  const size_t newCapacity = std::max(2 * oldCapacity, oldCapacity + nIndices);
+
+  _indexBufferId = reallocateBuffer(_indexBufferId, sizeof(uint32_t) * oldCapacity, sizeof(uint32_t) * newCapacity);
+  _indexRanges.grow(newCapacity);
+
+  GLStateCache::getInstance().bindVertexArray(_vaoId);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+  GLStateCache::getInstance().bindVertexArray(0);
+
+  LOG_INFO("[Buffer Arena] Index capacity: " + std::to_string(oldCapacity) + " -> " + std::to_string(newCapacity));
+}
+
+GLBuffer GpuBufferArena::reallocateBuffer(const GLuint bufferId, const size_t nCopiedBytes, const size_t nBytes) {
+  GLBuffer newBuffer;
+  newBuffer.create();
+  glBindBuffer(GL_COPY_WRITE_BUFFER, newBuffer);
+  glBufferData(GL_COPY_WRITE_BUFFER, nBytes, nullptr, GL_STATIC_DRAW);
+
+  if (bufferId != 0) {
+    glBindBuffer(GL_COPY_READ_BUFFER, bufferId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, nCopiedBytes);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  }
+
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  // NOTE: The old buffer is released when the caller replaces its handle
+  return newBuffer;
+}
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,256 @@
+#include <SimView/Util/MappedTextFile.hpp>
+
+#if defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace simview {
+namespace util {
+
+MappedTextFile::MappedTextFile()
+    : _data(nullptr),
+      _fileSize(0),
+      _chunkLineOffsets(),
+#if defined(_WIN64)
+      _fileHandle(INVALID_HANDLE_VALUE),
+      _mappingHandle(nullptr)
+#else
+      _fileDescriptor(-1)
+#endif
+{
+}
+
+MappedTextFile::~MappedTextFile() {
+  unmap();
+}
+
+bool MappedTextFile::map(const std::string& filePath) {
+#if defined(_WIN64)
+  _fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (_fileHandle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx((HANDLE)_fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+    return false;
+  }
+  _fileSize = (size_t)fileSize.QuadPart;
+
+  _mappingHandle = CreateFileMappingA((HANDLE)_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (_mappingHandle == nullptr) {
+    return false;
+  }
+
+  _data = (const char*)MapViewOfFile((HANDLE)_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  return _data != nullptr;
+#else
+  _fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+  if (_fileDescriptor < 0) {
+    return false;
+  }
+
+  struct stat fileStat;
+  if (::fstat(_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+    return false;
+  }
+  _fileSize = (size_t)fileStat.st_size;
+
+  void* mapped = ::mmap(nullptr, _fileSize, PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  // NOTE: Every thread walks its own chunk front to back
+  ::madvise(mapped, _fileSize, MADV_SEQUENTIAL);
+
+  _data = (const char*)mapped;
+  return true;
+#endif
+}
+
+void MappedTextFile::unmap() {
+#if defined(_WIN64)
+  if (_data != nullptr) {
+    UnmapViewOfFile(_data);
+  }
+  if (_mappingHandle != nullptr) {
+    CloseHandle((HANDLE)_mappingHandle);
+  }
+  if (_fileHandle != INVALID_HANDLE_VALUE) {
+    CloseHandle((HANDLE)_fileHandle);
+  }
+  _mappingHandle = nullptr;
+  _fileHandle = INVALID_HANDLE_VALUE;
+#else
+  if (_data != nullptr) {
+    ::munmap((void*)_data, _fileSize);
+  }
+  if (_fileDescriptor >= 0) {
+    ::close(_fileDescriptor);
+  }
+  _fileDescriptor = -1;
+#endif
+  _data = nullptr;
+  _fileSize = 0;
+}
+
+void MappedTextFile::countLines() {
+  const int64_t nChunks = (int64_t)((_fileSize + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+  _chunkLineOffsets.assign(nChunks + 1, 0);
+
+  parallelFor(
+      0,
+      nChunks,
+      [&](const int64_t iChunk) {
+        const char* cursor = _data + (size_t)iChunk * CHUNK_SIZE;
+        const char* chunkEnd = _data + std::min((size_t)(iChunk + 1) * CHUNK_SIZE, _fileSize);
+
+        size_t nLineBreaks = 0;
+        while ((cursor = (const char*)std::memchr(cursor, '\n', chunkEnd - cursor)) != nullptr) {
+          ++nLineBreaks;
+          ++cursor;
+        }
+
+        _chunkLineOffsets[iChunk + 1] = nLineBreaks;
+      },
+      1);
+
+  // Prefix sum
+  for (int64_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+    _chunkLineOffsets[iChunk + 1] += _chunkLineOffsets[iChunk];
+  }
+}
+
+std::shared_ptr<MappedTextFile> MappedTextFile::open(const std::string& filePath, const bool toCountLines) {
+  std::shared_ptr<MappedTextFile> file(new MappedTextFile());
+
+  if (!file->map(filePath)) {
+    LOG_ERROR("Failed to map file: " + filePath);
+    return nullptr;
+  }
+
+  if (toCountLines) {
+    file->countLines();
+  }
+
+  return file;
+}
+
+size_t MappedTextFile::getNumLines() const {
+  if (_chunkLineOffsets.empty()) {
+    return 0;
+  }
+
+  const size_t nLineBreaks = _chunkLineOffsets.back();
+  return _data[_fileSize - 1] == '\n' ? nLineBreaks : nLineBreaks + 1;
+}
+
+bool MappedTextFile::getLine(const size_t iLine, const char*& begin, const char*& end) const {
+  if (iLine >= getNumLines()) {
+    return false;
+  }
+
+  const char* fileEnd = _data + _fileSize;
+  const char* lineBegin = _data;
+
+  if (iLine > 0) {
+    // Find the chunk which contains the preceding line break
+    const size_t iChunk = (size_t)(std::lower_bound(_chunkLineOffsets.begin(), _chunkLineOffsets.end(), iLine) - _chunkLineOffsets.begin()) - 1;
+
+    lineBegin = _data + iChunk * CHUNK_SIZE;
+    for (size_t iLineBreak = _chunkLineOffsets[iChunk]; iLineBreak < iLine; ++iLineBreak) {
+      lineBegin = (const char*)std::memchr(lineBegin, '\n', fileEnd - lineBegin) + 1;
+    }
+  }
+
+  const char* lineBreak = (const char*)std::memchr(lineBegin, '\n', fileEnd - lineBegin);
+
+  begin = lineBegin;
+  end = lineBreak == nullptr ? fileEnd : lineBreak;
+
+  return true;
+}
+
+size_t MappedTextFile::countTokens(const char* begin, const char* end) {
+  size_t nTokens = 0;
+  const char* cursor = skipSpaces(begin, end);
+
+  while (cursor < end) {
+    ++nTokens;
+
+    while (cursor < end && *cursor != ' ' && *cursor != '\t' && *cursor != '\r') {
+      ++cursor;
+    }
+
+    cursor = skipSpaces(cursor, end);
+  }
+
+  return nTokens;
+}
+
+/// @brief 'parseFloat' for both of 'float' and 'double'
+template <class T>
+static bool parseFloatingPoint(const char*& cursor, const char* end, T& value) {
+  cursor = MappedTextFile::skipSpaces(cursor, end);
+
+  if (cursor < end && *cursor == '+') {
+    ++cursor;
+  }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const std::from_chars_result result = std::from_chars(cursor, end, value, std::chars_format::general);
+  if (result.ec != std::errc()) {
+    return false;
+  }
+
+  cursor = result.ptr;
+  return true;
+#else
+  // NOTE: Floating-point 'std::from_chars' is not available in this standard library.
+  //       'strtof' and 'strtod' need a null-terminated string, so the token is copied to the stack.
+  char token[64];
+  size_t length = 0;
+
+  while (cursor + length < end && length < sizeof(token) - 1 &&
+         cursor[length] != ' ' && cursor[length] != '\t' && cursor[length] != '\r') {
+    token[length] = cursor[length];
+    ++length;
+  }
+  token[length] = '\0';
+
+  char* tokenEnd = nullptr;
+  if constexpr (std::is_same_v<T, float>) {
+    value = std::strtof(token, &tokenEnd);
+  } else {
+    value = std::strtod(token, &tokenEnd);
+  }
+
+  if (tokenEnd == token) {
+    return false;
+  }
+
+  cursor += tokenEnd - token;
+  return true;
+#endif
+}
+
+bool MappedTextFile::parseFloat(const char*& cursor, const char* end, float& value) {
+  return parseFloatingPoint(cursor, end, value);
+}
+
+bool MappedTextFile::parseFloat(const char*& cursor, const char* end, double& value) {
+  return parseFloatingPoint(cursor, end, value);
+}
+
+}  // namespace util
+}  // namespace simview
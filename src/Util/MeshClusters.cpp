@@ -0,0 +1,199 @@
+#include <SimView/Util/MeshClusters.hpp>
+
+namespace simview {
+namespace util {
+
+MeshClusters::MeshClusters()
+    : _clusters(),
+      _isClusterInside(),
+      _drawCounts(),
+      _drawOffsets(),
+      _nVisibleClusters(0) {}
+
+void MeshClusters::build(const std::vector<Vertex> &vertices,
+                         std::vector<uint32_t> &indices,
+                         const uint32_t maxTriangles) {
+  clear();
+
+  const int64_t nTriangles = (int64_t)indices.size() / 3;
+  if (nTriangles == 0 || maxTriangles == 0) {
+    return;
+  }
+
+  const auto calcCentroid = [&](const int64_t iTriangle) {
+    return (vertices[indices[3 * iTriangle + 0]].position +
+            vertices[indices[3 * iTriangle + 1]].position +
+            vertices[indices[3 * iTriangle + 2]].position) /
+           3.0f;
+  };
+
+  // ================================================================================================
+  // Sort the triangles by the Morton codes of their centroids
+  // ================================================================================================
+  using Bounds_t = std::pair<glm::vec3, glm::vec3>;
+
+  const Bounds_t centroidBounds = parallelReduce(
+      0,
+      nTriangles,
+      Bounds_t(glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest())),
+      [&](const int64_t iTriangle) {
+        const glm::vec3 centroid = calcCentroid(iTriangle);
+        return Bounds_t(centroid, centroid);
+      },
+      [](const Bounds_t &bounds0, const Bounds_t &bounds1) {
+        return Bounds_t(glm::min(bounds0.first, bounds1.first), glm::max(bounds0.second, bounds1.second));
+      });
+
+  const float maxCell = (float)((1u << MORTON_BITS) - 1);
+  const glm::vec3 extent = glm::max(centroidBounds.second - centroidBounds.first, glm::vec3(1e-20f));
+  const glm::vec3 cellScale = maxCell / extent;
+
+  // NOTE: The triangle index is kept in the lower half of a key, so that equal codes keep the input order
+  std::vector<uint64_t> keys(nTriangles);
+
+  parallelFor(0, nTriangles, [&](const int64_t iTriangle) {
+    const glm::vec3 cell = glm::clamp((calcCentroid(iTriangle) - centroidBounds.first) * cellScale, 0.0f, maxCell);
+    const uint32_t code = (expandBits((uint32_t)cell.x) << 2) | (expandBits((uint32_t)cell.y) << 1) | expandBits((uint32_t)cell.z);
+    keys[iTriangle] = ((uint64_t)code << 32) | (uint64_t)iTriangle;
+  });
+
+  parallelSort(keys.data(), keys.data() + nTriangles);
+
+  std::vector<uint32_t> sortedIndices(indices.size());
+
+  parallelFor(0, nTriangles, [&](const int64_t iTriangle) {
+    const uint64_t srcTriangle = keys[iTriangle] & 0xFFFFFFFFull;
+    sortedIndices[3 * iTriangle + 0] = indices[3 * srcTriangle + 0];
+    sortedIndices[3 * iTriangle + 1] = indices[3 * srcTriangle + 1];
+    sortedIndices[3 * iTriangle + 2] = indices[3 * srcTriangle + 2];
+  });
+
+  indices.swap(sortedIndices);
+
+  // ================================================================================================
+  // Split into clusters
+  // ================================================================================================
+  const int64_t nClusters = (nTriangles + maxTriangles - 1) / maxTriangles;
+  _clusters.resize(nClusters);
+
+  parallelFor(0, nClusters, [&](const int64_t iCluster) {
+    Cluster &cluster = _clusters[iCluster];
+    cluster.firstIndex = (uint32_t)(3 * iCluster * maxTriangles);
+    cluster.nIndices = (uint32_t)(3 * std::min<int64_t>(maxTriangles, nTriangles - iCluster * maxTriangles));
+
+    cluster.minCoords = vertices[indices[cluster.firstIndex]].position;
+    cluster.maxCoords = cluster.minCoords;
+    for (uint32_t iIndex = cluster.firstIndex + 1; iIndex < cluster.firstIndex + cluster.nIndices; ++iIndex) {
+      cluster.minCoords = glm::min(cluster.minCoords, vertices[indices[iIndex]].position);
+      cluster.maxCoords = glm::max(cluster.maxCoords, vertices[indices[iIndex]].position);
+    }
+  });
+
+  // ================================================================================================
+  // Statistics
+  // ================================================================================================
+  glm::vec3 minCoords = _clusters[0].minCoords;
+  glm::vec3 maxCoords = _clusters[0].maxCoords;
+  double sumDiagonal = 0.0;
+  for (const auto &cluster : _clusters) {
+    minCoords = glm::min(minCoords, cluster.minCoords);
+    maxCoords = glm::max(maxCoords, cluster.maxCoords);
+    sumDiagonal += glm::length(cluster.maxCoords - cluster.minCoords);
+  }
+
+  // NOTE: Average size of the clusters relative to the mesh. Smaller values mean tighter clusters.
+  const double meanRelativeSize = sumDiagonal / (double)nClusters / std::max((double)glm::length(maxCoords - minCoords), 1e-20);
+
+  LOG_INFO("[Cluster Info]");
+  LOG_INFO("  nClusters            = " + std::to_string(nClusters));
+  LOG_INFO("  triangles / cluster  = " + std::to_string((double)nTriangles / (double)nClusters));
+  LOG_INFO("  mean relative size   = " + std::to_string(meanRelativeSize));
+}
+
+void MeshClusters::clear() {
+  _clusters.clear();
+  _isClusterInside.clear();
+  _drawCounts.clear();
+  _drawOffsets.clear();
+  _nVisibleClusters = 0;
+}
+
+void MeshClusters::cull(const glm::mat4 &mvpMat) {
+  const Frustum frustum(mvpMat);
+  const int64_t nClusters = (int64_t)_clusters.size();
+
+  _isClusterInside.resize(nClusters);
+
+  parallelFor(
+      0,
+      nClusters,
+      [&](const int64_t iCluster) {
+        const Cluster &cluster = _clusters[iCluster];
+        _isClusterInside[iCluster] = frustum.intersects(cluster.minCoords, cluster.maxCoords) ? 1 : 0;
+      },
+      CULLING_GRAIN_SIZE);
+
+  // NOTE: Adjacent clusters are contiguous in the index buffer, so they are merged into one draw
+  _drawCounts.clear();
+  _drawOffsets.clear();
+  _nVisibleClusters = 0;
+
+  bool isPreviousInside = false;
+  for (int64_t iCluster = 0; iCluster < nClusters; ++iCluster) {
+    if (!_isClusterInside[iCluster]) {
+      isPreviousInside = false;
+      continue;
+    }
+
+    const Cluster &cluster = _clusters[iCluster];
+
+    if (isPreviousInside) {
+      _drawCounts.back() += (GLsizei)cluster.nIndices;
+    } else {
+      _drawCounts.push_back((GLsizei)cluster.nIndices);
+      _drawOffsets.push_back(reinterpret_cast<const void *>(sizeof(uint32_t) * (size_t)cluster.firstIndex));
+    }
+
+    isPreviousInside = true;
+    ++_nVisibleClusters;
+  }
+}
+
+void MeshClusters::draw() const {
+  if (_drawCounts.empty()) {
+    return;
+  }
+
+  glMultiDrawElements(GL_TRIANGLES, _drawCounts.data(), GL_UNSIGNED_INT, _drawOffsets.data(), (GLsizei)_drawCounts.size());
+}
+
+uint32_t MeshClusters::expandBits(const uint32_t value) {
+  // NOTE: Insert two zeros after each of the lower 10 bits
+  uint32_t bits = value & 0x3FFu;
+  bits = (bits * 0x00010001u) & 0xFF0000FFu;
+  bits = (bits * 0x00000101u) & 0x0F00F00Fu;
+  bits = (bits * 0x00000011u) & 0xC30C30C3u;
+  bits = (bits * 0x00000005u) & 0x49249249u;
+  return bits;
+}
+
+void MeshClusters::parallelSort(uint64_t *first, uint64_t *last) {
+  if (last - first <= PARALLEL_SORT_THRESHOLD) {
+    std::sort(first, last);
+    return;
+  }
+
+  uint64_t *middle = first + (last - first) / 2;
+
+  {
+    TaskGroup group;
+    group.run([first, middle]() { parallelSort(first, middle); });
+    parallelSort(middle, last);
+    group.wait();
+  }
+
+  std::inplace_merge(first, middle, last);
+}
+
+}  // namespace util
+}  // namespace simview
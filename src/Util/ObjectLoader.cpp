@@ -22,6 +22,9 @@ std::vector<std::string> ObjectLoader::getReadableExtensionList() {
   // Native support
   extensionList.push_back("las");
 
+  // Native support
+  extensionList.push_back("ply");
+
 #if defined(SIMVIEW_WITH_ASSIMP)
   std::string strExtensions;
 
@@ -39,7 +42,11 @@ std::vector<std::string> ObjectLoader::getReadableExtensionList() {
   for (std::string extension : tmpExtensions) {
     // Remove '.' at head
     extension.erase(extension.begin());
-    extensionList.push_back(extension);
+
+    // NOTE: Skip the formats which are read natively
+    if (std::find(extensionList.begin(), extensionList.end(), extension) == extensionList.end()) {
+      extensionList.push_back(extension);
+    }
   }
 #else
 
@@ -61,24 +68,30 @@ void ObjectLoader::readFromFile(const std::string &filePath,
                                 const float offsetX,
                                 const float offsetY,
                                 const float offsetZ,
-                                const bool autoScale) {
+                                const bool autoScale,
+                                const bool weldVertices,
+                                const bool indexed) {
   const std::string extension = FileUtil::extension(filePath);
 
   LOG_INFO("### Start loading object file: " + filePath);
 
   const auto startTime = std::chrono::system_clock::now();
 
-  {
+  const VertexCacheKey cacheKey = VertexCache::createKey(filePath, offsetX, offsetY, offsetZ, autoScale, weldVertices, indexed);
+
+  if (!VertexCache::load(cacheKey, vertices, indices)) {
     if (extension == ".msh") {
-      readMshFile(filePath, vertices, indices, offsetX, offsetY, offsetZ);
+      readMshFile(filePath, vertices, indices, offsetX, offsetY, offsetZ, indexed);
     } else if (extension == ".pch") {
-      readPchFile(filePath, vertices, indices, offsetX, offsetY, offsetZ);
+      readPchFile(filePath, vertices, indices, offsetX, offsetY, offsetZ, indexed);
     } else if (extension == ".las") {
       readLasFile(filePath, vertices, indices, offsetX, offsetY, offsetZ);
+    } else if (extension == ".ply") {
+      readPlyFile(filePath, vertices, indices, offsetX, offsetY, offsetZ, indexed);
     } else if (extension == ".vtk" || extension == ".vtu") {
-      readVtkFile(filePath, vertices, indices, offsetX, offsetY, offsetZ);
+      readVtkFile(filePath, vertices, indices, offsetX, offsetY, offsetZ, indexed);
     } else {
-      readObjFile(filePath, vertices, indices, offsetX, offsetY, offsetZ);
+      readObjFile(filePath, vertices, indices, offsetX, offsetY, offsetZ, indexed);
     }
 
     if (autoScale) {
@@ -90,13 +103,36 @@ void ObjectLoader::readFromFile(const std::string &filePath,
       const float modelScaleMax = std::max(modelScale.x, std::max(modelScale.y, modelScale.z));
 
       const float mag = 2.0f / modelScaleMax;
-      ObjectLoader::scaleObject(vertices, mag);
+      const glm::vec3 offset(offsetX, offsetY, offsetZ);
+
+      ObjectLoader::transformObject(vertices, createPlacementMatrix(minCoords, maxCoords, glm::vec3(mag), offset));
+    }
+
+    if (weldVertices) {
+      // Turn the de-indexed triangle soup into a shared-vertex mesh
+      glm::vec3 maxCoords, minCoords;
+      std::tie(minCoords, maxCoords) = ObjectLoader::getCorners(vertices);
+
+      const glm::vec3 modelScale = maxCoords - minCoords;
+      const float modelScaleMax = std::max(modelScale.x, std::max(modelScale.y, modelScale.z));
+
+      VertexArray_t weldedVertices = std::make_shared<std::vector<Vertex>>();
+      IndexArray_t weldedIndices = std::make_shared<std::vector<uint32_t>>();
+
+      Geometry::removeDuplecatedVertices(vertices, indices, weldedVertices, weldedIndices, WELD_RELATIVE_THRESHOLD * modelScaleMax);
+
+      LOG_INFO("Welded vertices: " + std::to_string(vertices->size()) + " -> " + std::to_string(weldedVertices->size()));
 
-      ObjectLoader::moveToOrigin(vertices);
-      ObjectLoader::translateObject(vertices, offsetX, offsetY, offsetZ);
+      vertices->swap(*weldedVertices);
+      indices->swap(*weldedIndices);
     }
+
+    VertexCache::store(cacheKey, vertices, indices);
   }
 
+  const size_t nBytes = sizeof(Vertex) * vertices->size() + sizeof(uint32_t) * indices->size();
+  LOG_INFO("Vertex and index memory: " + std::to_string((double)nBytes / (1024.0 * 1024.0)) + " [MiB]");
+
   const auto endTime = std::chrono::system_clock::now();
   const double elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
 
@@ -108,7 +144,8 @@ void ObjectLoader::readObjFile(const std::string &filePath,
                                IndexArray_t indices,
                                const float offsetX,
                                const float offsetY,
-                               const float offsetZ) {
+                               const float offsetZ,
+                               const bool indexed) {
 #if defined(SIMVIEW_WITH_ASSIMP)
   Assimp::Importer importer;
   unsigned int flag = 0;
@@ -117,6 +154,10 @@ void ObjectLoader::readObjFile(const std::string &filePath,
   flag |= aiProcess_RemoveRedundantMaterials;
   flag |= aiProcess_GenNormals;
 
+  if (indexed) {
+    flag |= aiProcess_JoinIdenticalVertices;
+  }
+
   const aiScene *scene = importer.ReadFile(filePath, flag);
 
   if (scene == nullptr) {
@@ -127,6 +168,42 @@ void ObjectLoader::readObjFile(const std::string &filePath,
   for (int iMesh = 0; iMesh < scene->mNumMeshes; ++iMesh) {
     aiMesh *mesh = scene->mMeshes[iMesh];
 
+    if (indexed) {
+      // Use the vertices of the mesh as they are
+      const uint32_t baseIndex = (uint32_t)vertices->size();
+
+      for (unsigned int index = 0; index < mesh->mNumVertices; ++index) {
+        glm::vec3 position = glm::vec3(mesh->mVertices[index].x, mesh->mVertices[index].y, mesh->mVertices[index].z);
+        glm::vec3 normal(0.0f), color(1.0f);
+        glm::vec2 texcoord(0.0f);
+
+        if (mesh->HasNormals()) {
+          normal = glm::vec3(mesh->mNormals[index].x, mesh->mNormals[index].y, mesh->mNormals[index].z);
+        }
+
+        if (mesh->HasTextureCoords(0)) {
+          texcoord = glm::vec2(mesh->mTextureCoords[0][index].x, mesh->mTextureCoords[0][index].y);
+        }
+
+        vertices->push_back(Vertex(position, color, normal, glm::vec3(0.0f), texcoord, 0.0f));
+      }
+
+      for (unsigned int iFace = 0; iFace < mesh->mNumFaces; ++iFace) {
+        const aiFace &face = mesh->mFaces[iFace];
+
+        if (face.mNumIndices != 3) {
+          // Skip points and lines
+          continue;
+        }
+
+        indices->push_back(baseIndex + face.mIndices[0]);
+        indices->push_back(baseIndex + face.mIndices[1]);
+        indices->push_back(baseIndex + face.mIndices[2]);
+      }
+
+      continue;
+    }
+
     for (int iFace = 0; iFace < mesh->mNumFaces; ++iFace) {
       const aiFace &face = mesh->mFaces[iFace];
 
@@ -186,11 +263,41 @@ void ObjectLoader::readObjFile(const std::string &filePath,
     throw std::runtime_error("Failed to load OBJ file: " + filePath);
   }
 
+  // =========================================================================================
+  // Calc normals of the corners without 'vn'
+  // =========================================================================================
+  vec_pt<uint32_t> cornerNodes = std::make_shared<std::vector<uint32_t>>();
+  bool isNormalMissing = false;
+
+  for (const auto &shape : shapes) {
+    for (const tinyobj::index_t &index : shape.mesh.indices) {
+      cornerNodes->push_back((uint32_t)std::max(index.vertex_index, 0));
+      isNormalMissing = isNormalMissing || index.normal_index < 0;
+    }
+  }
+
+  // NOTE: The indexed mode shares a vertex only between the corners in the same crease group
+  vecf_pt generatedNormals = nullptr;
+  std::vector<uint32_t> firstCorners;
+  if (isNormalMissing) {
+    const vecf_pt nodeCoords = std::make_shared<std::vector<float>>(attrib.vertices);
+    generatedNormals = Geometry::calcCornerNormals(nodeCoords, cornerNodes, SMOOTHING_CREASE_ANGLE);
+
+    if (indexed) {
+      firstCorners = Geometry::calcCreaseGroups(cornerNodes, attrib.vertices.size() / 3, generatedNormals);
+    }
+  }
+
   // Create vertex array
 
   glm::vec3 maxCoords(0.0f);
   glm::vec3 minCoords(0.0f);
 
+  // NOTE: Used in the indexed mode only. Maps a face corner to the vertex already emitted for it.
+  std::unordered_map<ObjCornerKey, uint32_t, ObjCornerKeyHash> cornerToVertex;
+
+  size_t iCornerHead = 0;
+
   for (int s = 0; s < shapes.size(); ++s) {
     const tinyobj::mesh_t &mesh = shapes[s].mesh;
 
@@ -198,6 +305,20 @@ void ObjectLoader::readObjFile(const std::string &filePath,
 
     for (int i = 0; i < nVertices; ++i) {
       const tinyobj::index_t &index = mesh.indices[i];
+      const size_t iCorner = iCornerHead + i;
+
+      if (indexed) {
+        const int firstCorner = (index.normal_index < 0 && generatedNormals != nullptr) ? (int)firstCorners[iCorner] : -1;
+        const ObjCornerKey key = {index.vertex_index, index.normal_index, index.texcoord_index, firstCorner};
+        const auto iter = cornerToVertex.find(key);
+
+        if (iter != cornerToVertex.end()) {
+          indices->push_back(iter->second);
+          continue;
+        }
+
+        cornerToVertex.emplace(key, (uint32_t)vertices->size());
+      }
 
       glm::vec3 position(0.0f), normal(0.0f), color(0.0f);
       glm::vec2 texcoord(0.0f);
@@ -218,22 +339,28 @@ void ObjectLoader::readObjFile(const std::string &filePath,
 
       if (index.normal_index >= 0) {
         normal = glm::vec3(attrib.normals[index.normal_index * 3 + 0], attrib.normals[index.normal_index * 3 + 1], attrib.normals[index.normal_index * 3 + 2]);
+      } else if (generatedNormals != nullptr) {
+        const size_t offset = 3 * iCorner;
+        normal = glm::vec3((*generatedNormals)[offset + 0], (*generatedNormals)[offset + 1], (*generatedNormals)[offset + 2]);
       }
 
       if (index.texcoord_index >= 0) {
         texcoord = glm::vec2(attrib.texcoords[index.texcoord_index * 2 + 0], attrib.texcoords[index.texcoord_index * 2 + 1]);
       }
 
-      const Vertex vertex(position, color, normal, BARY_CENTER[i % 3], texcoord, 0.0f);
+      const glm::vec3 bary = indexed ? glm::vec3(0.0f) : BARY_CENTER[i % 3];
+      const Vertex vertex(position, color, normal, bary, texcoord, 0.0f);
 
       indices->push_back((uint32_t)vertices->size());
       vertices->push_back(vertex);
     }
+
+    iCornerHead += nVertices;
   }
 #endif
 
   LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
-  LOG_INFO("Num of triangles: " + std::to_string(vertices->size() / 3));
+  LOG_INFO("Num of triangles: " + std::to_string(indices->size() / 3));
 }
 
 void ObjectLoader::readMshFile(const std::string &filePath,
@@ -241,50 +368,64 @@ void ObjectLoader::readMshFile(const std::string &filePath,
                                IndexArray_t indices,
                                const float offsetX,
                                const float offsetY,
-                               const float offsetZ) {
-  std::ifstream ifstream = std::ifstream(filePath, std::ios::in);
+                               const float offsetZ,
+                               const bool indexed) {
+  const MappedTextFile_t file = MappedTextFile::open(filePath);
 
-  if (ifstream) {
-    std::string buffer;
+  if (file) {
+    const auto startTime = std::chrono::system_clock::now();
+    const char *lineBegin = nullptr;
+    const char *lineEnd = nullptr;
 
     // =========================================================================================
     // Read elements
     // =========================================================================================
     // Read num elements
-    std::getline(ifstream, buffer);
-    const uint32_t nElements = std::stoul(buffer);
+    uint32_t nElements = 0U;
+    if (!file->getLine(0, lineBegin, lineEnd) || !MappedTextFile::parseInteger(lineBegin, lineEnd, nElements)) {
+      LOG_ERROR("Failed to read the number of elements.");
+      return;
+    }
 
     // Read elements
     vec_pt<uint32_t> elements = std::make_shared<std::vector<uint32_t>>();
-    int nNodesPerElement = -1;
+    uint32_t nNodesPerElement = 0U;
     std::vector<std::vector<uint32_t>> triangleIDs;
 
-    for (uint32_t iElement = 0U; iElement < nElements; ++iElement) {
-      std::getline(ifstream, buffer);
-      std::vector<std::string> tokens = StringUtil::splitText(buffer, ' ');
-
-      if (iElement == 0U) {
-        nNodesPerElement = tokens.size();
+    if (nElements > 0U) {
+      file->getLine(1, lineBegin, lineEnd);
+      nNodesPerElement = static_cast<uint32_t>(MappedTextFile::countTokens(lineBegin, lineEnd));
+
+      const auto iter = MSH_TRIANGLE_IDS.find(nNodesPerElement);
+      if (iter != MSH_TRIANGLE_IDS.end()) {
+        // Found
+        triangleIDs = iter->second;
+      } else {
+        // Not found
+        LOG_ERROR("Unsupported msh primitive type !");
+        return;
+      }
 
-        const auto iter = MSH_TRIANGLE_IDS.find(nNodesPerElement);
-        if (iter != MSH_TRIANGLE_IDS.end()) {
-          // Found
-          triangleIDs = iter->second;
-        } else {
-          // Not found
-          LOG_ERROR("Unsupported msh primitive type !");
-          return;
-        }
+      elements->resize(static_cast<size_t>(nNodesPerElement) * nElements);
+    }
 
-        elements->resize(nNodesPerElement * nElements);
-      }
+    uint32_t *elementData = elements->data();
 
+    const bool isElementsRead = file->forEachLine(1, nElements, [&](const size_t iElement, const char *begin, const char *end) {
       // Calc index offset
-      const int offset = nNodesPerElement * iElement;
+      const size_t offset = static_cast<size_t>(nNodesPerElement) * iElement;
 
       for (uint32_t iVertex = 0U; iVertex < nNodesPerElement; ++iVertex) {
-        (*elements)[offset + iVertex] = std::stoul(tokens[iVertex]);
+        if (!MappedTextFile::parseInteger(begin, end, elementData[offset + iVertex])) {
+          return false;
+        }
       }
+      return true;
+    });
+
+    if (!isElementsRead) {
+      LOG_ERROR("Failed to read elements.");
+      return;
     }
     LOG_INFO("Reading elements done.");
 
@@ -292,25 +433,43 @@ void ObjectLoader::readMshFile(const std::string &filePath,
     // Read vertex coords
     // =========================================================================================
     // Read num vertices
-    std::getline(ifstream, buffer);
-    const uint32_t nVertices = std::stoul(buffer);
+    const size_t verticesLine = 1 + static_cast<size_t>(nElements);
+
+    uint32_t nVertices = 0U;
+    if (!file->getLine(verticesLine, lineBegin, lineEnd) || !MappedTextFile::parseInteger(lineBegin, lineEnd, nVertices)) {
+      LOG_ERROR("Failed to read the number of vertices.");
+      return;
+    }
 
     // Read vertices
     vec_pt<float> vertexCoords = std::make_shared<std::vector<float>>();
-    vertexCoords->resize(3U * nVertices);
+    vertexCoords->resize(3U * static_cast<size_t>(nVertices));
 
-    for (uint32_t iVertex = 0U; iVertex < nVertices; ++iVertex) {
-      std::getline(ifstream, buffer);
-      std::vector<std::string> tokens = StringUtil::splitText(buffer, ' ');
+    float *vertexCoordData = vertexCoords->data();
 
-      const uint32_t offset = 3U * iVertex;
+    const bool isVerticesRead = file->forEachLine(verticesLine + 1, nVertices, [&](const size_t iVertex, const char *begin, const char *end) {
+      const size_t offset = 3U * iVertex;
 
-      (*vertexCoords)[offset + 0U] = std::stof(tokens[0]);
-      (*vertexCoords)[offset + 1U] = std::stof(tokens[1]);
-      (*vertexCoords)[offset + 2U] = std::stof(tokens[2]);
+      return MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 0U]) &&
+             MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 1U]) &&
+             MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 2U]);
+    });
+
+    if (!isVerticesRead) {
+      LOG_ERROR("Failed to read vertex coords.");
+      return;
     }
     LOG_INFO("Reading vertex coords done.");
 
+    logParsingThroughput(file->getFileSize(), startTime);
+
+    for (const uint32_t nodeId : *elements) {
+      if (nodeId >= nVertices) {
+        LOG_ERROR("Invalid vertex index in elements: " + std::to_string(nodeId));
+        return;
+      }
+    }
+
     // =========================================================================================
     // Triangulate
     // =========================================================================================
@@ -338,120 +497,48 @@ void ObjectLoader::readMshFile(const std::string &filePath,
     // =========================================================================================
     // Extract surface
     // =========================================================================================
-    const vec_pt<uint32_t> &surfaceTriangles = Geometry::extractSurfaceTriangle(300, triangles, vertexCoords);
+    const vec_pt<uint32_t> &surfaceTriangles = Geometry::extractSurfaceTriangle(triangles);
 
     const uint32_t nSurfaceTriangles = static_cast<uint32_t>(surfaceTriangles->size()) / 3U;
     LOG_INFO("nSurfaceTriangles: " + std::to_string(nSurfaceTriangles));
     LOG_INFO("Surface extraction done.");
 
-    // =========================================================================================
-    // Calc face normals
-    // =========================================================================================
-    vecf_pt faceNormal = std::make_shared<std::vector<float>>();
-    faceNormal->resize(3U * nSurfaceTriangles);
-
-    for (uint32_t iSurfaceTriangle = 0U; iSurfaceTriangle < nSurfaceTriangles; ++iSurfaceTriangle) {
-      const uint32_t offset = 3U * iSurfaceTriangle;
-
-      const uint32_t nodeIdOffset0 = 3U * (*surfaceTriangles)[offset + 0U];
-      const uint32_t nodeIdOffset1 = 3U * (*surfaceTriangles)[offset + 1U];
-      const uint32_t nodeIdOffset2 = 3U * (*surfaceTriangles)[offset + 2U];
-
-      const float relVec0X = (*vertexCoords)[nodeIdOffset1 + 0U] - (*vertexCoords)[nodeIdOffset0 + 0U];
-      const float relVec0Y = (*vertexCoords)[nodeIdOffset1 + 1U] - (*vertexCoords)[nodeIdOffset0 + 1U];
-      const float relVec0Z = (*vertexCoords)[nodeIdOffset1 + 2U] - (*vertexCoords)[nodeIdOffset0 + 2U];
-
-      const float relVec1X = (*vertexCoords)[nodeIdOffset2 + 0U] - (*vertexCoords)[nodeIdOffset0 + 0U];
-      const float relVec1Y = (*vertexCoords)[nodeIdOffset2 + 1U] - (*vertexCoords)[nodeIdOffset0 + 1U];
-      const float relVec1Z = (*vertexCoords)[nodeIdOffset2 + 2U] - (*vertexCoords)[nodeIdOffset0 + 2U];
-
-      // Calc outer product
-      // 0:   x y z x
-      // 1:   x y z x
-      float normalX, normalY, normalZ;
-      math::outerProduct(relVec0X, relVec0Y, relVec0Z,
-                         relVec1X, relVec1Y, relVec1Z,
-                         normalX, normalY, normalZ);
-
-      // Normalize
-      math::normalize(normalX, normalY, normalZ);
-
-      // Set
-      (*faceNormal)[offset + 0U] = normalX;
-      (*faceNormal)[offset + 1U] = normalY;
-      (*faceNormal)[offset + 2U] = normalZ;
-    }
-
-    // =========================================================================================
-    // Convert data to program compat format
-    // =========================================================================================
-    vertices->resize(nSurfaceTriangles * 3U);
-    indices->resize(nSurfaceTriangles * 3U);
-
-    for (uint32_t iTriangle = 0U; iTriangle < nSurfaceTriangles; ++iTriangle) {
-      const uint32_t offset = 3U * iTriangle;
-
-      const uint32_t vertexIdOffset0 = 3U * (*surfaceTriangles)[offset + 0U];
-      const uint32_t vertexIdOffset1 = 3U * (*surfaceTriangles)[offset + 1U];
-      const uint32_t vertexIdOffset2 = 3U * (*surfaceTriangles)[offset + 2U];
-
-      const glm::vec3 vertexCoord0 = glm::vec3((*vertexCoords)[vertexIdOffset0 + 0U],
-                                               (*vertexCoords)[vertexIdOffset0 + 1U],
-                                               (*vertexCoords)[vertexIdOffset0 + 2U]);
-      const glm::vec3 vertexCoord1 = glm::vec3((*vertexCoords)[vertexIdOffset1 + 0U],
-                                               (*vertexCoords)[vertexIdOffset1 + 1U],
-                                               (*vertexCoords)[vertexIdOffset1 + 2U]);
-      const glm::vec3 vertexCoord2 = glm::vec3((*vertexCoords)[vertexIdOffset2 + 0U],
-                                               (*vertexCoords)[vertexIdOffset2 + 1U],
-                                               (*vertexCoords)[vertexIdOffset2 + 2U]);
-
-      const glm::vec3 vertexNormal0 = glm::vec3((*faceNormal)[offset + 0U],
-                                                (*faceNormal)[offset + 1U],
-                                                (*faceNormal)[offset + 2U]);
-      const glm::vec3 vertexNormal1 = glm::vec3((*faceNormal)[offset + 0U],
-                                                (*faceNormal)[offset + 1U],
-                                                (*faceNormal)[offset + 2U]);
-      const glm::vec3 vertexNormal2 = glm::vec3((*faceNormal)[offset + 0U],
-                                                (*faceNormal)[offset + 1U],
-                                                (*faceNormal)[offset + 2U]);
-
-      const Vertex vertex0(vertexCoord0,
-                           glm::vec3(1.0f),
-                           vertexNormal0,
-                           BARY_CENTER[0],
-                           glm::vec2(0.0f),
-                           0.0f);
-      const Vertex vertex1(vertexCoord1,
-                           glm::vec3(1.0f),
-                           vertexNormal1,
-                           BARY_CENTER[1],
-                           glm::vec2(0.0f),
-                           0.0f);
-      const Vertex vertex2(vertexCoord2,
-                           glm::vec3(1.0f),
-                           vertexNormal2,
-                           BARY_CENTER[2],
-                           glm::vec2(0.0f),
-                           0.0f);
-
-      const uint32_t index0 = offset + 0U;
-      const uint32_t index1 = offset + 1U;
-      const uint32_t index2 = offset + 2U;
-
-      (*vertices)[index0] = vertex0;
-      (*vertices)[index1] = vertex1;
-      (*vertices)[index2] = vertex2;
-
-      (*indices)[index0] = index0;
-      (*indices)[index1] = index1;
-      (*indices)[index2] = index2;
+    if (indexed) {
+      // =========================================================================================
+      // Convert data to program compat format (shared vertices)
+      // =========================================================================================
+      createIndexedMesh(vertexCoords, surfaceTriangles, glm::vec3(1.0f), vertices, indices);
+    } else {
+      // =========================================================================================
+      // Calc normals
+      // =========================================================================================
+      const vecf_pt cornerNormals = Geometry::calcCornerNormals(vertexCoords, surfaceTriangles, SMOOTHING_CREASE_ANGLE);
+
+      // =========================================================================================
+      // Convert data to program compat format
+      // =========================================================================================
+      const int64_t nCorners = static_cast<int64_t>(surfaceTriangles->size());
+
+      vertices->resize(nCorners);
+      indices->resize(nCorners);
+
+      parallelFor(0, nCorners, [&](const int64_t iCorner) {
+        const size_t coordOffset = 3 * static_cast<size_t>((*surfaceTriangles)[iCorner]);
+        const size_t normalOffset = 3 * static_cast<size_t>(iCorner);
+
+        (*vertices)[iCorner] = Vertex(glm::vec3((*vertexCoords)[coordOffset + 0], (*vertexCoords)[coordOffset + 1], (*vertexCoords)[coordOffset + 2]),
+                                      glm::vec3(1.0f),
+                                      glm::vec3((*cornerNormals)[normalOffset + 0], (*cornerNormals)[normalOffset + 1], (*cornerNormals)[normalOffset + 2]),
+                                      BARY_CENTER[iCorner % 3],
+                                      glm::vec2(0.0f),
+                                      0.0f);
+        (*indices)[iCorner] = static_cast<uint32_t>(iCorner);
+      });
     }
-
-    ifstream.close();
   }
 
   LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
-  LOG_INFO("Num of triangles: " + std::to_string(vertices->size() / 3));
+  LOG_INFO("Num of triangles: " + std::to_string(indices->size() / 3));
 }
 
 void ObjectLoader::readPchFile(const std::string &filePath,
@@ -459,32 +546,42 @@ void ObjectLoader::readPchFile(const std::string &filePath,
                                IndexArray_t indices,
                                const float offsetX,
                                const float offsetY,
-                               const float offsetZ) {
-  std::ifstream ifstream = std::ifstream(filePath, std::ios::in);
+                               const float offsetZ,
+                               const bool indexed) {
+  const MappedTextFile_t file = MappedTextFile::open(filePath);
 
-  if (ifstream) {
-    std::string buffer;
+  if (file) {
+    const auto startTime = std::chrono::system_clock::now();
+    const char *lineBegin = nullptr;
+    const char *lineEnd = nullptr;
 
     // =========================================================================================
     // Read vertex coords
     // =========================================================================================
     // Read num vertices
-    std::getline(ifstream, buffer);
-    const int nVertices = std::stoi(buffer);
+    int nVertices = 0;
+    if (!file->getLine(0, lineBegin, lineEnd) || !MappedTextFile::parseInteger(lineBegin, lineEnd, nVertices) || nVertices < 0) {
+      LOG_ERROR("Failed to read the number of vertices.");
+      return;
+    }
 
     // Read vertices
     vecf_pt vertexCoords = std::make_shared<std::vector<float>>();
-    vertexCoords->resize(3 * nVertices);
+    vertexCoords->resize(3 * static_cast<size_t>(nVertices));
 
-    for (int iVertex = 0; iVertex < nVertices; ++iVertex) {
-      std::getline(ifstream, buffer);
-      std::vector<std::string> tokens = StringUtil::splitText(buffer, ' ');
+    float *vertexCoordData = vertexCoords->data();
 
-      const int offset = 3 * iVertex;
+    const bool isVerticesRead = file->forEachLine(1, nVertices, [&](const size_t iVertex, const char *begin, const char *end) {
+      const size_t offset = 3 * iVertex;
 
-      (*vertexCoords)[offset + 0] = std::stof(tokens[0]);
-      (*vertexCoords)[offset + 1] = std::stof(tokens[1]);
-      (*vertexCoords)[offset + 2] = std::stof(tokens[2]);
+      return MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 0]) &&
+             MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 1]) &&
+             MappedTextFile::parseFloat(begin, end, vertexCoordData[offset + 2]);
+    });
+
+    if (!isVerticesRead) {
+      LOG_ERROR("Failed to read vertex coords.");
+      return;
     }
     LOG_INFO("Reading vertex coords done.");
 
@@ -492,279 +589,251 @@ void ObjectLoader::readPchFile(const std::string &filePath,
     // Read elements
     // =========================================================================================
     // Read num elements
-    std::getline(ifstream, buffer);
-    const int nElements = std::stoi(buffer);
+    const size_t elementsLine = 1 + static_cast<size_t>(nVertices);
+
+    int nElements = 0;
+    if (!file->getLine(elementsLine, lineBegin, lineEnd) || !MappedTextFile::parseInteger(lineBegin, lineEnd, nElements) || nElements < 0) {
+      LOG_ERROR("Failed to read the number of elements.");
+      return;
+    }
 
     // Read elements
     veci_pt elements = std::make_shared<std::vector<int>>();
-    elements->resize(3 * nElements);
+    elements->resize(3 * static_cast<size_t>(nElements));
+
+    int *elementData = elements->data();
 
-    for (int iElement = 0; iElement < nElements; ++iElement) {
-      std::getline(ifstream, buffer);
-      std::vector<std::string> tokens = StringUtil::splitText(buffer, ' ');
+    const bool isElementsRead = file->forEachLine(elementsLine + 1, nElements, [&](const size_t iElement, const char *begin, const char *end) {
+      const size_t offset = 3 * iElement;
 
-      const int offset = 3 * iElement;
+      return MappedTextFile::parseInteger(begin, end, elementData[offset + 0]) &&
+             MappedTextFile::parseInteger(begin, end, elementData[offset + 1]) &&
+             MappedTextFile::parseInteger(begin, end, elementData[offset + 2]);
+    });
 
-      (*elements)[offset + 0] = std::stoi(tokens[0]);
-      (*elements)[offset + 1] = std::stoi(tokens[1]);
-      (*elements)[offset + 2] = std::stoi(tokens[2]);
+    if (!isElementsRead) {
+      LOG_ERROR("Failed to read elements.");
+      return;
     }
     LOG_INFO("Reading elements done.");
 
-    // =========================================================================================
-    // Calc face normals
-    // =========================================================================================
-    vecf_pt faceNormal = std::make_shared<std::vector<float>>();
-    faceNormal->resize(3 * nElements);
-
-    for (int iElement = 0; iElement < nElements; ++iElement) {
-      const int offset = 3 * iElement;
-
-      const int nodeId0 = (*elements)[offset + 0];
-      const int nodeId1 = (*elements)[offset + 1];
-      const int nodeId2 = (*elements)[offset + 2];
-
-      const int nodeIdOffset0 = 3 * nodeId0;
-      const int nodeIdOffset1 = 3 * nodeId1;
-      const int nodeIdOffset2 = 3 * nodeId2;
-
-      const float relVec0X = (*vertexCoords)[nodeIdOffset1 + 0] - (*vertexCoords)[nodeIdOffset0 + 0];
-      const float relVec0Y = (*vertexCoords)[nodeIdOffset1 + 1] - (*vertexCoords)[nodeIdOffset0 + 1];
-      const float relVec0Z = (*vertexCoords)[nodeIdOffset1 + 2] - (*vertexCoords)[nodeIdOffset0 + 2];
-
-      const float relVec1X = (*vertexCoords)[nodeIdOffset2 + 0] - (*vertexCoords)[nodeIdOffset0 + 0];
-      const float relVec1Y = (*vertexCoords)[nodeIdOffset2 + 1] - (*vertexCoords)[nodeIdOffset0 + 1];
-      const float relVec1Z = (*vertexCoords)[nodeIdOffset2 + 2] - (*vertexCoords)[nodeIdOffset0 + 2];
-
-      // Calc outer product
-      // 0:   x y z x
-      // 1:   x y z x
-      float normalX, normalY, normalZ;
-      math::outerProduct(relVec0X, relVec0Y, relVec0Z,
-                         relVec1X, relVec1Y, relVec1Z,
-                         normalX, normalY, normalZ);
-
-      // Normalize
-      math::normalize(normalX, normalY, normalZ);
-
-      // Set
-      (*faceNormal)[offset + 0] = normalX;
-      (*faceNormal)[offset + 1] = normalY;
-      (*faceNormal)[offset + 2] = normalZ;
-    }
+    logParsingThroughput(file->getFileSize(), startTime);
 
-    // =========================================================================================
-    // Calc vertex normal
-    // =========================================================================================
-#if defined(CALC_VERTEX_NORMAL_FROM_NEIGHBOR_FACES)
-    veci_pt countNodes = std::make_shared<std::vector<int>>();
-    countNodes->resize(nVertices);
-    for (int iNode = 0; iNode < nVertices; ++iNode) {
-      (*countNodes)[iNode] = 0;
-    }
-    for (int iElement = 0; iElement < nElements; ++iElement) {
-      const int offset = 3 * iElement;
-      (*countNodes)[(*elements)[offset + 0]] = (*countNodes)[(*elements)[offset + 0]] + 1;
-      (*countNodes)[(*elements)[offset + 1]] = (*countNodes)[(*elements)[offset + 1]] + 1;
-      (*countNodes)[(*elements)[offset + 2]] = (*countNodes)[(*elements)[offset + 2]] + 1;
+    for (const int nodeId : *elements) {
+      if (nodeId < 0 || nodeId >= nVertices) {
+        LOG_ERROR("Invalid vertex index in elements: " + std::to_string(nodeId));
+        return;
+      }
     }
 
-    veci_pt cumsumCountNodes = std::make_shared<std::vector<int>>();
-    cumsumCountNodes->resize(nVertices);
+    const vec_pt<uint32_t> triangles = std::make_shared<std::vector<uint32_t>>(elements->begin(), elements->end());
 
-    int cumsum = 0;
-    for (int iNode = 0; iNode < nVertices; ++iNode) {
-      (*cumsumCountNodes)[iNode] = cumsum;
-      cumsum += (*countNodes)[iNode];
+    if (indexed) {
+      // =========================================================================================
+      // Convert data to program compat format (shared vertices)
+      // =========================================================================================
+      createIndexedMesh(vertexCoords, triangles, glm::vec3(1.0f), vertices, indices);
+    } else {
+      // =========================================================================================
+      // Calc normals
+      // =========================================================================================
+      const vecf_pt cornerNormals = Geometry::calcCornerNormals(vertexCoords, triangles, SMOOTHING_CREASE_ANGLE);
+
+      // =========================================================================================
+      // Convert data to program compat format
+      // =========================================================================================
+      const int64_t nCorners = static_cast<int64_t>(triangles->size());
+
+      vertices->resize(nCorners);
+      indices->resize(nCorners);
+
+      parallelFor(0, nCorners, [&](const int64_t iCorner) {
+        const size_t coordOffset = 3 * static_cast<size_t>((*triangles)[iCorner]);
+        const size_t normalOffset = 3 * static_cast<size_t>(iCorner);
+
+        (*vertices)[iCorner] = Vertex(glm::vec3((*vertexCoords)[coordOffset + 0], (*vertexCoords)[coordOffset + 1], (*vertexCoords)[coordOffset + 2]),
+                                      glm::vec3(1.0f),
+                                      glm::vec3((*cornerNormals)[normalOffset + 0], (*cornerNormals)[normalOffset + 1], (*cornerNormals)[normalOffset + 2]),
+                                      BARY_CENTER[iCorner % 3],
+                                      glm::vec2(0.0f),
+                                      0.0f);
+        (*indices)[iCorner] = static_cast<uint32_t>(iCorner);
+      });
     }
+  }
 
-    // Calc belong to array
-    veci_pt belongTo = std::make_shared<std::vector<int>>();
-    belongTo->resize(cumsum);
+  LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
+  LOG_INFO("Num of triangles: " + std::to_string(indices->size() / 3));
+}
 
-    veci_pt belongToCounter = std::make_shared<std::vector<int>>();
-    belongToCounter->resize(nVertices);
+void ObjectLoader::readLasFile(const std::string &filePath,
+                               VertexArray_t vertices,
+                               IndexArray_t indices,
+                               const float offsetX,
+                               const float offsetY,
+                               const float offsetZ) {
+  // NOTE: Decode records straight from the mapped file into the vertex array,
+  //       so that only one chunk of intermediate records per task is alive at a time.
+  //       Each chunk writes a disjoint range of the output, so chunks can be decoded concurrently on the shared task scheduler.
+  const auto lasView = llas::LasView::open(filePath);
 
-    for (int iNode = 0; iNode < nVertices; ++iNode) {
-      (*belongToCounter)[iNode] = 0;
-    }
+  if (lasView != nullptr) {
+    const llas::PublicHeader &header = lasView->getHeader();
+    const size_t nPoints = lasView->getNumPoints();
 
-    for (int iElement = 0; iElement < nElements; ++iElement) {
-      const int offset = 3 * iElement;
+    vertices->resize(nPoints);
+    indices->resize(nPoints);
 
-      const int nodeId0 = (*elements)[offset + 0];
-      const int nodeId1 = (*elements)[offset + 1];
-      const int nodeId2 = (*elements)[offset + 2];
+    const float colorScale = 1.0f / 65535.0f;
+
+    lasView->parallelForEachPointChunk(
+        LLAS_DEFAULT_CHUNK_SIZE,
+        [&](const llas::PointDataRecord *records, const size_t iFirstRecord, const size_t nRecords) {
+          for (size_t iRecord = 0; iRecord < nRecords; ++iRecord) {
+            const llas::PointDataRecord &record = records[iRecord];
+            const size_t iPoint = iFirstRecord + iRecord;
+
+            Vertex &vertex = (*vertices)[iPoint];
+            vertex.position = glm::vec3((float)((double)record.x * header.xScaleFactor + header.xOffset),
+                                        (float)((double)record.y * header.yScaleFactor + header.yOffset),
+                                        (float)((double)record.z * header.zScaleFactor + header.zOffset));
+            vertex.color = glm::vec3((float)record.red * colorScale,
+                                     (float)record.green * colorScale,
+                                     (float)record.blue * colorScale);
+            vertex.normal = glm::vec3(0.0f);
+            vertex.bary = glm::vec3(0.0f);
+            vertex.uv = glm::vec2(0.0f);
+            vertex.id = 0.0f;
+
+            (*indices)[iPoint] = (uint32_t)iPoint;
+          }
+        },
+        [](const size_t nChunks, const auto &func) { parallelForRange(0, (int64_t)nChunks, func); });
+  }
 
-      const int offset0 = (*cumsumCountNodes)[nodeId0] + (*belongToCounter)[nodeId0];
-      (*belongTo)[offset0] = iElement;
-      (*belongToCounter)[nodeId0] = (*belongToCounter)[nodeId0] + 1;
+  LOG_INFO("Num of points : " + std::to_string(vertices->size()));
+}
 
-      const int offset1 = (*cumsumCountNodes)[nodeId1] + (*belongToCounter)[nodeId1];
-      (*belongTo)[offset1] = iElement;
-      (*belongToCounter)[nodeId1] = (*belongToCounter)[nodeId1] + 1;
+void ObjectLoader::readPlyFile(const std::string &filePath,
+                               VertexArray_t vertices,
+                               IndexArray_t indices,
+                               const float offsetX,
+                               const float offsetY,
+                               const float offsetZ,
+                               const bool indexed) {
+  const PlyFile_t file = PlyFile::open(filePath);
+
+  if (file) {
+    const auto startTime = std::chrono::system_clock::now();
+
+    // =========================================================================================
+    // Read vertices and faces
+    // =========================================================================================
+    // NOTE: Point clouds are decoded straight into the output array
+    bool hasNormals = false;
+    if (!file->readVertices(*vertices, hasNormals)) {
+      LOG_ERROR("Failed to read vertices.");
+      vertices->clear();
+      return;
+    }
+    LOG_INFO("Reading vertices done.");
 
-      const int offset2 = (*cumsumCountNodes)[nodeId2] + (*belongToCounter)[nodeId2];
-      (*belongTo)[offset2] = iElement;
-      (*belongToCounter)[nodeId2] = (*belongToCounter)[nodeId2] + 1;
+    vec_pt<uint32_t> triangles = std::make_shared<std::vector<uint32_t>>();
+    if (!file->readTriangles(*triangles)) {
+      LOG_ERROR("Failed to read faces.");
+      vertices->clear();
+      return;
     }
+    LOG_INFO("Reading faces done.");
 
-    // Calc vertex normals
-    vecf_pt vertexNormal = std::make_shared<std::vector<float>>();
-    vertexNormal->resize(3 * nVertices);
+    logParsingThroughput(file->getFileSize(), startTime);
 
-    for (int iVertex = 0; iVertex < nVertices; ++iVertex) {
-      const int offset = 3 * iVertex;
+    const int64_t nNodes = static_cast<int64_t>(vertices->size());
 
-      const int belongToOffset = (*cumsumCountNodes)[iVertex];
-      const int nBelongTo = (*belongToCounter)[iVertex];
+    if (triangles->empty()) {
+      // =========================================================================================
+      // Point cloud
+      // =========================================================================================
+      indices->resize(nNodes);
 
-      float vertexNormalX = 0.0f;
-      float vertexNormalY = 0.0f;
-      float vertexNormalZ = 0.0f;
+      parallelFor(0, nNodes, [&](const int64_t iNode) {
+        (*indices)[iNode] = static_cast<uint32_t>(iNode);
+      });
+    } else {
+      vecf_pt vertexCoords = nullptr;
 
-      for (int iBelongTo = 0; iBelongTo < nBelongTo; ++iBelongTo) {
-        const int elementId = (*belongTo)[belongToOffset + iBelongTo];
-        const int elementOffset = 3 * elementId;
+      if (!hasNormals) {
+        vertexCoords = std::make_shared<std::vector<float>>(3 * nNodes);
 
-        vertexNormalX += (*faceNormal)[elementOffset + 0];
-        vertexNormalY += (*faceNormal)[elementOffset + 1];
-        vertexNormalZ += (*faceNormal)[elementOffset + 2];
+        parallelFor(0, nNodes, [&](const int64_t iNode) {
+          (*vertexCoords)[3 * iNode + 0] = (*vertices)[iNode].position.x;
+          (*vertexCoords)[3 * iNode + 1] = (*vertices)[iNode].position.y;
+          (*vertexCoords)[3 * iNode + 2] = (*vertices)[iNode].position.z;
+        });
       }
 
-      vertexNormalX /= (float)nBelongTo;
-      vertexNormalY /= (float)nBelongTo;
-      vertexNormalZ /= (float)nBelongTo;
+      if (indexed) {
+        // =========================================================================================
+        // Convert data to program compat format (shared vertices)
+        // =========================================================================================
+        if (hasNormals) {
+          indices->swap(*triangles);
+        } else {
+          // NOTE: A node is split into one vertex per crease group, so the edges of boxes stay sharp
+          const vecf_pt cornerNormals = Geometry::calcCornerNormals(vertexCoords, triangles, SMOOTHING_CREASE_ANGLE);
+          const std::vector<uint32_t> firstCorners = Geometry::calcCreaseGroups(triangles, nNodes, cornerNormals);
 
-      // Normalize
-      const float length = std::sqrt(vertexNormalX * vertexNormalX + vertexNormalY * vertexNormalY + vertexNormalZ * vertexNormalZ);
-      vertexNormalX /= length;
-      vertexNormalY /= length;
-      vertexNormalZ /= length;
+          const VertexArray_t nodes = std::make_shared<std::vector<Vertex>>();
+          nodes->swap(*vertices);
 
-      (*vertexNormal)[offset + 0] = vertexNormalX;
-      (*vertexNormal)[offset + 1] = vertexNormalY;
-      (*vertexNormal)[offset + 2] = vertexNormalZ;
-    }
-#endif
+          indices->resize(triangles->size());
 
-    // =========================================================================================
-    // Convert data to program compat format
-    // =========================================================================================
-    vertices->resize(nElements * 3);
-    indices->resize(nElements * 3);
-
-    for (int iElement = 0; iElement < nElements; ++iElement) {
-      const int offset = 3 * iElement;
-      const int offset0 = offset + 0;
-      const int offset1 = offset + 1;
-      const int offset2 = offset + 2;
-
-      const int vertexIdOffset0 = 3 * (*elements)[offset0];
-      const int vertexIdOffset1 = 3 * (*elements)[offset1];
-      const int vertexIdOffset2 = 3 * (*elements)[offset2];
-
-      const glm::vec3 vertexCoord0 = glm::vec3((*vertexCoords)[vertexIdOffset0 + 0],
-                                               (*vertexCoords)[vertexIdOffset0 + 1],
-                                               (*vertexCoords)[vertexIdOffset0 + 2]);
-      const glm::vec3 vertexCoord1 = glm::vec3((*vertexCoords)[vertexIdOffset1 + 0],
-                                               (*vertexCoords)[vertexIdOffset1 + 1],
-                                               (*vertexCoords)[vertexIdOffset1 + 2]);
-      const glm::vec3 vertexCoord2 = glm::vec3((*vertexCoords)[vertexIdOffset2 + 0],
-                                               (*vertexCoords)[vertexIdOffset2 + 1],
-                                               (*vertexCoords)[vertexIdOffset2 + 2]);
-
-#if defined(CALC_VERTEX_NORMAL_FROM_NEIGHBOR_FACES)
-      const glm::vec3 vertexNormal0 = glm::vec3((*vertexNormal)[vertexIdOffset0 + 0],
-                                                (*vertexNormal)[vertexIdOffset0 + 1],
-                                                (*vertexNormal)[vertexIdOffset0 + 2]);
-      const glm::vec3 vertexNormal1 = glm::vec3((*vertexNormal)[vertexIdOffset1 + 0],
-                                                (*vertexNormal)[vertexIdOffset1 + 1],
-                                                (*vertexNormal)[vertexIdOffset1 + 2]);
-      const glm::vec3 vertexNormal2 = glm::vec3((*vertexNormal)[vertexIdOffset2 + 0],
-                                                (*vertexNormal)[vertexIdOffset2 + 1],
-                                                (*vertexNormal)[vertexIdOffset2 + 2]);
-#else
-      const glm::vec3 vertexNormal0 = glm::vec3((*faceNormal)[offset + 0],
-                                                (*faceNormal)[offset + 1],
-                                                (*faceNormal)[offset + 2]);
-      const glm::vec3 vertexNormal1 = glm::vec3((*faceNormal)[offset + 0],
-                                                (*faceNormal)[offset + 1],
-                                                (*faceNormal)[offset + 2]);
-      const glm::vec3 vertexNormal2 = glm::vec3((*faceNormal)[offset + 0],
-                                                (*faceNormal)[offset + 1],
-                                                (*faceNormal)[offset + 2]);
-#endif
+          for (size_t iCorner = 0; iCorner < triangles->size(); ++iCorner) {
+            const uint32_t iFirstCorner = firstCorners[iCorner];
 
-      const Vertex vertex0(vertexCoord0,
-                           glm::vec3(1.0f),
-                           vertexNormal0,
-                           BARY_CENTER[0],
-                           glm::vec2(0.0f),
-                           0.0f);
-      const Vertex vertex1(vertexCoord1,
-                           glm::vec3(1.0f),
-                           vertexNormal1,
-                           BARY_CENTER[1],
-                           glm::vec2(0.0f),
-                           0.0f);
-      const Vertex vertex2(vertexCoord2,
-                           glm::vec3(1.0f),
-                           vertexNormal2,
-                           BARY_CENTER[2],
-                           glm::vec2(0.0f),
-                           0.0f);
-
-      (*vertices)[offset0] = vertex0;
-      (*vertices)[offset1] = vertex1;
-      (*vertices)[offset2] = vertex2;
-
-      (*indices)[offset0] = offset0;
-      (*indices)[offset1] = offset1;
-      (*indices)[offset2] = offset2;
-    }
-  }
+            if (iFirstCorner != iCorner) {
+              (*indices)[iCorner] = (*indices)[iFirstCorner];
+              continue;
+            }
 
-  LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
-  LOG_INFO("Num of triangles: " + std::to_string(vertices->size() / 3));
-}
+            Vertex vertex = (*nodes)[(*triangles)[iCorner]];
+            vertex.normal = glm::vec3((*cornerNormals)[3 * iCorner + 0], (*cornerNormals)[3 * iCorner + 1], (*cornerNormals)[3 * iCorner + 2]);
 
-void ObjectLoader::readLasFile(const std::string &filePath,
-                               VertexArray_t vertices,
-                               IndexArray_t indices,
-                               const float offsetX,
-                               const float offsetY,
-                               const float offsetZ) {
-  const auto pointData = llas::read(filePath, true);
+            (*indices)[iCorner] = (uint32_t)vertices->size();
+            vertices->push_back(vertex);
+          }
+        }
+      } else {
+        // =========================================================================================
+        // Convert data to program compat format
+        // =========================================================================================
+        const vecf_pt cornerNormals = hasNormals ? nullptr : Geometry::calcCornerNormals(vertexCoords, triangles, SMOOTHING_CREASE_ANGLE);
 
-  if (pointData != nullptr) {
-    const size_t nPoints = pointData->getNumPoints();
-    const auto &coords = pointData->getPointCoords();
-    const auto &colors = pointData->getPointColors();
+        const VertexArray_t nodes = std::make_shared<std::vector<Vertex>>();
+        nodes->swap(*vertices);
 
-    vertices->resize(nPoints);
-    indices->resize(nPoints);
+        const int64_t nCorners = static_cast<int64_t>(triangles->size());
+
+        vertices->resize(nCorners);
+        indices->resize(nCorners);
 
-    for (size_t iPoint = 0; iPoint < nPoints; ++iPoint) {
-      const size_t offset = 3 * iPoint;
-      const Vertex vertex(
-          glm::vec3((float)coords[offset + 0],
-                    (float)coords[offset + 1],
-                    (float)coords[offset + 2]),
-          glm::vec3((float)colors[offset + 0] / 255.0f,
-                    (float)colors[offset + 1] / 255.0f,
-                    (float)colors[offset + 2] / 255.0f),
-          glm::vec3(0.0f),
-          glm::vec3(0.0f),
-          glm::vec2(0.0f),
-          0.0f);
-
-      (*vertices)[iPoint] = vertex;
-      (*indices)[iPoint] = (uint32_t)iPoint;
+        parallelFor(0, nCorners, [&](const int64_t iCorner) {
+          Vertex vertex = (*nodes)[(*triangles)[iCorner]];
+          vertex.bary = BARY_CENTER[iCorner % 3];
+
+          if (cornerNormals != nullptr) {
+            vertex.normal = glm::vec3((*cornerNormals)[3 * iCorner + 0], (*cornerNormals)[3 * iCorner + 1], (*cornerNormals)[3 * iCorner + 2]);
+          }
+
+          (*vertices)[iCorner] = vertex;
+          (*indices)[iCorner] = static_cast<uint32_t>(iCorner);
+        });
+      }
     }
   }
 
-  LOG_INFO("Num of points : " + std::to_string(vertices->size()));
+  LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
+  LOG_INFO("Num of triangles: " + std::to_string(indices->size() / 3));
 }
 
 void ObjectLoader::readVtkFile(const std::string &filePath,
@@ -772,7 +841,8 @@ void ObjectLoader::readVtkFile(const std::string &filePath,
                                IndexArray_t indices,
                                const float offsetX,
                                const float offsetY,
-                               const float offsetZ) {
+                               const float offsetZ,
+                               const bool indexed) {
   if (!FileUtil::exists(filePath)) {
     LOG_ERROR("File not found: " + filePath);
     return;
@@ -815,118 +885,103 @@ void ObjectLoader::readVtkFile(const std::string &filePath,
 
       if (points != nullptr && cells != nullptr) {
         const vtkIdType nCells = cells->GetNumberOfCells();
-        size_t vertexId = 0;
 
-        for (vtkIdType cellId = 0; cellId < nCells; ++cellId) {
-          vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
-          vtkSmartPointer<vtkPoints> pts = vtkSmartPointer<vtkPoints>::New();
+        // =========================================================================================
+        // Triangulate
+        // =========================================================================================
+        vec_pt<uint32_t> triangles = std::make_shared<std::vector<uint32_t>>();
 
+        for (vtkIdType cellId = 0; cellId < nCells; ++cellId) {
           vtkCell *cell = unstructuredGrid->GetCell(cellId);
           const int cellType = cell->GetCellType();
           vtkIdList *idList = cell->GetPointIds();
-          const int nVertices = idList->GetNumberOfIds();
-          double coordsBuffer[3] = {0.0, 0.0, 0.0};
+
+          const vec3i_t *triangleIDs = nullptr;
+          size_t nTrianglesPerCell = 0;
 
           if (cellType == VTK_TRIANGLE) {
-            for (size_t iTriangle = 0; iTriangle < VTK_TRIANGLE_IDS_TRIANGLE.size(); ++iTriangle) {
-              for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
-                const vtkIdType pointId = (uint32_t)idList->GetId(VTK_TRIANGLE_IDS_TRIANGLE[iTriangle][iVertex]);
-
-                // Get vertex coords
-                points->GetPoint(pointId, coordsBuffer);
-
-                Vertex vertex(glm::vec3(coordsBuffer[0], coordsBuffer[1], coordsBuffer[2]),
-                              glm::vec3(0.0f),
-                              glm::vec3(0.0f),
-                              BARY_CENTER[iVertex],
-                              glm::vec2(0.0f),
-                              0.0f);
-
-                vertices->push_back(vertex);
-                indices->push_back(vertexId++);
-              }
-            }
+            triangleIDs = VTK_TRIANGLE_IDS_TRIANGLE.data();
+            nTrianglesPerCell = VTK_TRIANGLE_IDS_TRIANGLE.size();
           } else if (cellType == VTK_QUAD) {
-            for (size_t iTriangle = 0; iTriangle < VTK_TRIANGLE_IDS_QUAD.size(); ++iTriangle) {
-              for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
-                const vtkIdType pointId = (uint32_t)idList->GetId(VTK_TRIANGLE_IDS_QUAD[iTriangle][iVertex]);
-
-                // Get vertex coords
-                points->GetPoint(pointId, coordsBuffer);
-
-                Vertex vertex(glm::vec3(coordsBuffer[0], coordsBuffer[1], coordsBuffer[2]),
-                              glm::vec3(0.0f),
-                              glm::vec3(0.0f),
-                              BARY_CENTER[iVertex],
-                              glm::vec2(0.0f),
-                              0.0f);
-
-                vertices->push_back(vertex);
-                indices->push_back(vertexId++);
-              }
-            }
+            triangleIDs = VTK_TRIANGLE_IDS_QUAD.data();
+            nTrianglesPerCell = VTK_TRIANGLE_IDS_QUAD.size();
           } else if (cellType == VTK_TETRA) {
-            for (size_t iTriangle = 0; iTriangle < VTK_TRIANGLE_IDS_TETRA.size(); ++iTriangle) {
-              for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
-                const vtkIdType pointId = (uint32_t)idList->GetId(VTK_TRIANGLE_IDS_TETRA[iTriangle][iVertex]);
-
-                // Get vertex coords
-                points->GetPoint(pointId, coordsBuffer);
-
-                Vertex vertex(glm::vec3(coordsBuffer[0], coordsBuffer[1], coordsBuffer[2]),
-                              glm::vec3(0.0f),
-                              glm::vec3(0.0f),
-                              BARY_CENTER[iVertex],
-                              glm::vec2(0.0f),
-                              0.0f);
-
-                vertices->push_back(vertex);
-                indices->push_back(vertexId++);
-              }
-            }
+            triangleIDs = VTK_TRIANGLE_IDS_TETRA.data();
+            nTrianglesPerCell = VTK_TRIANGLE_IDS_TETRA.size();
           } else if (cellType == VTK_HEXAHEDRON) {
-            for (size_t iTriangle = 0; iTriangle < VTK_TRIANGLE_IDS_HEXAHEDRON.size(); ++iTriangle) {
-              for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
-                const vtkIdType pointId = (uint32_t)idList->GetId(VTK_TRIANGLE_IDS_HEXAHEDRON[iTriangle][iVertex]);
-
-                // Get vertex coords
-                points->GetPoint(pointId, coordsBuffer);
-
-                Vertex vertex(glm::vec3(coordsBuffer[0], coordsBuffer[1], coordsBuffer[2]),
-                              glm::vec3(0.0f),
-                              glm::vec3(0.0f),
-                              BARY_CENTER[iVertex],
-                              glm::vec2(0.0f),
-                              0.0f);
-
-                vertices->push_back(vertex);
-                indices->push_back(vertexId++);
-              }
-            }
+            triangleIDs = VTK_TRIANGLE_IDS_HEXAHEDRON.data();
+            nTrianglesPerCell = VTK_TRIANGLE_IDS_HEXAHEDRON.size();
           } else if (cellType == VTK_WEDGE) {
-            for (size_t iTriangle = 0; iTriangle < VTK_TRIANGLE_IDS_WEDGE.size(); ++iTriangle) {
-              for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
-                const vtkIdType pointId = (uint32_t)idList->GetId(VTK_TRIANGLE_IDS_WEDGE[iTriangle][iVertex]);
-
-                // Get vertex coords
-                points->GetPoint(pointId, coordsBuffer);
-
-                Vertex vertex(glm::vec3(coordsBuffer[0], coordsBuffer[1], coordsBuffer[2]),
-                              glm::vec3(0.0f),
-                              glm::vec3(0.0f),
-                              BARY_CENTER[iVertex],
-                              glm::vec2(0.0f),
-                              0.0f);
-
-                vertices->push_back(vertex);
-                indices->push_back(vertexId++);
-              }
-            }
+            triangleIDs = VTK_TRIANGLE_IDS_WEDGE.data();
+            nTrianglesPerCell = VTK_TRIANGLE_IDS_WEDGE.size();
           } else {
             LOG_WARN("Unsupported cell type!");
             break;
           }  // end of if 'cellType'
-        }    // end of for-loop 'cellid'
+
+          for (size_t iTriangle = 0; iTriangle < nTrianglesPerCell; ++iTriangle) {
+            for (size_t iVertex = 0; iVertex < 3; ++iVertex) {
+              triangles->push_back((uint32_t)idList->GetId(triangleIDs[iTriangle][iVertex]));
+            }
+          }
+        }  // end of for-loop 'cellid'
+
+        LOG_INFO("nTriangles: " + std::to_string(triangles->size() / 3));
+
+        // =========================================================================================
+        // Extract surface
+        // =========================================================================================
+        // NOTE: Faces shared by two volume cells are inside the model
+        const vec_pt<uint32_t> &surfaceTriangles = Geometry::extractSurfaceTriangle(triangles);
+        LOG_INFO("nSurfaceTriangles: " + std::to_string(surfaceTriangles->size() / 3));
+
+        const vtkIdType nPoints = points->GetNumberOfPoints();
+
+        vecf_pt vertexCoords = std::make_shared<std::vector<float>>();
+        vertexCoords->resize(3 * nPoints);
+
+        double coordsBuffer[3] = {0.0, 0.0, 0.0};
+
+        for (vtkIdType pointId = 0; pointId < nPoints; ++pointId) {
+          points->GetPoint(pointId, coordsBuffer);
+
+          (*vertexCoords)[3 * pointId + 0] = (float)coordsBuffer[0];
+          (*vertexCoords)[3 * pointId + 1] = (float)coordsBuffer[1];
+          (*vertexCoords)[3 * pointId + 2] = (float)coordsBuffer[2];
+        }
+
+        if (indexed) {
+          // =========================================================================================
+          // Convert data to program compat format (shared vertices)
+          // =========================================================================================
+          createIndexedMesh(vertexCoords, surfaceTriangles, glm::vec3(0.0f), vertices, indices);
+        } else {
+          // =========================================================================================
+          // Calc normals
+          // =========================================================================================
+          const vecf_pt cornerNormals = Geometry::calcCornerNormals(vertexCoords, surfaceTriangles, SMOOTHING_CREASE_ANGLE);
+
+          // =========================================================================================
+          // Convert data to program compat format
+          // =========================================================================================
+          const int64_t nCorners = static_cast<int64_t>(surfaceTriangles->size());
+
+          vertices->resize(nCorners);
+          indices->resize(nCorners);
+
+          parallelFor(0, nCorners, [&](const int64_t iCorner) {
+            const size_t coordOffset = 3 * static_cast<size_t>((*surfaceTriangles)[iCorner]);
+            const size_t normalOffset = 3 * static_cast<size_t>(iCorner);
+
+            (*vertices)[iCorner] = Vertex(glm::vec3((*vertexCoords)[coordOffset + 0], (*vertexCoords)[coordOffset + 1], (*vertexCoords)[coordOffset + 2]),
+                                          glm::vec3(0.0f),
+                                          glm::vec3((*cornerNormals)[normalOffset + 0], (*cornerNormals)[normalOffset + 1], (*cornerNormals)[normalOffset + 2]),
+                                          BARY_CENTER[iCorner % 3],
+                                          glm::vec2(0.0f),
+                                          0.0f);
+            (*indices)[iCorner] = static_cast<uint32_t>(iCorner);
+          });
+        }
       }      // end of null-check 'cells'
     }
   } else {
@@ -935,13 +990,14 @@ void ObjectLoader::readVtkFile(const std::string &filePath,
 #endif
 
   LOG_INFO("Num of vertices : " + std::to_string(vertices->size()));
-  LOG_INFO("Num of triangles: " + std::to_string(vertices->size() / 3));
+  LOG_INFO("Num of triangles: " + std::to_string(indices->size() / 3));
 }
 
 void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
                                                 MaterialGroups_t materialGroups,
                                                 const glm::vec3 offset,
-                                                const glm::vec3 scale) {
+                                                const glm::vec3 scale,
+                                                const bool indexed) {
   unsigned int nMaterials = 0;
   unsigned int nFaces = 0;
   unsigned int nVertices = 0;
@@ -954,6 +1010,10 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
   flag |= aiProcess_RemoveRedundantMaterials;
   flag |= aiProcess_GenNormals;
 
+  if (indexed) {
+    flag |= aiProcess_JoinIdenticalVertices;
+  }
+
   const aiScene *scene = importer.ReadFile(filePath, flag);
 
   if (scene == nullptr) {
@@ -1028,6 +1088,47 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
   for (int iMesh = 0; iMesh < scene->mNumMeshes; ++iMesh) {
     aiMesh *mesh = scene->mMeshes[iMesh];
 
+    if (indexed) {
+      // Use the vertices of the mesh as they are
+      const MaterialGroup_t &materialGroup = (*materialGroups)[mesh->mMaterialIndex];
+      const uint32_t baseIndex = (uint32_t)materialGroup->vertices->size();
+
+      for (unsigned int index = 0; index < mesh->mNumVertices; ++index) {
+        nVertices++;
+
+        glm::vec3 position = glm::vec3(mesh->mVertices[index].x, mesh->mVertices[index].y, mesh->mVertices[index].z);
+        glm::vec3 normal(0.0f), color(1.0f);
+        glm::vec2 texcoord(0.0f);
+
+        if (mesh->HasNormals()) {
+          normal = glm::vec3(mesh->mNormals[index].x, mesh->mNormals[index].y, mesh->mNormals[index].z);
+        }
+
+        if (mesh->HasTextureCoords(0)) {
+          texcoord = glm::vec2(mesh->mTextureCoords[0][index].x, mesh->mTextureCoords[0][index].y);
+        }
+
+        materialGroup->vertices->push_back(Vertex(position, color, normal, glm::vec3(0.0f), texcoord, 0.0f));
+      }
+
+      for (unsigned int iFace = 0; iFace < mesh->mNumFaces; ++iFace) {
+        const aiFace &face = mesh->mFaces[iFace];
+
+        if (face.mNumIndices != 3) {
+          // Skip points and lines
+          continue;
+        }
+
+        nFaces++;
+
+        materialGroup->indices->push_back(baseIndex + face.mIndices[0]);
+        materialGroup->indices->push_back(baseIndex + face.mIndices[1]);
+        materialGroup->indices->push_back(baseIndex + face.mIndices[2]);
+      }
+
+      continue;
+    }
+
     for (int iFace = 0; iFace < mesh->mNumFaces; ++iFace) {
       nFaces++;
 
@@ -1122,7 +1223,37 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
     materialGroups->push_back(std::make_shared<MaterialGroup>());
   }
 
+  // =========================================================================================
+  // Calc normals of the corners without 'vn'
+  // =========================================================================================
+  vec_pt<uint32_t> cornerNodes = std::make_shared<std::vector<uint32_t>>();
+  bool isNormalMissing = false;
+
+  for (const auto &shape : shapes) {
+    for (const tinyobj::index_t &index : shape.mesh.indices) {
+      cornerNodes->push_back((uint32_t)std::max(index.vertex_index, 0));
+      isNormalMissing = isNormalMissing || index.normal_index < 0;
+    }
+  }
+
+  // NOTE: The indexed mode shares a vertex only between the corners in the same crease group
+  vecf_pt generatedNormals = nullptr;
+  std::vector<uint32_t> firstCorners;
+  if (isNormalMissing) {
+    const vecf_pt nodeCoords = std::make_shared<std::vector<float>>(attrib.vertices);
+    generatedNormals = Geometry::calcCornerNormals(nodeCoords, cornerNodes, SMOOTHING_CREASE_ANGLE);
+
+    if (indexed) {
+      firstCorners = Geometry::calcCreaseGroups(cornerNodes, attrib.vertices.size() / 3, generatedNormals);
+    }
+  }
+
+  // NOTE: Used in the indexed mode only. Maps a face corner to the vertex already emitted for it, for each material group.
+  std::vector<std::unordered_map<ObjCornerKey, uint32_t, ObjCornerKeyHash>> cornerToVertex(materialGroups->size());
+
   // Load Object
+  size_t iCornerHead = 0;
+
   for (const auto &shape : shapes) {
     size_t indexOffset = 0;
 
@@ -1135,6 +1266,20 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
       for (size_t iVertex = 0; iVertex < nVertices; ++iVertex) {
         // access to vertex
         const tinyobj::index_t index = shape.mesh.indices[indexOffset + iVertex];
+        const size_t iCorner = iCornerHead + indexOffset + iVertex;
+
+        if (indexed) {
+          const int firstCorner = (index.normal_index < 0 && generatedNormals != nullptr) ? (int)firstCorners[iCorner] : -1;
+          const ObjCornerKey key = {index.vertex_index, index.normal_index, index.texcoord_index, firstCorner};
+          const auto iter = cornerToVertex[materialID].find(key);
+
+          if (iter != cornerToVertex[materialID].end()) {
+            (*materialGroups)[materialID]->indices->push_back(iter->second);
+            continue;
+          }
+
+          cornerToVertex[materialID].emplace(key, uint32_t((*materialGroups)[materialID]->vertices->size()));
+        }
 
         glm::vec3 position(0.0f), normal(0.0f), color(1.0f);
         glm::vec2 texcoord(0.0f);
@@ -1155,6 +1300,9 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
               attrib.normals[3 * index.normal_index + 0],
               attrib.normals[3 * index.normal_index + 1],
               attrib.normals[3 * index.normal_index + 2]);
+        } else if (generatedNormals != nullptr) {
+          const size_t offset = 3 * iCorner;
+          normal = glm::vec3((*generatedNormals)[offset + 0], (*generatedNormals)[offset + 1], (*generatedNormals)[offset + 2]);
         }
 
         if (index.texcoord_index >= 0) {
@@ -1166,7 +1314,7 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
         const Vertex vertex(position,
                             color,
                             normal,
-                            BARY_CENTER[iVertex % 3],
+                            indexed ? glm::vec3(0.0f) : BARY_CENTER[iVertex % 3],
                             texcoord,
                             0.0f);
 
@@ -1176,6 +1324,8 @@ void ObjectLoader::readObjFileWithMaterialGroup(const std::string &filePath,
 
       indexOffset += nVertices;
     }
+
+    iCornerHead += shape.mesh.indices.size();
   }
 #endif
 
@@ -1224,13 +1374,11 @@ void ObjectLoader::scaleObject(VertexArray_t vertices,
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = getCorners(vertices);
 
+  // Scale around the center of the bounds
   const glm::vec3 center = (maxCoords + minCoords) / 2.0f;
-  const glm::vec3 range = maxCoords - minCoords;
   const glm::vec3 scale(scaleX, scaleY, scaleZ);
 
-  for (int i = 0; i < vertices->size(); ++i) {
-    (*vertices)[i].position = ((*vertices)[i].position - center) * scale + center;
-  }
+  ObjectLoader::transformObject(vertices, createPlacementMatrix(minCoords, maxCoords, scale, center));
 }
 
 void ObjectLoader::scaleObject(VertexArray_t vertices,
@@ -1242,22 +1390,16 @@ void ObjectLoader::moveToOrigin(VertexArray_t vertices) {
   glm::vec3 minCoords, maxCoords;
   std::tie(minCoords, maxCoords) = getCorners(vertices);
 
-  glm::vec3 center = (maxCoords + minCoords) / 2.0f;
+  const glm::vec3 center = (maxCoords + minCoords) / 2.0f;
 
-  for (int i = 0; i < vertices->size(); ++i) {
-    (*vertices)[i].position = (*vertices)[i].position - center;
-  }
+  ObjectLoader::transformObject(vertices, glm::translate(-center));
 }
 
 void ObjectLoader::translateObject(VertexArray_t vertices,
                                    const float offsetX,
                                    const float offsetY,
                                    const float offsetZ) {
-  glm::vec3 offset(offsetX, offsetY, offsetZ);
-
-  for (int i = 0; i < vertices->size(); ++i) {
-    (*vertices)[i].position = (*vertices)[i].position + offset;
-  }
+  ObjectLoader::transformObject(vertices, glm::translate(glm::vec3(offsetX, offsetY, offsetZ)));
 }
 
 void ObjectLoader::translateObject(VertexArray_t vertices,
@@ -1266,17 +1408,87 @@ void ObjectLoader::translateObject(VertexArray_t vertices,
 }
 
 void ObjectLoader::rotateObject(VertexArray_t vertices, const float angle, const glm::vec3 axis) {
-  const int nVertices = vertices->size();
-  const glm::mat4 rotMat = glm::rotate(angle, axis);
-
-  for (int i_vertex = 0; i_vertex < nVertices; ++i_vertex) {
-    const glm::vec4 &position = rotMat * glm::vec4((*vertices)[i_vertex].position, 1.0f);
-    const glm::vec4 &normal = rotMat * glm::vec4((*vertices)[i_vertex].normal, 1.0f);
-    (*vertices)[i_vertex].position = glm::vec3(position.x, position.y, position.z);
-    (*vertices)[i_vertex].normal = glm::vec3(normal.x, normal.y, normal.z);
-  }
+  ObjectLoader::transformObject(vertices, glm::rotate(angle, axis));
 };
 
+void ObjectLoader::placeObject(VertexArray_t vertices,
+                               const glm::vec3 scale,
+                               const glm::vec3 offset) {
+  glm::vec3 minCoords, maxCoords;
+  std::tie(minCoords, maxCoords) = getCorners(vertices);
+
+  ObjectLoader::transformObject(vertices, createPlacementMatrix(minCoords, maxCoords, scale, offset));
+}
+
+glm::mat4 ObjectLoader::createPlacementMatrix(const glm::vec3 &minCoords,
+                                              const glm::vec3 &maxCoords,
+                                              const glm::vec3 &scale,
+                                              const glm::vec3 &offset) {
+  const glm::vec3 center = (maxCoords + minCoords) / 2.0f;
+  return glm::translate(offset) * glm::scale(scale) * glm::translate(-center);
+}
+
+void ObjectLoader::transformObject(VertexArray_t vertices,
+                                   const glm::mat4 &transform) {
+  const int64_t nVertices = vertices->size();
+  if (nVertices == 0) {
+    return;
+  }
+
+  const glm::vec3 col0(transform[0]);
+  const glm::vec3 col1(transform[1]);
+  const glm::vec3 col2(transform[2]);
+  const glm::vec3 translation(transform[3]);
+
+  // NOTE: The cofactor matrix is the inverse transpose times the determinant. It is defined even for singular
+  //       transforms, and its magnitude does not matter since normals are rescaled to their original length.
+  //       The sign of the determinant is kept so that mirrored normals still point outwards.
+  const float determinant = glm::dot(col0, glm::cross(col1, col2));
+  const float normalSign = determinant < 0.0f ? -1.0f : 1.0f;
+  const glm::vec3 normalCol0 = normalSign * glm::cross(col1, col2);
+  const glm::vec3 normalCol1 = normalSign * glm::cross(col2, col0);
+  const glm::vec3 normalCol2 = normalSign * glm::cross(col0, col1);
+
+  // Pure translations and positive uniform scales leave the directions of normals unchanged
+  const bool toTransformNormals = col0.y != 0.0f || col0.z != 0.0f ||
+                                  col1.x != 0.0f || col1.z != 0.0f ||
+                                  col2.x != 0.0f || col2.y != 0.0f ||
+                                  col0.x != col1.y || col0.x != col2.z || col0.x <= 0.0f;
+
+  Vertex *data = vertices->data();
+  const int64_t nChunks = (nVertices + TRANSFORM_CHUNK_SIZE - 1) / TRANSFORM_CHUNK_SIZE;
+
+  parallelFor(
+      0,
+      nChunks,
+      [&](const int64_t iChunk) {
+        const int64_t first = iChunk * TRANSFORM_CHUNK_SIZE;
+        const int64_t last = std::min(first + TRANSFORM_CHUNK_SIZE, nVertices);
+
+        for (int64_t iVertex = first; iVertex < last; ++iVertex) {
+          const glm::vec3 position = data[iVertex].position;
+          data[iVertex].position = col0 * position.x + col1 * position.y + col2 * position.z + translation;
+        }
+
+        if (!toTransformNormals) {
+          return;
+        }
+
+        for (int64_t iVertex = first; iVertex < last; ++iVertex) {
+          const glm::vec3 normal = data[iVertex].normal;
+          const glm::vec3 transformed = normalCol0 * normal.x + normalCol1 * normal.y + normalCol2 * normal.z;
+
+          const float squaredLength = glm::dot(normal, normal);
+          const float squaredTransformedLength = glm::dot(transformed, transformed);
+
+          if (squaredTransformedLength > 0.0f) {
+            data[iVertex].normal = transformed * std::sqrt(squaredLength / squaredTransformedLength);
+          }
+        }
+      },
+      1);
+}
+
 void ObjectLoader::mergeVertices(
     const VertexArray_t &sourceVertices,
     const IndexArray_t &sourceIndices,
@@ -1296,30 +1508,106 @@ void ObjectLoader::mergeVertices(
 };
 
 std::pair<glm::vec3, glm::vec3> ObjectLoader::getCorners(VertexArray_t vertices) {
-  glm::vec3 maxCoords(0.0f);
-  glm::vec3 minCoords(0.0f);
+  using Corners_t = std::pair<glm::vec3, glm::vec3>;
 
-  for (int i = 0; i < vertices->size(); ++i) {
-    const Vertex &vertex = (*vertices)[i];
+  const int64_t nVertices = vertices->size();
+  if (nVertices == 0) {
+    return {glm::vec3(0.0f), glm::vec3(0.0f)};
+  }
 
-    for (int direction = 0; direction < 3; ++direction) {
-      if (i == 0) {
-        minCoords[direction] = vertex.position[direction];
-        maxCoords[direction] = vertex.position[direction];
-        continue;
-      }
+  const Vertex *data = vertices->data();
+  const int64_t nChunks = (nVertices + TRANSFORM_CHUNK_SIZE - 1) / TRANSFORM_CHUNK_SIZE;
+
+  const Corners_t identity(glm::vec3(std::numeric_limits<float>::max()),
+                           glm::vec3(std::numeric_limits<float>::lowest()));
+
+  return parallelReduce(
+      0,
+      nChunks,
+      identity,
+      [&](const int64_t iChunk) {
+        const int64_t first = iChunk * TRANSFORM_CHUNK_SIZE;
+        const int64_t last = std::min(first + TRANSFORM_CHUNK_SIZE, nVertices);
+
+        // NOTE: Scalar accumulators let the compiler keep them in registers over the strided loads
+        float minX = data[first].position.x, minY = data[first].position.y, minZ = data[first].position.z;
+        float maxX = minX, maxY = minY, maxZ = minZ;
+
+        for (int64_t iVertex = first + 1; iVertex < last; ++iVertex) {
+          const glm::vec3 &position = data[iVertex].position;
+          minX = std::min(minX, position.x);
+          minY = std::min(minY, position.y);
+          minZ = std::min(minZ, position.z);
+          maxX = std::max(maxX, position.x);
+          maxY = std::max(maxY, position.y);
+          maxZ = std::max(maxZ, position.z);
+        }
 
-      if (vertex.position[direction] > maxCoords[direction]) {
-        maxCoords[direction] = vertex.position[direction];
-      }
+        return Corners_t(glm::vec3(minX, minY, minZ), glm::vec3(maxX, maxY, maxZ));
+      },
+      [](const Corners_t &lhs, const Corners_t &rhs) {
+        return Corners_t(glm::min(lhs.first, rhs.first), glm::max(lhs.second, rhs.second));
+      },
+      1);
+}
 
-      if (vertex.position[direction] < minCoords[direction]) {
-        minCoords[direction] = vertex.position[direction];
-      }
+void ObjectLoader::logParsingThroughput(const size_t nBytes,
+                                        const std::chrono::system_clock::time_point &startTime) {
+  const auto endTime = std::chrono::system_clock::now();
+  const double elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() / 1e6;
+  const double megaBytes = (double)nBytes / 1e6;
+
+  LOG_INFO("Parsed " + std::to_string(megaBytes) + " [MB] in " + std::to_string(elapsedTime) + " [sec] (" +
+           std::to_string(elapsedTime > 0.0 ? megaBytes / elapsedTime : 0.0) + " [MB/s])");
+}
+
+void ObjectLoader::createIndexedMesh(const vecf_pt &vertexCoords,
+                                     const vec_pt<uint32_t> &triangles,
+                                     const glm::vec3 &color,
+                                     VertexArray_t vertices,
+                                     IndexArray_t indices) {
+  const size_t nNodes = vertexCoords->size() / 3;
+
+  // =========================================================================================
+  // Calc normals
+  // =========================================================================================
+  const vecf_pt cornerNormals = Geometry::calcCornerNormals(vertexCoords, triangles, SMOOTHING_CREASE_ANGLE);
+  const std::vector<uint32_t> firstCorners = Geometry::calcCreaseGroups(triangles, nNodes, cornerNormals);
+
+  // =========================================================================================
+  // Number the crease groups in order of appearance
+  // =========================================================================================
+  // NOTE: A node is split into one vertex per crease group, so the edges of boxes stay sharp
+  std::vector<uint32_t> vertexToCorner;
+
+  indices->resize(triangles->size());
+
+  for (size_t iCorner = 0; iCorner < triangles->size(); ++iCorner) {
+    const uint32_t iFirstCorner = firstCorners[iCorner];
+
+    if (iFirstCorner == iCorner) {
+      (*indices)[iCorner] = (uint32_t)vertexToCorner.size();
+      vertexToCorner.push_back((uint32_t)iCorner);
+    } else {
+      (*indices)[iCorner] = (*indices)[iFirstCorner];
     }
   }
 
-  return {std::move(minCoords), std::move(maxCoords)};
+  const size_t nVertices = vertexToCorner.size();
+
+  vertices->resize(nVertices);
+
+  parallelFor(0, static_cast<int64_t>(nVertices), [&](const int64_t iVertex) {
+    const size_t normalOffset = 3 * static_cast<size_t>(vertexToCorner[iVertex]);
+    const size_t coordOffset = 3 * static_cast<size_t>((*triangles)[vertexToCorner[iVertex]]);
+
+    (*vertices)[iVertex] = Vertex(glm::vec3((*vertexCoords)[coordOffset + 0], (*vertexCoords)[coordOffset + 1], (*vertexCoords)[coordOffset + 2]),
+                                  color,
+                                  glm::vec3((*cornerNormals)[normalOffset + 0], (*cornerNormals)[normalOffset + 1], (*cornerNormals)[normalOffset + 2]),
+                                  glm::vec3(0.0f),
+                                  glm::vec2(0.0f),
+                                  0.0f);
+  });
 }
 
 }  // namespace util
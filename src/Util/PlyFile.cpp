@@ -0,0 +1,866 @@
+#include <SimView/Util/PlyFile.hpp>
+
+namespace simview {
+namespace util {
+
+PlyFile::PlyFile()
+    : _file(nullptr),
+      _format(Format::ASCII),
+      _elements() {
+}
+
+PlyFile::~PlyFile() = default;
+
+std::shared_ptr<PlyFile> PlyFile::open(const std::string& filePath) {
+  std::shared_ptr<PlyFile> file(new PlyFile());
+
+  // NOTE: Lines are counted only for ASCII files after the header tells the format
+  file->_file = MappedTextFile::open(filePath, false);
+  if (file->_file == nullptr) {
+    return nullptr;
+  }
+
+  size_t headerSize = 0;
+  size_t nHeaderLines = 0;
+
+  if (!file->parseHeader(headerSize, nHeaderLines)) {
+    LOG_ERROR("Failed to parse the PLY header: " + filePath);
+    return nullptr;
+  }
+
+  if (!file->locateElements(headerSize, nHeaderLines)) {
+    LOG_ERROR("Unexpected end of PLY file: " + filePath);
+    return nullptr;
+  }
+
+  return file;
+}
+
+bool PlyFile::parseHeader(size_t& headerSize, size_t& nHeaderLines) {
+  const char* data = _file->getData();
+  const char* fileEnd = data + _file->getFileSize();
+  const char* lineBegin = data;
+
+  Element* currentElement = nullptr;
+  bool isFormatFound = false;
+
+  nHeaderLines = 0;
+
+  while (lineBegin < fileEnd) {
+    const char* lineBreak = (const char*)std::memchr(lineBegin, '\n', fileEnd - lineBegin);
+    const char* lineEnd = lineBreak == nullptr ? fileEnd : lineBreak;
+
+    // Split the line into tokens
+    std::vector<std::string> tokens;
+    const char* cursor = MappedTextFile::skipSpaces(lineBegin, lineEnd);
+
+    while (cursor < lineEnd) {
+      const char* tokenBegin = cursor;
+      while (cursor < lineEnd && *cursor != ' ' && *cursor != '\t' && *cursor != '\r') {
+        ++cursor;
+      }
+      tokens.emplace_back(tokenBegin, cursor);
+      cursor = MappedTextFile::skipSpaces(cursor, lineEnd);
+    }
+
+    ++nHeaderLines;
+    lineBegin = lineBreak == nullptr ? fileEnd : lineBreak + 1;
+
+    if (nHeaderLines == 1) {
+      if (tokens.size() != 1 || tokens[0] != "ply") {
+        LOG_ERROR("Not a PLY file.");
+        return false;
+      }
+      continue;
+    }
+
+    if (tokens.empty() || tokens[0] == "comment" || tokens[0] == "obj_info") {
+      continue;
+    }
+
+    if (tokens[0] == "format" && tokens.size() >= 2) {
+      if (tokens[1] == "ascii") {
+        _format = Format::ASCII;
+      } else if (tokens[1] == "binary_little_endian") {
+        _format = Format::BINARY_LITTLE_ENDIAN;
+      } else if (tokens[1] == "binary_big_endian") {
+        _format = Format::BINARY_BIG_ENDIAN;
+      } else {
+        LOG_ERROR("Unknown PLY format: " + tokens[1]);
+        return false;
+      }
+      isFormatFound = true;
+    } else if (tokens[0] == "element" && tokens.size() == 3) {
+      Element newElement;
+      newElement.name = tokens[1];
+      newElement.count = 0;
+      newElement.stride = 0;
+      newElement.offset = 0;
+
+      const char* countBegin = tokens[2].data();
+      if (!MappedTextFile::parseInteger(countBegin, countBegin + tokens[2].size(), newElement.count)) {
+        LOG_ERROR("Invalid element count: " + tokens[2]);
+        return false;
+      }
+
+      _elements.push_back(std::move(newElement));
+      currentElement = &_elements.back();
+    } else if (tokens[0] == "property" && currentElement != nullptr) {
+      Property property;
+      property.isList = tokens.size() == 5 && tokens[1] == "list";
+      property.countType = PropertyType::UINT8;
+
+      if (property.isList) {
+        if (!toPropertyType(tokens[2], property.countType) || !toPropertyType(tokens[3], property.type)) {
+          LOG_ERROR("Unknown property type: " + tokens[2] + " " + tokens[3]);
+          return false;
+        }
+        property.name = tokens[4];
+      } else if (tokens.size() == 3) {
+        if (!toPropertyType(tokens[1], property.type)) {
+          LOG_ERROR("Unknown property type: " + tokens[1]);
+          return false;
+        }
+        property.name = tokens[2];
+      } else {
+        LOG_ERROR("Invalid property declaration.");
+        return false;
+      }
+
+      currentElement->properties.push_back(property);
+    } else if (tokens[0] == "end_header") {
+      headerSize = (size_t)(lineBegin - data);
+      break;
+    } else {
+      LOG_ERROR("Unknown PLY header line: " + tokens[0]);
+      return false;
+    }
+  }
+
+  if (headerSize == 0 || !isFormatFound) {
+    return false;
+  }
+
+  // Fixed-size records
+  for (Element& element : _elements) {
+    size_t stride = 0;
+
+    for (const Property& property : element.properties) {
+      if (property.isList) {
+        stride = 0;
+        break;
+      }
+      stride += getTypeSize(property.type);
+    }
+
+    element.stride = stride;
+  }
+
+  return true;
+}
+
+bool PlyFile::locateElements(const size_t headerSize, const size_t nHeaderLines) {
+  if (_format == Format::ASCII) {
+    // NOTE: One record per line
+    _file->countLines();
+
+    size_t offset = nHeaderLines;
+    for (Element& element : _elements) {
+      element.offset = offset;
+      offset += element.count;
+    }
+
+    return offset <= _file->getNumLines();
+  }
+
+  // NOTE: Elements after the last one which is decoded are not located, since that would need a scan of list records
+  size_t nElementsToLocate = 0;
+  for (size_t iElement = 0; iElement < _elements.size(); ++iElement) {
+    if (_elements[iElement].name == "vertex" || _elements[iElement].name == "face") {
+      nElementsToLocate = iElement + 1;
+    }
+  }
+
+  const char* data = _file->getData();
+  const size_t fileSize = _file->getFileSize();
+  const bool toSwap = isByteSwapped();
+
+  size_t offset = headerSize;
+
+  for (size_t iElement = 0; iElement < nElementsToLocate; ++iElement) {
+    Element& element = _elements[iElement];
+    element.offset = offset;
+
+    if (element.stride > 0) {
+      if (element.count > (fileSize - offset) / element.stride) {
+        return false;
+      }
+      offset += element.count * element.stride;
+      continue;
+    }
+
+    // Scan variable-size records
+    element.chunkOffsets.clear();
+
+    for (size_t iRecord = 0; iRecord < element.count; ++iRecord) {
+      if (iRecord % CHUNK_SIZE == 0) {
+        element.chunkOffsets.push_back(offset);
+      }
+
+      for (const Property& property : element.properties) {
+        if (property.isList) {
+          const size_t countSize = getTypeSize(property.countType);
+          if (offset + countSize > fileSize) {
+            return false;
+          }
+
+          const double count = decodeBinary(data + offset, property.countType, toSwap);
+          if (count < 0.0) {
+            return false;
+          }
+
+          offset += countSize;
+
+          const size_t listSize = (size_t)count * getTypeSize(property.type);
+          if (listSize > fileSize - offset) {
+            return false;
+          }
+          offset += listSize;
+        } else {
+          offset += getTypeSize(property.type);
+          if (offset > fileSize) {
+            return false;
+          }
+        }
+      }
+    }
+
+    element.chunkOffsets.push_back(offset);
+  }
+
+  return true;
+}
+
+const PlyFile::Element* PlyFile::findElement(const std::string& name) const {
+  for (const Element& element : _elements) {
+    if (element.name == name) {
+      return &element;
+    }
+  }
+  return nullptr;
+}
+
+bool PlyFile::isByteSwapped() const {
+  const uint16_t probe = 1;
+  uint8_t firstByte = 0;
+  std::memcpy(&firstByte, &probe, 1);
+
+  const bool isHostLittleEndian = firstByte == 1;
+
+  return (_format == Format::BINARY_LITTLE_ENDIAN && !isHostLittleEndian) ||
+         (_format == Format::BINARY_BIG_ENDIAN && isHostLittleEndian);
+}
+
+size_t PlyFile::getNumVertices() const {
+  const Element* element = findElement("vertex");
+  return element == nullptr ? 0 : element->count;
+}
+
+size_t PlyFile::getNumFaces() const {
+  const Element* element = findElement("face");
+  return element == nullptr ? 0 : element->count;
+}
+
+bool PlyFile::toPropertyType(const std::string& name, PropertyType& type) {
+  if (name == "char" || name == "int8") {
+    type = PropertyType::INT8;
+  } else if (name == "uchar" || name == "uint8") {
+    type = PropertyType::UINT8;
+  } else if (name == "short" || name == "int16") {
+    type = PropertyType::INT16;
+  } else if (name == "ushort" || name == "uint16") {
+    type = PropertyType::UINT16;
+  } else if (name == "int" || name == "int32") {
+    type = PropertyType::INT32;
+  } else if (name == "uint" || name == "uint32") {
+    type = PropertyType::UINT32;
+  } else if (name == "float" || name == "float32") {
+    type = PropertyType::FLOAT32;
+  } else if (name == "double" || name == "float64") {
+    type = PropertyType::FLOAT64;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+size_t PlyFile::getTypeSize(const PropertyType type) {
+  switch (type) {
+    case PropertyType::INT8:
+    case PropertyType::UINT8:
+      return 1;
+    case PropertyType::INT16:
+    case PropertyType::UINT16:
+      return 2;
+    case PropertyType::INT32:
+    case PropertyType::UINT32:
+    case PropertyType::FLOAT32:
+      return 4;
+    case PropertyType::FLOAT64:
+      return 8;
+  }
+  return 0;
+}
+
+double PlyFile::decodeBinary(const char* data, const PropertyType type, const bool isByteSwapped) {
+  // NOTE: Copy to a local buffer since the records are not aligned
+  unsigned char bytes[8];
+  const size_t size = getTypeSize(type);
+
+  std::memcpy(bytes, data, size);
+
+  if (isByteSwapped) {
+    std::reverse(bytes, bytes + size);
+  }
+
+  switch (type) {
+    case PropertyType::INT8: {
+      int8_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::UINT8: {
+      uint8_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::INT16: {
+      int16_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::UINT16: {
+      uint16_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::INT32: {
+      int32_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::UINT32: {
+      uint32_t value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::FLOAT32: {
+      float value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return (double)value;
+    }
+    case PropertyType::FLOAT64: {
+      double value;
+      std::memcpy(&value, bytes, sizeof(value));
+      return value;
+    }
+  }
+  return 0.0;
+}
+
+bool PlyFile::parseAscii(const char*& cursor, const char* end, const PropertyType type, double& value) {
+  if (type == PropertyType::FLOAT32) {
+    float floatValue = 0.0f;
+    if (!MappedTextFile::parseFloat(cursor, end, floatValue)) {
+      return false;
+    }
+    value = (double)floatValue;
+    return true;
+  }
+
+  if (type == PropertyType::FLOAT64) {
+    return MappedTextFile::parseFloat(cursor, end, value);
+  }
+
+  int64_t intValue = 0;
+  if (!MappedTextFile::parseInteger(cursor, end, intValue)) {
+    return false;
+  }
+  value = (double)intValue;
+  return true;
+}
+
+bool PlyFile::readVertices(std::vector<Vertex>& vertices, bool& hasNormals) const {
+  return readVertices(0, getNumVertices(), vertices, hasNormals);
+}
+
+bool PlyFile::readVertices(const size_t firstVertex,
+                           const size_t nVertices,
+                           std::vector<Vertex>& vertices,
+                           bool& hasNormals) const {
+  const Element* element = findElement("vertex");
+  if (element == nullptr) {
+    LOG_ERROR("PLY file has no vertex element.");
+    return false;
+  }
+
+  if (firstVertex + nVertices > element->count) {
+    LOG_ERROR("PLY vertex range is out of the element.");
+    return false;
+  }
+
+  // =========================================================================================
+  // Map properties to vertex attributes
+  // =========================================================================================
+  enum Target {
+    NONE,
+    POSITION_X,
+    POSITION_Y,
+    POSITION_Z,
+    NORMAL_X,
+    NORMAL_Y,
+    NORMAL_Z,
+    COLOR_R,
+    COLOR_G,
+    COLOR_B,
+    UV_U,
+    UV_V,
+    SCALAR
+  };
+
+  const size_t nProperties = element->properties.size();
+  std::vector<Target> targets(nProperties, NONE);
+  std::vector<double> scales(nProperties, 1.0);
+
+  bool isScalarFound = false;
+  int nNormalComponents = 0;
+
+  for (size_t iProperty = 0; iProperty < nProperties; ++iProperty) {
+    const Property& property = element->properties[iProperty];
+    const std::string& name = property.name;
+
+    if (property.isList) {
+      continue;
+    }
+
+    if (name == "x") {
+      targets[iProperty] = POSITION_X;
+    } else if (name == "y") {
+      targets[iProperty] = POSITION_Y;
+    } else if (name == "z") {
+      targets[iProperty] = POSITION_Z;
+    } else if (name == "nx" || name == "normal_x") {
+      targets[iProperty] = NORMAL_X;
+    } else if (name == "ny" || name == "normal_y") {
+      targets[iProperty] = NORMAL_Y;
+    } else if (name == "nz" || name == "normal_z") {
+      targets[iProperty] = NORMAL_Z;
+    } else if (name == "red" || name == "r" || name == "diffuse_red") {
+      targets[iProperty] = COLOR_R;
+    } else if (name == "green" || name == "g" || name == "diffuse_green") {
+      targets[iProperty] = COLOR_G;
+    } else if (name == "blue" || name == "b" || name == "diffuse_blue") {
+      targets[iProperty] = COLOR_B;
+    } else if (name == "u" || name == "s" || name == "texture_u") {
+      targets[iProperty] = UV_U;
+    } else if (name == "v" || name == "t" || name == "texture_v") {
+      targets[iProperty] = UV_V;
+    } else if (name != "alpha" && !isScalarFound) {
+      targets[iProperty] = SCALAR;
+      isScalarFound = true;
+    }
+
+    if (targets[iProperty] == NORMAL_X || targets[iProperty] == NORMAL_Y || targets[iProperty] == NORMAL_Z) {
+      ++nNormalComponents;
+    }
+
+    // Integer colors are normalized to [0, 1]
+    if (targets[iProperty] == COLOR_R || targets[iProperty] == COLOR_G || targets[iProperty] == COLOR_B) {
+      if (property.type == PropertyType::UINT8) {
+        scales[iProperty] = 1.0 / 255.0;
+      } else if (property.type == PropertyType::UINT16) {
+        scales[iProperty] = 1.0 / 65535.0;
+      }
+    }
+  }
+
+  hasNormals = nNormalComponents == 3;
+
+  const Vertex defaultVertex(glm::vec3(0.0f), glm::vec3(1.0f), glm::vec3(0.0f), glm::vec3(0.0f), glm::vec2(0.0f), 0.0f);
+
+  const auto setAttribute = [&targets, &scales](Vertex& vertex, const size_t iProperty, const double value) {
+    const float scaled = (float)(value * scales[iProperty]);
+
+    switch (targets[iProperty]) {
+      case POSITION_X:
+        vertex.position.x = scaled;
+        break;
+      case POSITION_Y:
+        vertex.position.y = scaled;
+        break;
+      case POSITION_Z:
+        vertex.position.z = scaled;
+        break;
+      case NORMAL_X:
+        vertex.normal.x = scaled;
+        break;
+      case NORMAL_Y:
+        vertex.normal.y = scaled;
+        break;
+      case NORMAL_Z:
+        vertex.normal.z = scaled;
+        break;
+      case COLOR_R:
+        vertex.color.r = scaled;
+        break;
+      case COLOR_G:
+        vertex.color.g = scaled;
+        break;
+      case COLOR_B:
+        vertex.color.b = scaled;
+        break;
+      case UV_U:
+        vertex.uv.x = scaled;
+        break;
+      case UV_V:
+        vertex.uv.y = scaled;
+        break;
+      case SCALAR:
+        vertex.id = scaled;
+        break;
+      case NONE:
+        break;
+    }
+  };
+
+  vertices.resize(nVertices);
+
+  // =========================================================================================
+  // Decode
+  // =========================================================================================
+  if (_format == Format::ASCII) {
+    return _file->forEachLine(element->offset + firstVertex, nVertices, [&](const size_t iVertex, const char* begin, const char* end) {
+      Vertex vertex = defaultVertex;
+      double value = 0.0;
+
+      for (size_t iProperty = 0; iProperty < nProperties; ++iProperty) {
+        const Property& property = element->properties[iProperty];
+
+        if (!parseAscii(begin, end, property.isList ? property.countType : property.type, value)) {
+          return false;
+        }
+
+        if (property.isList) {
+          // Skip the items
+          const int64_t nItems = (int64_t)value;
+          for (int64_t iItem = 0; iItem < nItems; ++iItem) {
+            if (!parseAscii(begin, end, property.type, value)) {
+              return false;
+            }
+          }
+          continue;
+        }
+
+        setAttribute(vertex, iProperty, value);
+      }
+
+      vertices[iVertex] = vertex;
+      return true;
+    });
+  }
+
+  const char* data = _file->getData();
+  const bool toSwap = isByteSwapped();
+  const size_t lastVertex = firstVertex + nVertices;
+
+  // NOTE: Chunks of the element overlapping the range
+  const int64_t firstChunk = (int64_t)(firstVertex / CHUNK_SIZE);
+  const int64_t lastChunk = (int64_t)((lastVertex + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+  parallelFor(
+      firstChunk,
+      lastChunk,
+      [&](const int64_t iChunk) {
+        const size_t chunkFirstVertex = (size_t)iChunk * CHUNK_SIZE;
+        const size_t chunkLastVertex = std::min(chunkFirstVertex + CHUNK_SIZE, lastVertex);
+
+        // NOTE: Records of variable size are decoded from the head of the chunk, and those before the range are skipped
+        const size_t iFirstDecoded = element->stride > 0 ? std::max(chunkFirstVertex, firstVertex) : chunkFirstVertex;
+        const char* cursor = data + (element->stride > 0 ? element->offset + iFirstDecoded * element->stride
+                                                         : element->chunkOffsets[iChunk]);
+
+        for (size_t iVertex = iFirstDecoded; iVertex < chunkLastVertex; ++iVertex) {
+          Vertex vertex = defaultVertex;
+
+          for (size_t iProperty = 0; iProperty < nProperties; ++iProperty) {
+            const Property& property = element->properties[iProperty];
+
+            if (property.isList) {
+              const size_t nItems = (size_t)decodeBinary(cursor, property.countType, toSwap);
+              cursor += getTypeSize(property.countType) + nItems * getTypeSize(property.type);
+              continue;
+            }
+
+            setAttribute(vertex, iProperty, decodeBinary(cursor, property.type, toSwap));
+            cursor += getTypeSize(property.type);
+          }
+
+          if (iVertex >= firstVertex) {
+            vertices[iVertex - firstVertex] = vertex;
+          }
+        }
+      },
+      1);
+
+  return true;
+}
+
+bool PlyFile::readTriangles(std::vector<uint32_t>& triangles) const {
+  triangles.clear();
+
+  const Element* element = findElement("face");
+  if (element == nullptr) {
+    return true;
+  }
+
+  const size_t nProperties = element->properties.size();
+
+  size_t iIndexProperty = nProperties;
+  for (size_t iProperty = 0; iProperty < nProperties; ++iProperty) {
+    const Property& property = element->properties[iProperty];
+
+    if (property.isList && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+      iIndexProperty = iProperty;
+      break;
+    }
+  }
+
+  if (iIndexProperty == nProperties) {
+    LOG_ERROR("PLY face element has no vertex index list.");
+    return false;
+  }
+
+  const double nVertices = (double)getNumVertices();
+
+  // Split a polygon into a triangle fan. Returns false on an invalid index.
+  const auto emitFan = [nVertices](uint32_t* dist, const double* polygon, const size_t nCorners) {
+    for (size_t iCorner = 0; iCorner < nCorners; ++iCorner) {
+      if (polygon[iCorner] < 0.0 || polygon[iCorner] >= nVertices) {
+        return false;
+      }
+    }
+
+    for (size_t iCorner = 1; iCorner + 1 < nCorners; ++iCorner) {
+      *(dist++) = (uint32_t)polygon[0];
+      *(dist++) = (uint32_t)polygon[iCorner];
+      *(dist++) = (uint32_t)polygon[iCorner + 1];
+    }
+
+    return true;
+  };
+
+  // NOTE: Polygons are rarely larger than this. Larger ones are read into a heap buffer.
+  const size_t maxStackCorners = 16;
+
+  if (_format == Format::ASCII) {
+    // =========================================================================================
+    // Count triangles per face
+    // =========================================================================================
+    std::vector<size_t> triangleOffsets(element->count + 1, 0);
+
+    const bool isCounted = _file->forEachLine(element->offset, element->count, [&](const size_t iFace, const char* begin, const char* end) {
+      double value = 0.0;
+
+      for (size_t iProperty = 0; iProperty <= iIndexProperty; ++iProperty) {
+        const Property& property = element->properties[iProperty];
+
+        if (!parseAscii(begin, end, property.isList ? property.countType : property.type, value)) {
+          return false;
+        }
+
+        if (iProperty == iIndexProperty) {
+          if (value < 0.0) {
+            return false;
+          }
+          triangleOffsets[iFace + 1] = value >= 3.0 ? (size_t)value - 2 : 0;
+        } else if (property.isList) {
+          const int64_t nItems = (int64_t)value;
+          for (int64_t iItem = 0; iItem < nItems; ++iItem) {
+            if (!parseAscii(begin, end, property.type, value)) {
+              return false;
+            }
+          }
+        }
+      }
+
+      return true;
+    });
+
+    if (!isCounted) {
+      LOG_ERROR("Failed to read PLY faces.");
+      return false;
+    }
+
+    // Prefix sum
+    for (size_t iFace = 0; iFace < element->count; ++iFace) {
+      triangleOffsets[iFace + 1] += triangleOffsets[iFace];
+    }
+
+    triangles.resize(3 * triangleOffsets.back());
+
+    // =========================================================================================
+    // Decode
+    // =========================================================================================
+    const bool isDecoded = _file->forEachLine(element->offset, element->count, [&](const size_t iFace, const char* begin, const char* end) {
+      double value = 0.0;
+
+      for (size_t iProperty = 0; iProperty < iIndexProperty; ++iProperty) {
+        const Property& property = element->properties[iProperty];
+
+        parseAscii(begin, end, property.isList ? property.countType : property.type, value);
+
+        if (property.isList) {
+          const int64_t nItems = (int64_t)value;
+          for (int64_t iItem = 0; iItem < nItems; ++iItem) {
+            parseAscii(begin, end, property.type, value);
+          }
+        }
+      }
+
+      const PropertyType itemType = element->properties[iIndexProperty].type;
+      parseAscii(begin, end, element->properties[iIndexProperty].countType, value);
+
+      const size_t nCorners = (size_t)value;
+      double stackPolygon[maxStackCorners];
+      std::vector<double> heapPolygon(nCorners > maxStackCorners ? nCorners : 0);
+      double* polygon = nCorners > maxStackCorners ? heapPolygon.data() : stackPolygon;
+
+      for (size_t iCorner = 0; iCorner < nCorners; ++iCorner) {
+        if (!parseAscii(begin, end, itemType, polygon[iCorner])) {
+          return false;
+        }
+      }
+
+      return emitFan(triangles.data() + 3 * triangleOffsets[iFace], polygon, nCorners);
+    });
+
+    if (!isDecoded) {
+      LOG_ERROR("Failed to read PLY faces, or a face refers to a missing vertex.");
+      triangles.clear();
+      return false;
+    }
+
+    return true;
+  }
+
+  // =========================================================================================
+  // Count triangles per chunk
+  // =========================================================================================
+  const char* data = _file->getData();
+  const bool toSwap = isByteSwapped();
+  const int64_t nChunks = (int64_t)((element->count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+  std::vector<size_t> chunkTriangleOffsets(nChunks + 1, 0);
+
+  // Visit the faces of a chunk. 'func(iProperty, cursor)' is called at the head of each property.
+  const auto forEachFaceInChunk = [&](const int64_t iChunk, const auto& func) {
+    const size_t firstFace = (size_t)iChunk * CHUNK_SIZE;
+    const size_t lastFace = std::min(firstFace + CHUNK_SIZE, element->count);
+
+    const char* cursor = data + (element->stride > 0 ? element->offset + firstFace * element->stride
+                                                     : element->chunkOffsets[iChunk]);
+
+    for (size_t iFace = firstFace; iFace < lastFace; ++iFace) {
+      for (size_t iProperty = 0; iProperty < nProperties; ++iProperty) {
+        const Property& property = element->properties[iProperty];
+
+        func(iProperty, cursor);
+
+        if (property.isList) {
+          const size_t nItems = (size_t)decodeBinary(cursor, property.countType, toSwap);
+          cursor += getTypeSize(property.countType) + nItems * getTypeSize(property.type);
+        } else {
+          cursor += getTypeSize(property.type);
+        }
+      }
+    }
+  };
+
+  const PropertyType countType = element->properties[iIndexProperty].countType;
+  const PropertyType itemType = element->properties[iIndexProperty].type;
+  const size_t countSize = getTypeSize(countType);
+  const size_t itemSize = getTypeSize(itemType);
+
+  parallelFor(
+      0,
+      nChunks,
+      [&](const int64_t iChunk) {
+        size_t nTriangles = 0;
+
+        forEachFaceInChunk(iChunk, [&](const size_t iProperty, const char* cursor) {
+          if (iProperty == iIndexProperty) {
+            const size_t nCorners = (size_t)decodeBinary(cursor, countType, toSwap);
+            nTriangles += nCorners >= 3 ? nCorners - 2 : 0;
+          }
+        });
+
+        chunkTriangleOffsets[iChunk + 1] = nTriangles;
+      },
+      1);
+
+  // Prefix sum
+  for (int64_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+    chunkTriangleOffsets[iChunk + 1] += chunkTriangleOffsets[iChunk];
+  }
+
+  triangles.resize(3 * chunkTriangleOffsets.back());
+
+  // =========================================================================================
+  // Decode
+  // =========================================================================================
+  const int64_t nFailures = parallelReduce<int64_t>(
+      0,
+      nChunks,
+      0,
+      [&](const int64_t iChunk) {
+        int64_t nChunkFailures = 0;
+
+        uint32_t* dist = triangles.data() + 3 * chunkTriangleOffsets[iChunk];
+        std::vector<double> polygon;
+
+        forEachFaceInChunk(iChunk, [&](const size_t iProperty, const char* cursor) {
+          if (iProperty != iIndexProperty) {
+            return;
+          }
+
+          const size_t nCorners = (size_t)decodeBinary(cursor, countType, toSwap);
+          const char* items = cursor + countSize;
+
+          polygon.resize(nCorners);
+          for (size_t iCorner = 0; iCorner < nCorners; ++iCorner) {
+            polygon[iCorner] = decodeBinary(items + iCorner * itemSize, itemType, toSwap);
+          }
+
+          if (!emitFan(dist, polygon.data(), nCorners)) {
+            ++nChunkFailures;
+          }
+
+          dist += nCorners >= 3 ? 3 * (nCorners - 2) : 0;
+        });
+
+        return nChunkFailures;
+      },
+      std::plus<int64_t>(),
+      1);
+
+  if (nFailures > 0) {
+    LOG_ERROR("A PLY face refers to a missing vertex.");
+    triangles.clear();
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace util
+}  // namespace simview
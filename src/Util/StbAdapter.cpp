@@ -12,12 +12,14 @@ void api_stbi_image_free(void *retval_from_stbi_load) {
   stbi_image_free(retval_from_stbi_load);
 }
 
-void saveImage(const int width, const int height, const int channels, unsigned char *bytes, const std::string filePath) {
+bool saveImage(const int width, const int height, const int channels, unsigned char *bytes, const std::string filePath) {
   if (bytes == nullptr) {
     LOG_ERROR("Bytes is nullptr!");
-    return;
+    return false;
   }
 
+  int isSaved = 0;
+
   try {
     const std::string dirPath = FileUtil::dirPath(filePath);
     if (!FileUtil::exists(dirPath)) {
@@ -26,9 +28,9 @@ void saveImage(const int width, const int height, const int channels, unsigned c
 
     const std::string extension = FileUtil::extension(filePath);
     if (extension == ".png") {
-      stbi_write_png(filePath.c_str(), width, height, channels, bytes, 0);
+      isSaved = stbi_write_png(filePath.c_str(), width, height, channels, bytes, 0);
     } else if (extension == ".jpg") {
-      stbi_write_jpg(filePath.c_str(), width, height, channels, bytes, 100);
+      isSaved = stbi_write_jpg(filePath.c_str(), width, height, channels, bytes, 100);
     } else {
       LOG_ERROR("Unsupported save image format: " + extension);
     }
@@ -36,6 +38,8 @@ void saveImage(const int width, const int height, const int channels, unsigned c
     LOG_ERROR("[Error] See below messages.");
     LOG_ERROR(error.what());
   }
+
+  return isSaved != 0;
 };
 
 }  // namespace stb
@@ -0,0 +1,137 @@
+#include <SimView/Util/TaskScheduler.hpp>
+
+namespace simview {
+namespace util {
+
+TaskScheduler::TaskScheduler(size_t nThreads)
+    : _queues(),
+      _threads(),
+      _nPendingTasks(0),
+      _nextQueue(0),
+      _sleepMutex(),
+      _sleepCondition(),
+      _isStopped(false) {
+  if (nThreads == 0) {
+    nThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  for (size_t iWorker = 0; iWorker < nThreads; ++iWorker) {
+    _queues.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  for (size_t iWorker = 0; iWorker < nThreads; ++iWorker) {
+    _threads.emplace_back([this, iWorker]() { workerLoop(iWorker); });
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _isStopped = true;
+  }
+
+  _sleepCondition.notify_all();
+
+  // NOTE: Workers finish the remaining tasks before they exit
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+TaskScheduler& TaskScheduler::getInstance() {
+  static TaskScheduler scheduler;
+  return scheduler;
+}
+
+void TaskScheduler::enqueue(Task task) {
+  // NOTE: A worker pushes to its own deque. Other threads distribute tasks over the deques in turn.
+  const size_t iQueue = _currentScheduler == this
+                            ? _currentWorker
+                            : _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+
+  ++_nPendingTasks;
+
+  {
+    WorkerQueue& queue = *_queues[iQueue];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+
+  {
+    // NOTE: Lock so that the notification is not lost between the check and the wait of a worker
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+  }
+  _sleepCondition.notify_one();
+}
+
+bool TaskScheduler::popTask(Task& task) {
+  const size_t nQueues = _queues.size();
+  const bool isWorker = _currentScheduler == this;
+  const size_t iOwnQueue = isWorker ? _currentWorker : 0;
+
+  if (isWorker) {
+    WorkerQueue& queue = *_queues[iOwnQueue];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --_nPendingTasks;
+      return true;
+    }
+  }
+
+  // Steal the oldest task from the others
+  for (size_t iOffset = isWorker ? 1 : 0; iOffset < nQueues; ++iOffset) {
+    WorkerQueue& queue = *_queues[(iOwnQueue + iOffset) % nQueues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --_nPendingTasks;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool TaskScheduler::runPendingTask() {
+  Task task;
+
+  if (!popTask(task)) {
+    return false;
+  }
+
+  try {
+    task();
+  } catch (const std::exception& exception) {
+    LOG_ERROR("Uncaught exception in a task: " + std::string(exception.what()));
+  } catch (...) {
+    LOG_ERROR("Uncaught exception in a task.");
+  }
+
+  return true;
+}
+
+void TaskScheduler::workerLoop(const size_t iWorker) {
+  _currentScheduler = this;
+  _currentWorker = iWorker;
+
+  while (true) {
+    if (runPendingTask()) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    _sleepCondition.wait(lock, [this]() { return _isStopped || _nPendingTasks > 0; });
+
+    if (_isStopped && _nPendingTasks == 0) {
+      return;
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace simview
@@ -3,7 +3,7 @@
 namespace simview {
 namespace util {
 
-void Texture::loadTexture(const std::string& filePath, GLuint& texID) {
+void Texture::loadTexture(const std::string& filePath, GLTexture& texID) {
   // Texture ============================================================================================
   int texWidth, texHeight, channels;
   unsigned char* bytesTexture = stb::api_stbi_load(filePath.c_str(), &texWidth, &texHeight, &channels, stb::api_STBI_rgb_alpha);
@@ -24,7 +24,7 @@ void Texture::loadTexture(const unsigned char* bytes,
                           const int& width,
                           const int& height,
                           const int& channels,
-                          GLuint& texID) {
+                          GLTexture& texID) {
   GLint internalFormat = -1;
   GLenum format = -1;
 
@@ -36,8 +36,8 @@ void Texture::loadTexture(const unsigned char* bytes,
     format = GL_RGBA;
   }
 
-  glGenTextures(1, &texID);
-  glBindTexture(GL_TEXTURE_2D, texID);
+  texID.create();
+  GLStateCache::getInstance().bindTexture2D(texID);
   glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, bytes);
 
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -46,7 +46,7 @@ void Texture::loadTexture(const unsigned char* bytes,
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
   glGenerateMipmap(GL_TEXTURE_2D);
 
-  glBindTexture(GL_TEXTURE_2D, 0);
+  GLStateCache::getInstance().bindTexture2D(0);
 }
 
 void Texture::readTexture(const std::string& filePath, Texture::TextureArray texture) {
@@ -0,0 +1,213 @@
+#include <SimView/Util/VertexCache.hpp>
+
+namespace simview {
+namespace util {
+
+uint64_t VertexCache::alignOffset(const uint64_t offset) {
+  return ((offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT) * DATA_ALIGNMENT;
+}
+
+std::string VertexCache::getCacheDirPath() {
+  if (_cacheDirPath.empty()) {
+    return (generic_fs::temp_directory_path() / "SimView").string();
+  }
+  return _cacheDirPath;
+}
+
+std::string VertexCache::getCacheFilePath(const std::string& absFilePath) {
+  // NOTE: The source path is also stored in the header, so hash collisions are detected on load
+  char hashString[17];
+  snprintf(hashString, sizeof(hashString), "%016llx", (unsigned long long)std::hash<std::string>()(absFilePath));
+
+  const std::string cacheFileName = FileUtil::baseName(absFilePath) + "-" + std::string(hashString) + EXTENSION;
+
+  return FileUtil::join(getCacheDirPath(), cacheFileName);
+}
+
+VertexCacheKey VertexCache::createKey(const std::string& filePath,
+                                      const float offsetX,
+                                      const float offsetY,
+                                      const float offsetZ,
+                                      const bool autoScale,
+                                      const bool weldVertices,
+                                      const bool indexed) {
+  VertexCacheKey key;
+
+  key.filePath = FileUtil::absPath(filePath);
+  key.fileSize = 0;
+  key.lastWriteTime = 0;
+  key.offsetX = offsetX;
+  key.offsetY = offsetY;
+  key.offsetZ = offsetZ;
+  key.autoScale = autoScale;
+  key.weldVertices = weldVertices;
+  key.indexed = indexed;
+
+  if (FileUtil::isFile(key.filePath)) {
+    key.fileSize = FileUtil::fileSize(key.filePath);
+    key.lastWriteTime = FileUtil::lastWriteTime(key.filePath);
+  }
+
+  return key;
+}
+
+bool VertexCache::isCacheable(const VertexCacheKey& key) {
+  return _isEnabled && key.fileSize >= MIN_SOURCE_FILE_SIZE;
+}
+
+bool VertexCache::isValidHeader(const Header& header, const VertexCacheKey& key) {
+  return std::equal(MAGIC, MAGIC + sizeof(MAGIC), header.magic) &&
+         header.version == VERSION &&
+         header.vertexStride == sizeof(Vertex) &&
+         header.sourceFileSize == (uint64_t)key.fileSize &&
+         header.sourceLastWriteTime == key.lastWriteTime &&
+         header.offsetX == key.offsetX &&
+         header.offsetY == key.offsetY &&
+         header.offsetZ == key.offsetZ &&
+         header.autoScale == (uint32_t)key.autoScale &&
+         header.weldVertices == (uint32_t)key.weldVertices &&
+         header.indexed == (uint32_t)key.indexed &&
+         header.pathLength == key.filePath.size();
+}
+
+bool VertexCache::load(const VertexCacheKey& key,
+                       VertexArray_t vertices,
+                       IndexArray_t indices) {
+  if (!isCacheable(key)) {
+    return false;
+  }
+
+  const std::string cacheFilePath = getCacheFilePath(key.filePath);
+
+  if (!FileUtil::isFile(cacheFilePath)) {
+    return false;
+  }
+
+  std::ifstream file(cacheFilePath, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  Header header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(Header));
+
+  if (!file || !isValidHeader(header, key)) {
+    LOG_INFO("Vertex cache is outdated: " + cacheFilePath);
+    return false;
+  }
+
+  std::string sourcePath(header.pathLength, '\0');
+  file.read(sourcePath.data(), header.pathLength);
+
+  if (!file || sourcePath != key.filePath) {
+    return false;
+  }
+
+  const uint64_t vertexBytes = header.nVertices * sizeof(Vertex);
+  const uint64_t indexBytes = header.nIndices * sizeof(uint32_t);
+
+  if (header.indexOffset + indexBytes != FileUtil::fileSize(cacheFilePath)) {
+    LOG_WARN("Vertex cache is broken: " + cacheFilePath);
+    return false;
+  }
+
+  // NOTE: Read straight into the output arrays. There is no parsing left.
+  vertices->resize(header.nVertices);
+  file.seekg(header.vertexOffset, std::ios::beg);
+  file.read(reinterpret_cast<char*>(vertices->data()), vertexBytes);
+
+  indices->resize(header.nIndices);
+  file.seekg(header.indexOffset, std::ios::beg);
+  file.read(reinterpret_cast<char*>(indices->data()), indexBytes);
+
+  if (!file) {
+    LOG_WARN("Failed to read vertex cache: " + cacheFilePath);
+    vertices->clear();
+    indices->clear();
+    return false;
+  }
+
+  LOG_INFO("Loaded from vertex cache: " + cacheFilePath);
+
+  return true;
+}
+
+bool VertexCache::store(const VertexCacheKey& key,
+                        const VertexArray_t& vertices,
+                        const IndexArray_t& indices) {
+  if (!isCacheable(key) || vertices->empty()) {
+    return false;
+  }
+
+  const std::string cacheFilePath = getCacheFilePath(key.filePath);
+  // NOTE: Unique, so that threads or processes storing the same cache do not write to one file
+  const std::string tmpFilePath = FileUtil::uniquePath(cacheFilePath) + ".tmp";
+
+  try {
+    FileUtil::mkdirs(getCacheDirPath());
+  } catch (const generic_fs::filesystem_error& e) {
+    LOG_WARN("Failed to create vertex cache directory: " + std::string(e.what()));
+    return false;
+  }
+
+  Header header;
+  std::copy(MAGIC, MAGIC + sizeof(MAGIC), header.magic);
+  header.version = VERSION;
+  header.vertexStride = sizeof(Vertex);
+  header.sourceFileSize = (uint64_t)key.fileSize;
+  header.sourceLastWriteTime = key.lastWriteTime;
+  header.offsetX = key.offsetX;
+  header.offsetY = key.offsetY;
+  header.offsetZ = key.offsetZ;
+  header.autoScale = (uint32_t)key.autoScale;
+  header.weldVertices = (uint32_t)key.weldVertices;
+  header.indexed = (uint32_t)key.indexed;
+  header.nVertices = vertices->size();
+  header.nIndices = indices->size();
+  header.pathLength = key.filePath.size();
+  header.vertexOffset = alignOffset(sizeof(Header) + header.pathLength);
+  header.indexOffset = alignOffset(header.vertexOffset + header.nVertices * sizeof(Vertex));
+
+  {
+    std::ofstream file(tmpFilePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      LOG_WARN("Failed to open vertex cache: " + tmpFilePath);
+      return false;
+    }
+
+    const std::vector<char> padding(DATA_ALIGNMENT, '\0');
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(key.filePath.data(), header.pathLength);
+    file.write(padding.data(), header.vertexOffset - (sizeof(Header) + header.pathLength));
+
+    file.write(reinterpret_cast<const char*>(vertices->data()), header.nVertices * sizeof(Vertex));
+    file.write(padding.data(), header.indexOffset - (header.vertexOffset + header.nVertices * sizeof(Vertex)));
+
+    file.write(reinterpret_cast<const char*>(indices->data()), header.nIndices * sizeof(uint32_t));
+
+    if (!file) {
+      LOG_WARN("Failed to write vertex cache: " + tmpFilePath);
+      file.close();
+      generic_fs::remove(tmpFilePath);
+      return false;
+    }
+  }
+
+  // NOTE: Replace the cache file at once so that a concurrent reader never sees a partially written file
+  std::error_code errorCode;
+  generic_fs::rename(tmpFilePath, cacheFilePath, errorCode);
+
+  if (errorCode) {
+    LOG_WARN("Failed to store vertex cache: " + errorCode.message());
+    generic_fs::remove(tmpFilePath, errorCode);
+    return false;
+  }
+
+  LOG_INFO("Stored vertex cache: " + cacheFilePath);
+
+  return true;
+}
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,256 @@
+#include <SimView/Util/VertexLayout.hpp>
+
+#include <glm/gtc/packing.hpp>
+
+namespace simview {
+namespace util {
+
+VertexLayout::VertexLayout()
+    : _elements(),
+      _stride(0),
+      _positionScale(1.0f),
+      _positionOffset(0.0f) {
+}
+
+VertexLayout& VertexLayout::add(const VertexAttribute attribute, const VertexEncoding encoding) {
+  const int nComponents = NUM_COMPONENTS[(int)attribute];
+
+  Element element;
+  element.attribute = attribute;
+  element.encoding = encoding;
+  element.offset = _stride;
+
+  GLuint nBytes = 0;
+
+  if (encoding == VertexEncoding::FLOAT32) {
+    element.size = nComponents;
+    element.type = GL_FLOAT;
+    element.normalized = GL_FALSE;
+    nBytes = 4 * nComponents;
+  } else if (encoding == VertexEncoding::HALF_FLOAT) {
+    // NOTE: Keep every attribute 4-byte aligned
+    element.size = nComponents + nComponents % 2;
+    element.type = GL_HALF_FLOAT;
+    element.normalized = GL_FALSE;
+    nBytes = 2 * element.size;
+  } else if (encoding == VertexEncoding::UNORM16_BBOX && attribute == VertexAttribute::POSITION) {
+    element.size = 4;
+    element.type = GL_UNSIGNED_SHORT;
+    element.normalized = GL_TRUE;
+    nBytes = 8;
+  } else if (encoding == VertexEncoding::UNORM8 && attribute == VertexAttribute::COLOR) {
+    element.size = 4;
+    element.type = GL_UNSIGNED_BYTE;
+    element.normalized = GL_TRUE;
+    nBytes = 4;
+  } else if (encoding == VertexEncoding::OCT_SNORM16 && attribute == VertexAttribute::NORMAL) {
+    element.size = 2;
+    element.type = GL_SHORT;
+    element.normalized = GL_TRUE;
+    nBytes = 4;
+  } else {
+    LOG_ERROR("Unsupported vertex encoding for attribute " + std::to_string((int)attribute));
+    return *this;
+  }
+
+  _elements.push_back(element);
+  _stride += nBytes;
+
+  return *this;
+}
+
+VertexLayout VertexLayout::createDefault() {
+  VertexLayout layout;
+  layout.add(VertexAttribute::POSITION, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::COLOR, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::NORMAL, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::BARY, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::UV, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::ID, VertexEncoding::FLOAT32);
+  return layout;
+}
+
+VertexLayout VertexLayout::createPointCloud() {
+  VertexLayout layout;
+  layout.add(VertexAttribute::POSITION, VertexEncoding::UNORM16_BBOX)
+      .add(VertexAttribute::COLOR, VertexEncoding::UNORM8);
+  return layout;
+}
+
+VertexLayout VertexLayout::createCompactMesh() {
+  // NOTE: UVs are kept in 32-bit floats, because half floats are not precise enough for large textures
+  VertexLayout layout;
+  layout.add(VertexAttribute::POSITION, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::COLOR, VertexEncoding::UNORM8)
+      .add(VertexAttribute::NORMAL, VertexEncoding::OCT_SNORM16)
+      .add(VertexAttribute::UV, VertexEncoding::FLOAT32);
+  return layout;
+}
+
+VertexLayout VertexLayout::createSphereImpostor() {
+  VertexLayout layout;
+  layout.add(VertexAttribute::POSITION, VertexEncoding::FLOAT32)
+      .add(VertexAttribute::COLOR, VertexEncoding::UNORM8)
+      .add(VertexAttribute::ID, VertexEncoding::FLOAT32);
+  return layout;
+}
+
+bool VertexLayout::hasAttribute(const VertexAttribute attribute) const {
+  for (const auto& element : _elements) {
+    if (element.attribute == attribute) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool VertexLayout::isOctNormal() const {
+  for (const auto& element : _elements) {
+    if (element.attribute == VertexAttribute::NORMAL) {
+      return element.encoding == VertexEncoding::OCT_SNORM16;
+    }
+  }
+  return false;
+}
+
+bool VertexLayout::hasSameFormat(const VertexLayout& other) const {
+  if (_stride != other._stride || _elements.size() != other._elements.size()) {
+    return false;
+  }
+
+  for (size_t iElement = 0; iElement < _elements.size(); ++iElement) {
+    if (_elements[iElement].attribute != other._elements[iElement].attribute ||
+        _elements[iElement].encoding != other._elements[iElement].encoding) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool VertexLayout::isSameAsVertex() const {
+  if (_stride != sizeof(Vertex) || (int)_elements.size() != NUM_ATTRIBUTES) {
+    return false;
+  }
+
+  for (const auto& element : _elements) {
+    if (element.encoding != VertexEncoding::FLOAT32 || element.offset != VERTEX_OFFSETS[(int)element.attribute]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+glm::vec2 VertexLayout::encodeOctNormal(const glm::vec3& normal) {
+  const float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+
+  if (sum <= 0.0f) {
+    return glm::vec2(0.0f);
+  }
+
+  const glm::vec3 n = normal / sum;
+
+  if (n.z >= 0.0f) {
+    return glm::vec2(n.x, n.y);
+  }
+
+  // Fold the lower hemisphere
+  return glm::vec2((1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+                   (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f));
+}
+
+void VertexLayout::encodeElement(const Element& element, const Vertex& vertex, uint8_t* dist) const {
+  const float* values = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(&vertex) + VERTEX_OFFSETS[(int)element.attribute]);
+  const int nComponents = NUM_COMPONENTS[(int)element.attribute];
+
+  if (element.encoding == VertexEncoding::FLOAT32) {
+    std::memcpy(dist, values, 4 * nComponents);
+  } else if (element.encoding == VertexEncoding::HALF_FLOAT) {
+    float padded[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    std::memcpy(padded, values, 4 * nComponents);
+
+    for (int iPair = 0; iPair < element.size / 2; ++iPair) {
+      const uint32_t packed = glm::packHalf2x16(glm::vec2(padded[2 * iPair + 0], padded[2 * iPair + 1]));
+      std::memcpy(dist + 4 * iPair, &packed, 4);
+    }
+  } else if (element.encoding == VertexEncoding::UNORM16_BBOX) {
+    const glm::vec3 normalized = (vertex.position - _positionOffset) / _positionScale;
+
+    const uint32_t packedXY = glm::packUnorm2x16(glm::vec2(normalized.x, normalized.y));
+    const uint32_t packedZW = glm::packUnorm2x16(glm::vec2(normalized.z, 0.0f));
+    std::memcpy(dist + 0, &packedXY, 4);
+    std::memcpy(dist + 4, &packedZW, 4);
+  } else if (element.encoding == VertexEncoding::UNORM8) {
+    const uint32_t packed = glm::packUnorm4x8(glm::vec4(vertex.color, 1.0f));
+    std::memcpy(dist, &packed, 4);
+  } else if (element.encoding == VertexEncoding::OCT_SNORM16) {
+    const uint32_t packed = glm::packSnorm2x16(encodeOctNormal(vertex.normal));
+    std::memcpy(dist, &packed, 4);
+  }
+}
+
+std::vector<uint8_t> VertexLayout::encode(const std::vector<Vertex>& vertices) {
+  const int64_t nVertices = (int64_t)vertices.size();
+
+  _positionScale = glm::vec3(1.0f);
+  _positionOffset = glm::vec3(0.0f);
+
+  for (const auto& element : _elements) {
+    if (element.encoding == VertexEncoding::UNORM16_BBOX && nVertices > 0) {
+      glm::vec3 minCoords = vertices[0].position;
+      glm::vec3 maxCoords = vertices[0].position;
+
+      for (int64_t iVertex = 1; iVertex < nVertices; ++iVertex) {
+        minCoords = glm::min(minCoords, vertices[iVertex].position);
+        maxCoords = glm::max(maxCoords, vertices[iVertex].position);
+      }
+
+      // NOTE: Avoid zero division for flat models
+      _positionScale = glm::max(maxCoords - minCoords, glm::vec3(1e-30f));
+      _positionOffset = minCoords;
+    }
+  }
+
+  std::vector<uint8_t> bytes((size_t)nVertices * _stride);
+
+  parallelFor(0, nVertices, [&](const int64_t iVertex) {
+    uint8_t* dist = bytes.data() + (size_t)iVertex * _stride;
+
+    for (const auto& element : _elements) {
+      encodeElement(element, vertices[iVertex], dist + element.offset);
+    }
+  });
+
+  return bytes;
+}
+
+void VertexLayout::upload(const VertexArray_t& vertices, const GLenum usage) {
+  if (isSameAsVertex()) {
+    // No packing is needed
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices->size(), vertices->data(), usage);
+    return;
+  }
+
+  const std::vector<uint8_t>& bytes = encode(*vertices);
+  glBufferData(GL_ARRAY_BUFFER, bytes.size(), bytes.data(), usage);
+
+  LOG_INFO("Packed vertices: " + std::to_string(sizeof(Vertex)) + " -> " + std::to_string(_stride) + " bytes per vertex");
+}
+
+void VertexLayout::setupAttributes(const GLuint divisor) const {
+  for (int iAttribute = 0; iAttribute < NUM_ATTRIBUTES; ++iAttribute) {
+    glDisableVertexAttribArray(iAttribute);
+  }
+
+  for (const auto& element : _elements) {
+    const GLuint location = (GLuint)element.attribute;
+
+    glEnableVertexAttribArray(location);
+    glVertexAttribPointer(location, element.size, element.type, element.normalized, _stride, (void*)(size_t)element.offset);
+    glVertexAttribDivisor(location, divisor);
+  }
+}
+
+}  // namespace util
+}  // namespace simview
@@ -0,0 +1,122 @@
+#include <SimView/Util/llas.hpp>
+
+#if defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace llas {
+
+LasView::LasView()
+    : _data(nullptr),
+      _fileSize(0),
+      _header(),
+      _decoder(nullptr),
+#if defined(_WIN64)
+      _fileHandle(INVALID_HANDLE_VALUE),
+      _mappingHandle(nullptr)
+#else
+      _fileDescriptor(-1)
+#endif
+{
+}
+
+LasView::~LasView() {
+  unmap();
+}
+
+bool LasView::map(const std::string& filePath) {
+#if defined(_WIN64)
+  _fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (_fileHandle == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(_fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+    return false;
+  }
+  _fileSize = (size_t)fileSize.QuadPart;
+
+  _mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (_mappingHandle == nullptr) {
+    return false;
+  }
+
+  _data = (const char*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  return _data != nullptr;
+#else
+  _fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+  if (_fileDescriptor < 0) {
+    return false;
+  }
+
+  struct stat fileStat;
+  if (::fstat(_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+    return false;
+  }
+  _fileSize = (size_t)fileStat.st_size;
+
+  void* mapped = ::mmap(nullptr, _fileSize, PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  // NOTE: Records are visited front to back, so let the kernel read ahead aggressively
+  ::madvise(mapped, _fileSize, MADV_SEQUENTIAL);
+
+  _data = (const char*)mapped;
+  return true;
+#endif
+}
+
+void LasView::unmap() {
+#if defined(_WIN64)
+  if (_data != nullptr) {
+    UnmapViewOfFile(_data);
+  }
+  if (_mappingHandle != nullptr) {
+    CloseHandle(_mappingHandle);
+  }
+  if (_fileHandle != INVALID_HANDLE_VALUE) {
+    CloseHandle(_fileHandle);
+  }
+  _mappingHandle = nullptr;
+  _fileHandle = INVALID_HANDLE_VALUE;
+#else
+  if (_data != nullptr) {
+    ::munmap((void*)_data, _fileSize);
+  }
+  if (_fileDescriptor >= 0) {
+    ::close(_fileDescriptor);
+  }
+  _fileDescriptor = -1;
+#endif
+  _data = nullptr;
+  _fileSize = 0;
+}
+
+void LasView::releasePages(const size_t beginByte, const size_t endByte) const {
+#if !defined(_WIN64)
+  // NOTE: Round the head up so that pages shared with the preceding chunk are kept
+  const size_t pageSize = (size_t)::sysconf(_SC_PAGESIZE);
+  const size_t alignedBegin = ((beginByte + pageSize - 1) / pageSize) * pageSize;
+  const size_t alignedEnd = (endByte / pageSize) * pageSize;
+
+  if (alignedEnd > alignedBegin) {
+    ::madvise((void*)(_data + alignedBegin), alignedEnd - alignedBegin, MADV_DONTNEED);
+  }
+#endif
+}
+
+}  // namespace llas
@@ -3,10 +3,24 @@
 namespace simview {
 namespace window {
 
-FPSManager::FPSManager()
-    : _fps(DEFAULT_FPS),
-      _invFps(1.0 / _fps),
-      _previousTime(glfwGetTime()) {
+FPSManager::FPSManager(GLFWwindow* window)
+    : _window(window),
+      _previousTime(glfwGetTime()),
+      _fps(DEFAULT_FPS),
+      _invFps(1.0 / DEFAULT_FPS),
+      _isOnDemand(true),
+      _isAnimating(false),
+      _nRequestedFrames(NUM_FRAMES_PER_REQUEST),
+      _prevCursorPosCallback(nullptr),
+      _prevMouseButtonCallback(nullptr),
+      _prevScrollCallback(nullptr),
+      _prevKeyCallback(nullptr),
+      _prevCharCallback(nullptr),
+      _prevCursorEnterCallback(nullptr),
+      _prevWindowFocusCallback(nullptr),
+      _prevWindowIconifyCallback(nullptr),
+      _prevFramebufferSizeCallback(nullptr),
+      _prevWindowRefreshCallback(nullptr) {
 }
 
 FPSManager::~FPSManager() {
@@ -21,17 +35,153 @@ void FPSManager::setFPS(const double& fps) {
   _invFps = 1.0 / _fps;
 }
 
+void FPSManager::installCallbacks() {
+  glfwSetWindowUserPointer(_window, this);
+
+  _prevCursorPosCallback = glfwSetCursorPosCallback(_window, cursorPosCallback);
+  _prevMouseButtonCallback = glfwSetMouseButtonCallback(_window, mouseButtonCallback);
+  _prevScrollCallback = glfwSetScrollCallback(_window, scrollCallback);
+  _prevKeyCallback = glfwSetKeyCallback(_window, keyCallback);
+  _prevCharCallback = glfwSetCharCallback(_window, charCallback);
+  _prevCursorEnterCallback = glfwSetCursorEnterCallback(_window, cursorEnterCallback);
+  _prevWindowFocusCallback = glfwSetWindowFocusCallback(_window, windowFocusCallback);
+  _prevWindowIconifyCallback = glfwSetWindowIconifyCallback(_window, windowIconifyCallback);
+  _prevFramebufferSizeCallback = glfwSetFramebufferSizeCallback(_window, framebufferSizeCallback);
+  _prevWindowRefreshCallback = glfwSetWindowRefreshCallback(_window, windowRefreshCallback);
+}
+
+bool FPSManager::isMinimized() const {
+  return glfwGetWindowAttrib(_window, GLFW_ICONIFIED) == GLFW_TRUE;
+}
+
 bool FPSManager::update() {
+  if (!isDirty() || isMinimized()) {
+    return false;
+  }
+
   bool toUpdate = false;
   const double currentTime = glfwGetTime();
 
   if ((currentTime - _previousTime) > _invFps) {
     toUpdate = true;
     _previousTime = currentTime;
+
+    if (_nRequestedFrames > 0) {
+      --_nRequestedFrames;
+    }
   }
 
   return toUpdate;
 }
 
+void FPSManager::waitEvents() {
+  if (isDirty() && !isMinimized()) {
+    // NOTE: Sleep until the next frame is due instead of spinning
+    const double timeout = _previousTime + _invFps - glfwGetTime();
+    if (timeout > 0.0) {
+      glfwWaitEventsTimeout(timeout);
+    } else {
+      glfwPollEvents();
+    }
+    return;
+  }
+
+  const double startTime = glfwGetTime();
+  glfwWaitEventsTimeout(IDLE_WAIT_TIMEOUT);
+
+  // NOTE: Woken up before the timeout by an event without callbacks, e.g. 'glfwPostEmptyEvent' from a worker
+  if ((glfwGetTime() - startTime) < IDLE_WAIT_TIMEOUT) {
+    requestFrame();
+  }
+}
+
+// ============================================================================================================
+// GLFW callbacks
+// ============================================================================================================
+
+FPSManager* FPSManager::fromWindow(GLFWwindow* window) {
+  return static_cast<FPSManager*>(glfwGetWindowUserPointer(window));
+}
+
+void FPSManager::cursorPosCallback(GLFWwindow* window, double xpos, double ypos) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevCursorPosCallback != nullptr) {
+    fpsManager->_prevCursorPosCallback(window, xpos, ypos);
+  }
+}
+
+void FPSManager::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevMouseButtonCallback != nullptr) {
+    fpsManager->_prevMouseButtonCallback(window, button, action, mods);
+  }
+}
+
+void FPSManager::scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevScrollCallback != nullptr) {
+    fpsManager->_prevScrollCallback(window, xoffset, yoffset);
+  }
+}
+
+void FPSManager::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevKeyCallback != nullptr) {
+    fpsManager->_prevKeyCallback(window, key, scancode, action, mods);
+  }
+}
+
+void FPSManager::charCallback(GLFWwindow* window, unsigned int codepoint) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevCharCallback != nullptr) {
+    fpsManager->_prevCharCallback(window, codepoint);
+  }
+}
+
+void FPSManager::cursorEnterCallback(GLFWwindow* window, int entered) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevCursorEnterCallback != nullptr) {
+    fpsManager->_prevCursorEnterCallback(window, entered);
+  }
+}
+
+void FPSManager::windowFocusCallback(GLFWwindow* window, int focused) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevWindowFocusCallback != nullptr) {
+    fpsManager->_prevWindowFocusCallback(window, focused);
+  }
+}
+
+void FPSManager::windowIconifyCallback(GLFWwindow* window, int iconified) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevWindowIconifyCallback != nullptr) {
+    fpsManager->_prevWindowIconifyCallback(window, iconified);
+  }
+}
+
+void FPSManager::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevFramebufferSizeCallback != nullptr) {
+    fpsManager->_prevFramebufferSizeCallback(window, width, height);
+  }
+}
+
+void FPSManager::windowRefreshCallback(GLFWwindow* window) {
+  FPSManager* fpsManager = fromWindow(window);
+  fpsManager->requestFrame();
+  if (fpsManager->_prevWindowRefreshCallback != nullptr) {
+    fpsManager->_prevWindowRefreshCallback(window);
+  }
+}
+
 }  // namespace window
-}  // namespace simview
\ No newline at end of file
+}  // namespace simview
@@ -24,7 +24,13 @@ ImGuiMainView::ImGuiMainView(GLFWwindow* mainWindow, ViewerModel_t sceneModel)
       _wireFrameColorBuffer(new float[3]),
       _lightPositionBuffer(new float[3]),
       _screenshotFilePathBuffer((char*)calloc(sizeof(char), CHAR_BUFFER_SIZE)),
+      _recordingPathBuffer((char*)calloc(sizeof(char), CHAR_BUFFER_SIZE)),
+      _recordingFormatID(static_cast<int>(renderer::FrameRecorder::Format::PNG)),
+      _recordingFrameStep(1),
+      _recordingFrameRate(30),
       _fpsManager(nullptr),
+      _frameTimeHistory(FRAME_TIME_HISTORY_SIZE, 0.0f),
+      _frameTimeHistoryOffset(0),
       _toOpenExitProgramPopup(false),
       _moveOn(true),
       _isLightBall(false),
@@ -55,6 +61,13 @@ ImGuiMainView::ImGuiMainView(GLFWwindow* mainWindow, ViewerModel_t sceneModel)
   // ====================================================================
   _objectAddDialog = std::make_shared<ImGuiObjectAddPanel>(_sceneModel);
 
+  // ====================================================================
+  // Initialize FPS manager
+  // ====================================================================
+  // NOTE: Before ImGui, which chains its callbacks to these
+  _fpsManager = std::make_shared<FPSManager>(mainWindow);
+  _fpsManager->installCallbacks();
+
   // ====================================================================
   // Initialize ImGui
   // ====================================================================
@@ -85,11 +98,6 @@ ImGuiMainView::ImGuiMainView(GLFWwindow* mainWindow, ViewerModel_t sceneModel)
   // ====================================================================
   NFD_Init();
 
-  // ====================================================================
-  // Initialize FPS manager
-  // ====================================================================
-  _fpsManager = std::make_shared<FPSManager>();
-
   // ====================================================================
   // Initialize scene model state
   // ====================================================================
@@ -250,6 +258,23 @@ void ImGuiMainView::paintSideBar() {
       // Bounding box
       ImGui::Checkbox("Bounding box", &_sceneView->isVisibleBBOX);
       _sceneModel->setIsVisibleBBOX(_sceneView->isVisibleBBOX);
+
+      // Frustum culling
+      bool isEnabledCulling = _sceneModel->getIsEnabledCulling();
+      ImGui::Checkbox("Frustum culling", &isEnabledCulling);
+      _sceneModel->setIsEnabledCulling(isEnabledCulling);
+
+      // Batched drawing
+      if (DrawBatcher::isSupported()) {
+        bool isEnabledBatching = _sceneModel->getDrawBatcher()->getIsEnabled();
+        ImGui::Checkbox("Batched drawing", &isEnabledBatching);
+        _sceneModel->getDrawBatcher()->setIsEnabled(isEnabledBatching);
+      }
+
+      // VRAM budget of the object buffers. 0 for no limit.
+      int budgetMB = (int)(_sceneModel->getResidencyManager().getBudgetBytes() / (1024 * 1024));
+      ImGui::DragInt("Buffer budget (MB)", &budgetMB, 16.0f, 0, 64 * 1024);
+      _sceneModel->getResidencyManager().setBudgetBytes((size_t)std::max(budgetMB, 0) * 1024 * 1024);
     }
 
     // ========================================================================================
@@ -390,6 +415,43 @@ void ImGuiMainView::paintSideBar() {
           ImGui::PopID();
         }
 
+        // Objects loading in background
+        const int rowOffset = _sceneModel->getNumObjects() + _sceneModel->getNumBackgrounds();
+        const auto& loadTasks = _sceneModel->getLoadTasks();
+
+        for (int iTask = 0; iTask < (int)loadTasks.size(); ++iTask) {
+          ImGui::TableNextRow();
+
+          const auto& task = loadTasks[iTask];
+          const ObjectLoadTask::State state = task->getState();
+
+          ImGui::TableNextColumn();
+          ImGui::PushID((rowOffset + iTask) * 4 + 0);
+          ImGui::Text("%s", task->getObject()->getName().c_str());
+          ImGui::PopID();
+
+          ImGui::TableNextColumn();
+          ImGui::PushID((rowOffset + iTask) * 4 + 1);
+          ImGui::Text("%s", task->getObject()->getObjectType().c_str());
+          ImGui::PopID();
+
+          ImGui::TableNextColumn();
+          ImGui::PushID((rowOffset + iTask) * 4 + 2);
+          if (state == ObjectLoadTask::State::UPLOADING) {
+            ImGui::ProgressBar(task->getProgress(), ImVec2(-1.0f, 0.0f));
+          } else {
+            ImGui::Text("%s ...", ObjectLoadTask::getStateName(state).c_str());
+          }
+          ImGui::PopID();
+
+          ImGui::TableNextColumn();
+          ImGui::PushID((rowOffset + iTask) * 4 + 3);
+          if (ImGui::Button("Cancel")) {
+            task->cancel();
+          }
+          ImGui::PopID();
+        }
+
         for (int iBackground = 0; iBackground < _sceneModel->getNumBackgrounds(); iBackground++) {
           if (backgoundFlags[iBackground] && iBackground != _sceneModel->getBackgroundIDtoDraw()) {
             _sceneModel->setBackgroundIDtoDraw(iBackground);
@@ -430,6 +492,72 @@ void ImGuiMainView::paintSideBar() {
       }  // Save button
     }
 
+    // ========================================================================================
+    // Recording section
+    // ========================================================================================
+    if (ImGui::CollapsingHeader("Recording", ImGuiTreeNodeFlags_DefaultOpen)) {
+      const bool isRecording = _sceneView->isRecording();
+      const auto format = static_cast<renderer::FrameRecorder::Format>(_recordingFormatID);
+
+      ImGui::BeginDisabled(isRecording);
+      {
+        ImGui::Combo("Format", &_recordingFormatID, RECORDING_FORMAT_ITEMS);
+        ImGui::InputInt("Record every N frames", &_recordingFrameStep);
+        _recordingFrameStep = std::max(_recordingFrameStep, 1);
+        if (format == renderer::FrameRecorder::Format::Y4M) {
+          ImGui::InputInt("Frame rate", &_recordingFrameRate);
+          _recordingFrameRate = std::max(_recordingFrameRate, 1);
+        }
+
+        ImGui::InputText("##Record to", &_recordingPathBuffer[0], CHAR_BUFFER_SIZE);
+
+        ImGui::SameLine();
+        if (ImGui::Button("Browse##Recording")) {
+          nfdchar_t* outPath;
+          nfdresult_t result;
+
+          if (format == renderer::FrameRecorder::Format::Y4M) {
+            nfdfilteritem_t filterItem[1] = {{"Video", "y4m"}};
+            result = NFD_SaveDialog(&outPath, filterItem, 1, NULL, "recording.y4m");
+          } else {
+            result = NFD_PickFolder(&outPath, NULL);
+          }
+
+          if (result == NFD_OKAY) {
+            strcpy(&_recordingPathBuffer[0], outPath);
+            NFD_FreePath(outPath);
+          }
+        }  // Browse button
+      }
+      ImGui::EndDisabled();
+
+      ImGui::SameLine();
+      if (!isRecording) {
+        if (ImGui::Button("Start")) {
+          renderer::FrameRecorder::Settings settings;
+          settings.outputPath = std::string(&_recordingPathBuffer[0]);
+          settings.format = format;
+          settings.frameStep = _recordingFrameStep;
+          settings.frameRate = _recordingFrameRate;
+
+          _sceneView->startRecording(settings);
+        }
+      } else {
+        if (ImGui::Button("Stop")) {
+          _sceneView->stopRecording();
+        }
+      }  // Start/Stop button
+
+      const auto frameRecorder = _sceneView->getFrameRecorder();
+      if (frameRecorder != nullptr) {
+        ImGui::Text("Frames: %d written, %d failed, %d in flight (up to %d)",
+                    (int)frameRecorder->getNumWrittenFrames(),
+                    (int)frameRecorder->getNumFailedFrames(),
+                    (int)frameRecorder->getNumFramesInFlight(),
+                    (int)renderer::FrameRecorder::MAX_FRAMES_IN_FLIGHT);
+      }
+    }
+
     // ========================================================================================
     // Resource monitor section
     // ========================================================================================
@@ -437,11 +565,59 @@ void ImGuiMainView::paintSideBar() {
 
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / _io->Framerate, _io->Framerate);
 
+    ImGui::Text("Objects: %d drawn, %d culled", (int)_sceneModel->getNumDrawnObjects(), (int)_sceneModel->getNumCulledObjects());
+    if (_sceneView->isEnabledShadowMapping) {
+      ImGui::Text("Shadow casters: %d drawn, %d culled", (int)_sceneModel->getNumDrawnShadowCasters(), (int)_sceneModel->getNumCulledShadowCasters());
+    }
+    if (_sceneModel->getDrawBatcher()->getIsEnabled()) {
+      const auto drawBatcher = _sceneModel->getDrawBatcher();
+      ImGui::Text("Batched draws: %d in %d multi-draw calls", (int)drawBatcher->getNumBatchedDraws(), (int)drawBatcher->getNumMultiDrawCalls());
+    }
+
+    {
+      const auto& residencyManager = _sceneModel->getResidencyManager();
+      ImGui::Text("Object buffers: %.1f MB resident, %.1f MB evicted (%d objects)",
+                  (float)residencyManager.getNumResidentBytes() / (1024.0f * 1024.0f),
+                  (float)residencyManager.getNumEvictedBytes() / (1024.0f * 1024.0f),
+                  (int)residencyManager.getNumEvictedObjects());
+    }
+
+    {
+      const auto renderer = _sceneView->getRenderer();
+      ImGui::Text("Render CPU time: %.3f ms", renderer->getPaintTimeMs());
+      ImGui::Text("GL state calls: %d issued, %d elided", (int)renderer->getNumIssuedStateCalls(), (int)renderer->getNumElidedStateCalls());
+    }
+
+    {
+      const auto& renderTargetPool = renderer::RenderTargetPool::getInstance();
+      ImGui::Text("Render targets: %d alive, %d allocated in total", (int)renderTargetPool.getNumLiveTargets(), (int)renderTargetPool.getNumAllocations());
+    }
+
+    {
+      // Frame time graph
+      const int iLatestFrame = (_frameTimeHistoryOffset + FRAME_TIME_HISTORY_SIZE - 1) % FRAME_TIME_HISTORY_SIZE;
+      char overlayText[64];
+      snprintf(overlayText, sizeof(overlayText), "%.3f ms", _frameTimeHistory[iLatestFrame]);
+      ImGui::PlotLines("Frame CPU time",
+                       _frameTimeHistory.data(),
+                       FRAME_TIME_HISTORY_SIZE,
+                       _frameTimeHistoryOffset,
+                       overlayText,
+                       0.0f,
+                       FLT_MAX,
+                       ImVec2(0.0f, 60.0f));
+    }
+
     {
       // FPS limit
       float fpsLimit = _fpsManager->getFPS();
       ImGui::DragFloat("FPS limit", &fpsLimit, 1.0f, 20.0f, 240.0f, FLOAT_FORMAT);
       _fpsManager->setFPS((double)fpsLimit);
+
+      // Paint only when something changed
+      bool isOnDemand = _fpsManager->getIsOnDemand();
+      ImGui::Checkbox("Render on demand", &isOnDemand);
+      _fpsManager->setIsOnDemand(isOnDemand);
     }
 
     ImGui::End();
@@ -478,12 +654,14 @@ void ImGuiMainView::paintSceneWindow() {
   _wheelOffset = _io->MouseWheel;
 
   // Attach render buffer data as texture image
+  // NOTE: The scene is rendered to the lower-left region of the texture
+  const glm::vec2 uvMax = _sceneView->getFrameBuffer()->getUVMax();
   ImGui::GetWindowDrawList()->AddImage(
       static_cast<ImTextureID>(_sceneView->getFrameBuffer()->getFrameTexture()),  // Texture ID
       _sceneAreaMin,                                                              // Min coords of area
       _sceneAreaMax,                                                              // Max coords of area
-      ImVec2(0, 1),                                                               // Min uv coords
-      ImVec2(1, 0)                                                                // Max uv coords
+      ImVec2(0, uvMax.y),                                                         // Min uv coords
+      ImVec2(uvMax.x, 0)                                                          // Max uv coords
   );
 
   ImGui::End();
@@ -526,12 +704,13 @@ void ImGuiMainView::paintDepthSceneWindow() {
       sceneAreaMax.y = sceneAreaOrigin.y + (sceneAreaSize.y + frameHeight) / 2.0f;
     }
 
+    const glm::vec2 uvMax = _depthSceneView->getFrameBuffer()->getUVMax();
     ImGui::GetWindowDrawList()->AddImage(
         static_cast<ImTextureID>(_depthSceneView->getFrameBuffer()->getFrameTexture()),  // Texture ID
         sceneAreaMin,                                                                    // Min coords of area
         sceneAreaMax,                                                                    // Max coords of area
-        ImVec2(0, 1),                                                                    // Min uv coords
-        ImVec2(1, 0)                                                                     // Max uv coords
+        ImVec2(0, uvMax.y),                                                              // Min uv coords
+        ImVec2(uvMax.x, 0)                                                               // Max uv coords
     );
 
     ImGui::End();
@@ -567,6 +746,8 @@ void ImGuiMainView::paintPopupWidgets() {
 }
 
 void ImGuiMainView::paint() {
+  const auto startTime = std::chrono::steady_clock::now();
+
   glClear(GL_COLOR_BUFFER_BIT);
 
   ImGui_ImplOpenGL3_NewFrame();
@@ -597,6 +778,11 @@ void ImGuiMainView::paint() {
 
   ImGui::Render();
 
+  // ====================================================================
+  // Upload objects loaded in background
+  // ====================================================================
+  _sceneModel->processLoadTasks(LOAD_TIME_BUDGET);
+
   // ====================================================================
   // Render OpenGL scene
   // ====================================================================
@@ -617,6 +803,20 @@ void ImGuiMainView::paint() {
     glfwMakeContextCurrent(backup_current_context);
   }
 
+  // NOTE: The GUI backend changes the GL state behind the cache
+  util::GLStateCache::getInstance().invalidate();
+
+  _frameTimeHistory[_frameTimeHistoryOffset] = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+  _frameTimeHistoryOffset = (_frameTimeHistoryOffset + 1) % FRAME_TIME_HISTORY_SIZE;
+
+  // NOTE: Frames needed without any events
+  _fpsManager->setIsAnimating(_sceneView->enabledModelRotationMode ||
+                              _sceneView->enabledLightRotationMode ||
+                              _sceneView->hasPendingScreenShots() ||
+                              _sceneView->isRecording() ||
+                              _sceneModel->hasPendingUploads() ||
+                              _sceneModel->needsFrame());
+
   glfwPollEvents();
 }
 
@@ -678,6 +878,14 @@ bool ImGuiMainView::shouldUpdate() const {
   return _fpsManager->update();
 }
 
+void ImGuiMainView::waitEvents() const {
+  _fpsManager->waitEvents();
+}
+
+void ImGuiMainView::requestFrame() const {
+  _fpsManager->requestFrame();
+}
+
 bool ImGuiMainView::toMoveOn() const {
   return _moveOn;
 }
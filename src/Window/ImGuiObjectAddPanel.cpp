@@ -10,8 +10,7 @@ ImGuiObjectAddPanel::ImGuiObjectAddPanel(ViewerModel_t model)
     : _model(model),
       _message(),
       _errorMessage(),
-      _readableExtensions(),
-      _streamExecutor(nullptr) {
+      _readableExtensions() {
   {
     // Update loadable primitive types
     _objectTypes = ""s;
@@ -24,6 +23,7 @@ ImGuiObjectAddPanel::ImGuiObjectAddPanel(ViewerModel_t model)
     _objectTypes += PointCloud::KEY_MODEL_POINT_CLOUD + "\0"s;
     _objectTypes += MaterialObject::KEY_MODEL_MATERIAL_OBJECT + "\0"s;
     _objectTypes += TextBox::KEY_MODEL_TEXT_BOX + "\0"s;
+    _objectTypes += OctreePointCloud::KEY_MODEL_OCTREE_POINT_CLOUD + "\0"s;
   }
 
   {
@@ -36,12 +36,6 @@ ImGuiObjectAddPanel::ImGuiObjectAddPanel(ViewerModel_t model)
       }
     }
   }
-
-  // ====================================================================
-  // Initialize stream executor
-  // ====================================================================
-  _streamExecutor = std::make_shared<util::StreamExecutor>();
-  LOG_INFO("Use " + std::to_string(_streamExecutor->getNumThreads()) + " threads");
 }
 
 ImGuiObjectAddPanel::~ImGuiObjectAddPanel() {}
@@ -71,11 +65,14 @@ void ImGuiObjectAddPanel::paint() {
   static int nDivs = 100;
   static float pointSize = 0.01f;
   static bool isDoubled = true;
+  static bool isImpostor = true;
+  static bool isClustered = false;
   static char text[CHAR_BUFFER_SIZE] = "Hello, world!";
   static int fontPixelSize = 64;
   static int fontPadding = 16;
   static float screenSpacePos[2] = {0.0f, 0.0f};
   static float textBoxMag = 1.0f;
+  static int pointBudget = (int)OctreePointCloud::DEFAULT_POINT_BUDGET;
 
   ImGui::Text("Step 1. Select the object type");
   ImGui::Combo("Object Type", &objectTypeID, _objectTypes.c_str());
@@ -132,6 +129,7 @@ void ImGuiObjectAddPanel::paint() {
     ImGui::InputFloat3("Offset (X, Y, Z)", offsetXYZ, FLOAT_FORMAT);
     ImGui::InputFloat("Scale", &scale, 0.0f, 0.0f, FLOAT_FORMAT);
     ImGui::Checkbox("Auto scale", &autoScale);
+    ImGui::Checkbox("Clustering", &isClustered);
   } else if (objectTypeID == 1) {
     // ====================================================================
     // Box
@@ -217,7 +215,10 @@ void ImGuiObjectAddPanel::paint() {
     ImGui::InputFloat3("Offset (X, Y, Z)", offsetXYZ, FLOAT_FORMAT);
     ImGui::InputFloat("Scale", &scale);
     ImGui::InputFloat("Point size", &pointSize, 0.0f, 0.0f, FLOAT_FORMAT);
-    ImGui::Checkbox("Doubled mesh", &isDoubled);
+    ImGui::Checkbox("Sphere impostors", &isImpostor);
+    if (!isImpostor) {
+      ImGui::Checkbox("Doubled mesh", &isDoubled);
+    }
     ImGui::Checkbox("Auto scale", &autoScale);
   } else if (objectTypeID == 6) {
     // ====================================================================
@@ -260,6 +261,7 @@ void ImGuiObjectAddPanel::paint() {
     ImGui::InputFloat3("Offset (X, Y, Z)", offsetXYZ, FLOAT_FORMAT);
     ImGui::InputFloat3("Scale (X, Y, Z)", scaleXYZ, FLOAT_FORMAT);
     ImGui::InputFloat("Scale", &scale);
+    ImGui::Checkbox("Clustering", &isClustered);
   } else if (objectTypeID == 8) {
     // ====================================================================
     // Text box
@@ -270,6 +272,28 @@ void ImGuiObjectAddPanel::paint() {
     ImGui::DragFloat("Size mag", &textBoxMag, 0.001f, 0.0f, 4.0f, FLOAT_FORMAT);
     ImGui::InputInt("Font pixel size", &fontPixelSize);
     ImGui::InputInt("Font padding", &fontPadding);
+  } else if (objectTypeID == 9) {
+    // ====================================================================
+    // Octree point cloud
+    // ====================================================================
+    ImGui::InputText("Obj name", objName, CHAR_BUFFER_SIZE);
+    ImGui::InputText("Point cloud file path", objFilePath, CHAR_BUFFER_SIZE);
+    ImGui::SameLine();
+    if (ImGui::Button("Browse object file")) {
+      nfdchar_t* outPath;
+      nfdfilteritem_t filterItem[1] = {{"Mesh", "las,ply,obj"}};
+      nfdresult_t result = NFD_OpenDialog(&outPath, filterItem, 1, FileUtil::cwd().c_str());
+
+      if (result == NFD_OKAY) {
+        strcpy(objFilePath, outPath);
+        NFD_FreePath(outPath);
+      }
+    }
+    ImGui::InputFloat3("Offset (X, Y, Z)", offsetXYZ, FLOAT_FORMAT);
+    ImGui::InputFloat("Scale", &scale);
+    ImGui::InputFloat("Point size", &pointSize, 0.0f, 0.0f, FLOAT_FORMAT);
+    ImGui::InputInt("Point budget", &pointBudget, 100000, 1000000);
+    ImGui::Checkbox("Auto scale", &autoScale);
   }
 
   // ========================================================================================================================
@@ -306,7 +330,9 @@ void ImGuiObjectAddPanel::paint() {
                                                offsetXYZ[1],
                                                offsetXYZ[2],
                                                scale,
-                                               autoScale);
+                                               autoScale,
+                                               true,
+                                               isClustered);
         if (!strTexFilePath.empty()) {
           object->loadTexture(strTexFilePath);
         }
@@ -370,7 +396,8 @@ void ImGuiObjectAddPanel::paint() {
                                                      scale,
                                                      pointSize,
                                                      isDoubled,
-                                                     autoScale);
+                                                     autoScale,
+                                                     isImpostor ? PointCloudPoly::RenderMode::IMPOSTOR : PointCloudPoly::RenderMode::MESH);
       } else if (objectTypeID == 6) {
         // ====================================================================
         // Point cloud
@@ -388,7 +415,9 @@ void ImGuiObjectAddPanel::paint() {
         // ====================================================================
         newObject = std::make_shared<MaterialObject>(strObjFilePath,
                                                      glm::vec3(offsetXYZ[0], offsetXYZ[1], offsetXYZ[2]),
-                                                     glm::vec3(scaleXYZ[0] * scale, scaleXYZ[1] * scale, scaleXYZ[2] * scale));
+                                                     glm::vec3(scaleXYZ[0] * scale, scaleXYZ[1] * scale, scaleXYZ[2] * scale),
+                                                     true,
+                                                     isClustered);
       } else if (objectTypeID == 8) {
         // ====================================================================
         // Text box
@@ -398,6 +427,18 @@ void ImGuiObjectAddPanel::paint() {
                                               textBoxMag,
                                               fontPixelSize,
                                               fontPadding);
+      } else if (objectTypeID == 9) {
+        // ====================================================================
+        // Octree point cloud
+        // ====================================================================
+        newObject = std::make_shared<OctreePointCloud>(strObjFilePath,
+                                                       offsetXYZ[0],
+                                                       offsetXYZ[1],
+                                                       offsetXYZ[2],
+                                                       scale,
+                                                       pointSize,
+                                                       autoScale,
+                                                       (size_t)std::max(1, pointBudget));
       }
 
       if (newObject != nullptr) {
@@ -405,12 +446,14 @@ void ImGuiObjectAddPanel::paint() {
 
         if (objectTypeID == 3) {
           _model->addBackground(std::move(std::static_pointer_cast<Background>(newObject)));
+          _message = "Success";
+        } else if (_model->addObjectAsync(newObject) != nullptr) {
+          _message = "Loading in background ...";
         } else {
-          _model->addObject(std::move(newObject));
+          _message = "Success";
         }
 
         _errorMessage.clear();
-        _message = "Success";
       }
 
     } catch (const std::exception& error) {
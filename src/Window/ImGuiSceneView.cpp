@@ -20,6 +20,8 @@ ImGuiSceneView::ImGuiSceneView(GLFWwindow* parentWindow, Model_t model)
                                          true);
   _renderer->initializeGL();
 
+  _screenCapture = std::make_shared<ScreenCapture>();
+
   resetCameraPose();
 }
 
@@ -52,6 +54,19 @@ void ImGuiSceneView::resetLightPose() {
 }
 
 void ImGuiSceneView::paintGL() {
+  // =======================================================================================
+  // Hold the scene while the recorder is full
+  // =======================================================================================
+  if (_frameRecorder != nullptr) {
+    _frameRecorder->update();
+  }
+
+  if (isRecording() && !_frameRecorder->isReady()) {
+    // NOTE: Neither advanced nor rendered, so that no step of the animations is missing from the recording
+    _screenCapture->update();
+    return;
+  }
+
   // =======================================================================================
   // Update model rotation animation
   // =======================================================================================
@@ -70,9 +85,26 @@ void ImGuiSceneView::paintGL() {
   // Draw scene
   // =======================================================================================
   _renderer->paintGL(isEnabledShadowMapping);
+
+  // =======================================================================================
+  // Record frame
+  // =======================================================================================
+  if (isRecording() && _renderer->getFrameBuffer() != nullptr) {
+    _frameRecorder->record(*_renderer->getFrameBuffer());
+  }
+
+  // =======================================================================================
+  // Complete screen shots
+  // =======================================================================================
+  _screenCapture->update();
 }
 
 void ImGuiSceneView::resizeGL(const int& width, const int& height) {
+  // NOTE: Called every frame by the GUI
+  if (width == WIN_WIDTH && height == WIN_HEIGHT) {
+    return;
+  }
+
   WIN_WIDTH = width;
   WIN_HEIGHT = height;
 
@@ -195,37 +227,48 @@ void ImGuiSceneView::wheelEvent(const bool& isMouseOnScene, const float& offset)
   }
 }
 
-void ImGuiSceneView::saveScreenShot(const std::string& filePath) {
+std::future<bool> ImGuiSceneView::saveScreenShot(const std::string& filePath) {
   const auto frameBuffer = _renderer->getFrameBuffer();
 
-  if (frameBuffer != nullptr) {
-    unsigned char* bytesTexture = (unsigned char*)malloc(sizeof(unsigned char) * WIN_WIDTH * WIN_HEIGHT * 4);
+  if (frameBuffer == nullptr) {
+    LOG_WARN("The scene was not rendered to the current frame buffer.");
 
-    glBindTexture(GL_TEXTURE_2D, frameBuffer->getFrameTexture());
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, bytesTexture);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    std::promise<bool> promise;
+    promise.set_value(false);
+    return promise.get_future();
+  }
 
-    // Transpose
-    unsigned char* bytesTransposedTexture = (unsigned char*)malloc(sizeof(unsigned char) * WIN_WIDTH * WIN_HEIGHT * 4);
-    for (int w = 0; w < WIN_WIDTH; ++w) {
-      for (int h = 0; h < WIN_HEIGHT; ++h) {
-        const int distIndex = 4 * (h * WIN_WIDTH + w);
-        const int srcIndex = 4 * ((WIN_HEIGHT - h - 1) * WIN_WIDTH + w);
+  return _screenCapture->capture(*frameBuffer, filePath);
+}
 
-        bytesTransposedTexture[distIndex + 0] = bytesTexture[srcIndex + 0];
-        bytesTransposedTexture[distIndex + 1] = bytesTexture[srcIndex + 1];
-        bytesTransposedTexture[distIndex + 2] = bytesTexture[srcIndex + 2];
-        bytesTransposedTexture[distIndex + 3] = bytesTexture[srcIndex + 3];
-      }
-    }
+bool ImGuiSceneView::hasPendingScreenShots() const {
+  return _screenCapture->hasPendingCaptures() || (_frameRecorder != nullptr && _frameRecorder->hasPendingFrames());
+}
 
-    stb::saveImage(WIN_WIDTH, WIN_HEIGHT, 4, bytesTransposedTexture, filePath);
+bool ImGuiSceneView::startRecording(const FrameRecorder::Settings& settings) {
+  const auto frameBuffer = _renderer->getFrameBuffer();
 
-    free(bytesTexture);
-    free(bytesTransposedTexture);
-  } else {
+  if (frameBuffer == nullptr) {
     LOG_WARN("The scene was not rendered to the current frame buffer.");
+    return false;
   }
+
+  // NOTE: Created on demand, since the encoder threads are not needed by most views
+  if (_frameRecorder == nullptr) {
+    _frameRecorder = std::make_shared<FrameRecorder>();
+  }
+
+  return _frameRecorder->start(settings, frameBuffer->getWidth(), frameBuffer->getHeight());
+}
+
+void ImGuiSceneView::stopRecording() {
+  if (_frameRecorder != nullptr) {
+    _frameRecorder->stop();
+  }
+}
+
+bool ImGuiSceneView::isRecording() const {
+  return _frameRecorder != nullptr && _frameRecorder->isRecording();
 }
 
 void ImGuiSceneView::setCameraPose(const glm::vec3& cameraPos,
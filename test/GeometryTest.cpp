@@ -0,0 +1,180 @@
+#include <SimView/Util/Geometry.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace simview;
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+/// @brief Triangle soup of a planar grid of 'nQuads' x 'nQuads' quads, i.e. 6 corners per quad
+static vecf_pt createPlanarGridSoup(const int nQuads, const float interval, veci_pt &indices) {
+  const int quadCorners[6][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 0}, {1, 1}, {0, 1}};
+
+  vecf_pt coords = std::make_shared<std::vector<float>>();
+  coords->reserve(18 * (size_t)nQuads * nQuads);
+
+  indices = std::make_shared<std::vector<int>>();
+  indices->reserve(6 * (size_t)nQuads * nQuads);
+
+  for (int y = 0; y < nQuads; ++y) {
+    for (int x = 0; x < nQuads; ++x) {
+      for (const auto &corner : quadCorners) {
+        indices->push_back((int)(coords->size() / 3));
+        coords->push_back((float)(x + corner[0]) * interval);
+        coords->push_back((float)(y + corner[1]) * interval);
+        coords->push_back(0.0f);
+      }
+    }
+  }
+
+  return coords;
+}
+
+/// @brief Corners of a large planar grid are welded into its nodes.
+///        The cells are as large as the threshold, so the time is linear in the number of corners.
+bool testWeldPlanarGrid() {
+  const int nQuads = 1000;
+  const float interval = 1e-2f;
+
+  veci_pt srcIndices;
+  const vecf_pt srcCoords = createPlanarGridSoup(nQuads, interval, srcIndices);
+
+  vecf_pt dstCoords = std::make_shared<std::vector<float>>();
+  veci_pt dstIndices = std::make_shared<std::vector<int>>();
+
+  const auto startTime = std::chrono::steady_clock::now();
+  Geometry::removeDuplecatedVertices(srcCoords, srcIndices, dstCoords, dstIndices, 1e-5f);
+  const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+  std::printf("Welded %zu corners in %.3f [s] (%.1f [M corners/s])\n", srcIndices->size(), elapsed, (double)srcIndices->size() / elapsed * 1e-6);
+
+  CHECK(dstCoords->size() / 3 == (size_t)(nQuads + 1) * (nQuads + 1));
+  CHECK(dstIndices->size() == srcIndices->size());
+
+  for (size_t index = 0; index < srcIndices->size(); ++index) {
+    const int iSrc = (*srcIndices)[index];
+    const int iDst = (*dstIndices)[index];
+    CHECK(iDst >= 0 && (size_t)iDst < dstCoords->size() / 3);
+
+    for (int iAxis = 0; iAxis < 3; ++iAxis) {
+      CHECK(std::abs((*srcCoords)[3 * iSrc + iAxis] - (*dstCoords)[3 * iDst + iAxis]) <= 1e-5f);
+    }
+  }
+
+  return true;
+}
+
+/// @brief A zero threshold welds exact duplicates only
+bool testWeldExactDuplicates() {
+  veci_pt srcIndices;
+  const vecf_pt srcCoords = createPlanarGridSoup(16, 1.0f, srcIndices);
+
+  // NOTE: Move one corner slightly, so that it stays apart
+  (*srcCoords)[0] += 1e-4f;
+
+  vecf_pt dstCoords = std::make_shared<std::vector<float>>();
+  veci_pt dstIndices = std::make_shared<std::vector<int>>();
+
+  Geometry::removeDuplecatedVertices(srcCoords, srcIndices, dstCoords, dstIndices, 0.0f);
+
+  CHECK(dstCoords->size() / 3 == 17 * 17 + 1);
+  CHECK(dstIndices->size() == srcIndices->size());
+  CHECK((*dstIndices)[0] == 0);
+  CHECK((*dstIndices)[3] != 0);
+
+  return true;
+}
+
+/// @brief Vertices at the same position are kept apart if their attributes differ
+bool testWeldKeepsAttributes() {
+  VertexArray_t srcVertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t srcIndices = std::make_shared<std::vector<uint32_t>>();
+
+  // NOTE: Two triangles at the same position. The first corners of both have different normals.
+  for (int iTriangle = 0; iTriangle < 2; ++iTriangle) {
+    for (int iCorner = 0; iCorner < 3; ++iCorner) {
+      Vertex vertex{};
+      vertex.position = glm::vec3((float)iCorner, (float)(iCorner % 2), 0.0f);
+      vertex.normal = glm::vec3(0.0f, (iCorner == 0) ? (float)iTriangle : 0.0f, 1.0f);
+      srcVertices->push_back(vertex);
+      srcIndices->push_back((uint32_t)srcIndices->size());
+    }
+  }
+
+  VertexArray_t dstVertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t dstIndices = std::make_shared<std::vector<uint32_t>>();
+
+  Geometry::removeDuplecatedVertices(srcVertices, srcIndices, dstVertices, dstIndices, 1e-5f);
+
+  CHECK(dstVertices->size() == 4);
+  CHECK(dstIndices->size() == 6);
+  CHECK((*dstIndices)[0] != (*dstIndices)[3]);
+  CHECK((*dstIndices)[1] == (*dstIndices)[4]);
+  CHECK((*dstIndices)[2] == (*dstIndices)[5]);
+
+  return true;
+}
+
+/// @brief Two tetrahedra sharing a face. The shared face appears twice and is dropped, and the others keep their order and orientation.
+bool testExtractSurfaceOfTwoTets() {
+  // NOTE: Faces of the tetrahedra (0, 1, 2, 3) and (1, 2, 3, 4), whose shared face is (1, 2, 3)
+  const std::vector<std::array<uint32_t, 3>> faces = {
+      {0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3},  // First tetrahedron
+      {3, 2, 1}, {1, 2, 4}, {2, 3, 4}, {3, 1, 4},  // Second tetrahedron
+  };
+
+  const vec_pt<uint32_t> triangles = std::make_shared<std::vector<uint32_t>>();
+  for (const auto &face : faces) {
+    triangles->insert(triangles->end(), face.begin(), face.end());
+  }
+
+  const vec_pt<uint32_t> surfaceTriangles = Geometry::extractSurfaceTriangle(triangles);
+
+  const std::vector<uint32_t> expected = {0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 4, 2, 3, 4, 3, 1, 4};
+  CHECK(*surfaceTriangles == expected);
+
+  // NOTE: Every edge of a closed surface is shared by two of its triangles
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (size_t offset = 0; offset < surfaceTriangles->size(); offset += 3) {
+    for (int iCorner = 0; iCorner < 3; ++iCorner) {
+      const uint32_t index0 = (*surfaceTriangles)[offset + iCorner];
+      const uint32_t index1 = (*surfaceTriangles)[offset + (iCorner + 1) % 3];
+      edges.emplace_back(std::min(index0, index1), std::max(index0, index1));
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  CHECK(edges.size() == 18);
+  for (size_t iEdge = 0; iEdge < edges.size(); iEdge += 2) {
+    CHECK(edges[iEdge] == edges[iEdge + 1]);
+    CHECK(iEdge + 2 >= edges.size() || edges[iEdge] != edges[iEdge + 2]);
+  }
+
+  // NOTE: Nothing to extract from nothing
+  CHECK(Geometry::extractSurfaceTriangle(std::make_shared<std::vector<uint32_t>>())->empty());
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testWeldPlanarGrid();
+  isPassed &= testWeldExactDuplicates();
+  isPassed &= testWeldKeepsAttributes();
+  isPassed &= testExtractSurfaceOfTwoTets();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+#include <SimView/Util/TaskScheduler.hpp>
+#include <SimView/Util/llas.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include "LasTestUtil.hpp"
+
+using namespace simview::util;
+
+/// @brief Decode the file and report the throughput
+/// @param decode Called like `decode(const llas::LasView&, callback)`
+template <class Decode>
+bool benchmark(const char* label, const llas::LasView& lasView, Decode&& decode) {
+  std::atomic<int64_t> checksum(0);
+
+  const auto startTime = std::chrono::steady_clock::now();
+
+  decode(lasView, [&checksum](const llas::PointDataRecord* records, const size_t, const size_t nRecords) {
+    int64_t chunkChecksum = 0;
+    for (size_t iRecord = 0; iRecord < nRecords; ++iRecord) {
+      chunkChecksum += records[iRecord].x;
+    }
+    checksum += chunkChecksum;
+  });
+
+  const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+  const int64_t nPoints = (int64_t)lasView.getNumPoints();
+  std::printf("%-24s: %8.3f [s] %10.2f [M points/s]\n", label, elapsed, (double)nPoints / elapsed * 1e-6);
+
+  // NOTE: 'x' of the point 'i' is 'i'
+  return checksum == nPoints * (nPoints - 1) / 2;
+}
+
+int main(int argc, char** argv) {
+  const size_t nPoints = argc > 1 ? (size_t)std::strtoull(argv[1], nullptr, 10) : 4 * 1024 * 1024;
+  const uint8_t format = argc > 2 ? (uint8_t)std::atoi(argv[2]) : 3;
+
+  const std::string filePath = (std::filesystem::temp_directory_path() / "SimView_LasBenchmark.las").string();
+
+  if (format > 10 || !lastest::writeLasFile(filePath, format, nPoints)) {
+    std::fprintf(stderr, "Failed to write the test file: %s\n", filePath.c_str());
+    return 1;
+  }
+
+  std::printf("%zu points of format %d (%d threads)\n", nPoints, (int)format, (int)TaskScheduler::getInstance().getNumThreads() + 1);
+
+  bool isPassed = true;
+  {
+    const llas::LasView_ptr lasView = llas::LasView::open(filePath);
+    isPassed &= lasView != nullptr;
+
+    if (lasView != nullptr) {
+      isPassed &= benchmark("Sequential", *lasView, [](const llas::LasView& view, const auto& callback) {
+        view.forEachPointChunk(LLAS_DEFAULT_CHUNK_SIZE, callback);
+      });
+
+      isPassed &= benchmark("Task scheduler", *lasView, [](const llas::LasView& view, const auto& callback) {
+        view.parallelForEachPointChunk(
+            LLAS_DEFAULT_CHUNK_SIZE,
+            callback,
+            [](const size_t nChunks, const auto& func) { parallelForRange(0, (int64_t)nChunks, func); });
+      });
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+
+  std::printf(isPassed ? "Decoded all points.\n" : "Failed to decode the points.\n");
+
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+#include <SimView/Util/TaskScheduler.hpp>
+#include <SimView/Util/llas.hpp>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "LasTestUtil.hpp"
+
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+static std::string getTestFilePath(const uint8_t format) {
+  return (std::filesystem::temp_directory_path() / ("SimView_LasTest_" + std::to_string((int)format) + ".las")).string();
+}
+
+/// @brief Compare a decoded record with 'lastest::getExpectedPoint'. Fields which the format does not have keep their defaults.
+static bool checkPoint(const uint8_t format, const size_t i, const llas::PointDataRecord &record) {
+  const bool isLegacyFormat = format <= 5;
+  const bool hasGPSTime = format == 1 || format >= 3;
+  const bool hasRGB = format == 2 || format == 3 || format == 5 || format == 7 || format == 8 || format == 10;
+  const bool hasNIR = format == 8 || format == 10;
+
+  const lastest::ExpectedPoint expected = lastest::getExpectedPoint(i);
+
+  CHECK(record.x == expected.x);
+  CHECK(record.y == expected.y);
+  CHECK(record.z == expected.z);
+  CHECK(record.intensity == expected.intensity);
+  CHECK(record.classification == expected.classification);
+  CHECK(record.pointSourceID == expected.pointSourceID);
+  CHECK(record.GPSTime == (hasGPSTime ? expected.GPSTime : 0.0));
+  CHECK(record.red == (hasRGB ? expected.red : 65535));
+  CHECK(record.green == (hasRGB ? expected.green : 65535));
+  CHECK(record.blue == (hasRGB ? expected.blue : 65535));
+  CHECK(record.scanAngle == (isLegacyFormat ? 0 : expected.scanAngle));
+  CHECK(record.NIR == (hasNIR ? expected.NIR : 0));
+
+  return true;
+}
+
+/// @brief Every point data record format is decoded in the same way by 'llas::read' and 'LasView'
+bool testDecodeEveryFormat() {
+  const size_t nPoints = 1000;
+
+  for (uint8_t format = 0; format <= 10; ++format) {
+    const std::string filePath = getTestFilePath(format);
+    CHECK(lastest::writeLasFile(filePath, format, nPoints));
+
+    const llas::LasData_ptr lasData = llas::read(filePath);
+    CHECK(lasData != nullptr);
+    CHECK(lasData->getNumPoints() == nPoints);
+    CHECK(lasData->header.pointDataRecordFormat == format);
+    CHECK(lasData->header.xScaleFactor == lastest::SCALE_FACTOR);
+    CHECK(lasData->header.zOffset == lastest::OFFSETS[2]);
+
+    for (size_t i = 0; i < nPoints; ++i) {
+      CHECK(checkPoint(format, i, lasData->pointDataRecords[i]));
+    }
+
+    {
+      const llas::LasView_ptr lasView = llas::LasView::open(filePath);
+      CHECK(lasView != nullptr);
+      CHECK(lasView->getNumPoints() == nPoints);
+
+      for (const size_t i : {(size_t)0, nPoints / 2, nPoints - 1}) {
+        CHECK(checkPoint(format, i, lasView->getPointDataRecord(i)));
+      }
+    }
+
+    std::error_code error;
+    std::filesystem::remove(filePath, error);
+  }
+
+  return true;
+}
+
+/// @brief Chunks decoded on the task scheduler cover every point exactly once, whatever the chunk size
+bool testDecodeChunksInParallel() {
+  const uint8_t format = 3;
+  const size_t nPoints = 10007;
+
+  const std::string filePath = getTestFilePath(format);
+  CHECK(lastest::writeLasFile(filePath, format, nPoints));
+
+  bool isPassed = true;
+  {
+    const llas::LasView_ptr lasView = llas::LasView::open(filePath);
+    CHECK(lasView != nullptr);
+
+    for (const size_t chunkSize : {(size_t)1, (size_t)64, (size_t)1000, nPoints, 2 * nPoints}) {
+      std::vector<std::atomic<int>> nVisits(nPoints);
+      std::atomic<bool> isMatched(true);
+
+      lasView->parallelForEachPointChunk(
+          chunkSize,
+          [&](const llas::PointDataRecord *records, const size_t iFirstRecord, const size_t nRecords) {
+            for (size_t iRecord = 0; iRecord < nRecords; ++iRecord) {
+              ++nVisits[iFirstRecord + iRecord];
+              if (!checkPoint(format, iFirstRecord + iRecord, records[iRecord])) {
+                isMatched = false;
+              }
+            }
+          },
+          [](const size_t nChunks, const auto &func) { parallelForRange(0, (int64_t)nChunks, func); });
+
+      isPassed &= isMatched;
+      for (const auto &nVisit : nVisits) {
+        isPassed &= nVisit == 1;
+      }
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+
+  CHECK(isPassed);
+
+  return true;
+}
+
+/// @brief A file which is shorter than its declared point records is rejected
+bool testRejectTruncatedFile() {
+  const uint8_t format = 1;
+  const size_t nPoints = 100;
+
+  const std::string filePath = getTestFilePath(format);
+  CHECK(lastest::writeLasFile(filePath, format, nPoints));
+
+  std::filesystem::resize_file(filePath, std::filesystem::file_size(filePath) - 1);
+
+  const bool isRejected = llas::LasView::open(filePath) == nullptr && llas::read(filePath) == nullptr;
+
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+
+  CHECK(isRejected);
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testDecodeEveryFormat();
+  isPassed &= testDecodeChunksInParallel();
+  isPassed &= testRejectTruncatedFile();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace lastest {
+
+// NOTE: Lengths of the point data records of format 0 to 10, including wave packets
+inline const uint16_t RECORD_LENGTHS[11] = {20, 28, 26, 34, 57, 63, 30, 36, 38, 59, 67};
+
+inline const double SCALE_FACTOR = 0.01;
+inline const double OFFSETS[3] = {100.0, 200.0, 300.0};
+
+/// @brief Expected fields of the point `i`
+struct ExpectedPoint {
+  int32_t x;
+  int32_t y;
+  int32_t z;
+  uint16_t intensity;
+  uint8_t classification;
+  uint16_t pointSourceID;
+  double GPSTime;
+  uint16_t red;
+  uint16_t green;
+  uint16_t blue;
+  int16_t scanAngle;
+  uint16_t NIR;
+};
+
+inline ExpectedPoint getExpectedPoint(const size_t i) {
+  ExpectedPoint point;
+  point.x = (int32_t)i;
+  point.y = 2 * (int32_t)i;
+  point.z = -(int32_t)i;
+  point.intensity = (uint16_t)(i % 65536);
+  point.classification = (uint8_t)(i % 32);
+  point.pointSourceID = 7;
+  point.GPSTime = 0.5 * (double)i;
+  point.red = (uint16_t)(i % 65536);
+  point.green = (uint16_t)((3 * i) % 65536);
+  point.blue = 65535;
+  point.scanAngle = -(int16_t)(i % 90);
+  point.NIR = (uint16_t)(1000 + i % 1000);
+  return point;
+}
+
+/// @brief Write a little-endian value
+/// @return `offset` (`size_t`): the offset after the value
+template <class T>
+inline size_t put(std::vector<char>& bytes, const size_t offset, const T& value) {
+  std::memcpy(bytes.data() + offset, &value, sizeof(T));
+  return offset + sizeof(T);
+}
+
+/// @brief Write a '.las' file of the given point data record format. The fields of the points are given by `getExpectedPoint`.
+///        Version 1.2 is written for formats 0 to 5, and version 1.4 for formats 6 to 10.
+/// @return `isSucceeded` (`bool`)
+inline bool writeLasFile(const std::string& filePath, const uint8_t format, const size_t nPoints) {
+  const bool isLegacyFormat = format <= 5;
+  const bool hasGPSTime = format == 1 || format >= 3;
+  const bool hasRGB = format == 2 || format == 3 || format == 5 || format == 7 || format == 8 || format == 10;
+  const bool hasNIR = format == 8 || format == 10;
+
+  const uint16_t headerSize = isLegacyFormat ? 227 : 375;
+  const uint16_t recordLength = RECORD_LENGTHS[format];
+
+  std::vector<char> header(headerSize, 0);
+  std::memcpy(header.data(), "LASF", 4);
+  put<uint8_t>(header, 24, 1);
+  put<uint8_t>(header, 25, isLegacyFormat ? 2 : 4);
+  put<uint16_t>(header, 94, headerSize);
+  put<uint32_t>(header, 96, headerSize);
+  put<uint32_t>(header, 100, 0);
+  put<uint8_t>(header, 104, format);
+  put<uint16_t>(header, 105, recordLength);
+  put<uint32_t>(header, 107, isLegacyFormat ? (uint32_t)nPoints : 0);
+  for (int iAxis = 0; iAxis < 3; ++iAxis) {
+    put<double>(header, 131 + 8 * iAxis, SCALE_FACTOR);
+    put<double>(header, 155 + 8 * iAxis, OFFSETS[iAxis]);
+  }
+  if (!isLegacyFormat) {
+    put<uint64_t>(header, 247, (uint64_t)nPoints);
+  }
+
+  std::ofstream file(filePath, std::ios::binary);
+  file.write(header.data(), headerSize);
+
+  std::vector<char> record(recordLength);
+
+  for (size_t i = 0; i < nPoints; ++i) {
+    const ExpectedPoint point = getExpectedPoint(i);
+    std::fill(record.begin(), record.end(), 0);
+
+    size_t offset = 0;
+    offset = put(record, offset, point.x);
+    offset = put(record, offset, point.y);
+    offset = put(record, offset, point.z);
+    offset = put(record, offset, point.intensity);
+
+    if (isLegacyFormat) {
+      offset += 1;  // Sensor data
+      offset = put(record, offset, point.classification);
+      offset += 2;  // Scan angle rank and user data
+    } else {
+      offset += 2;  // Extended sensor data
+      offset = put(record, offset, point.classification);
+      offset += 1;  // User data
+      offset = put(record, offset, point.scanAngle);
+    }
+
+    offset = put(record, offset, point.pointSourceID);
+
+    if (hasGPSTime) {
+      offset = put(record, offset, point.GPSTime);
+    }
+
+    if (hasRGB) {
+      offset = put(record, offset, point.red);
+      offset = put(record, offset, point.green);
+      offset = put(record, offset, point.blue);
+    }
+
+    if (hasNIR) {
+      offset = put(record, offset, point.NIR);
+    }
+
+    file.write(record.data(), recordLength);
+  }
+
+  return (bool)file;
+}
+
+}  // namespace lastest
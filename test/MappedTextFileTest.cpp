@@ -0,0 +1,214 @@
+#include <SimView/Util/MappedTextFile.hpp>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+static std::string writeTestFile(const std::string &content) {
+  const std::string filePath = (std::filesystem::temp_directory_path() / "SimView_MappedTextFileTest.txt").string();
+
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), content.size());
+
+  return filePath;
+}
+
+static void removeTestFile(const std::string &filePath) {
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+}
+
+/// @brief Content of the line `i` of the large test files, like a node line of '.msh' files
+static std::string createLine(const size_t i) {
+  return std::to_string(i) + " " + std::to_string(0.5 * (double)i) + "\t-" + std::to_string(i % 7);
+}
+
+/// @brief Lines end at '\n' with or without '\r', and a trailing line without a line break is counted
+bool testGetLineWithLineBreaks() {
+  for (const std::string lineBreak : {"\n", "\r\n"}) {
+    const std::string filePath = writeTestFile("first" + lineBreak + lineBreak + "  third " + lineBreak + "last");
+
+    bool isPassed = true;
+    {
+      const MappedTextFile_t file = MappedTextFile::open(filePath);
+      CHECK(file != nullptr);
+      CHECK(file->getNumLines() == 4);
+
+      const char *begin = nullptr;
+      const char *end = nullptr;
+
+      // NOTE: '\r' stays at the end of a line, and the token parsers skip it
+      const std::string trailing = lineBreak.size() == 2 ? "\r" : "";
+
+      isPassed &= file->getLine(0, begin, end) && std::string(begin, end) == "first" + trailing;
+      isPassed &= file->getLine(1, begin, end) && std::string(begin, end) == trailing;
+      isPassed &= file->getLine(2, begin, end) && std::string(begin, end) == "  third " + trailing;
+      isPassed &= file->getLine(3, begin, end) && std::string(begin, end) == "last";
+      isPassed &= !file->getLine(4, begin, end);
+
+      isPassed &= file->getLine(1, begin, end) && MappedTextFile::countTokens(begin, end) == 0;
+      isPassed &= file->getLine(2, begin, end) && MappedTextFile::countTokens(begin, end) == 1;
+    }
+
+    removeTestFile(filePath);
+
+    CHECK(isPassed);
+  }
+
+  return true;
+}
+
+/// @brief A line break at the end of the file does not start another line
+bool testTrailingLineBreak() {
+  const std::string filePath = writeTestFile("1 2 3\r\n4 5 6\r\n");
+
+  size_t nLines = 0;
+  {
+    const MappedTextFile_t file = MappedTextFile::open(filePath);
+    CHECK(file != nullptr);
+    nLines = file->getNumLines();
+  }
+
+  removeTestFile(filePath);
+
+  CHECK(nLines == 2);
+
+  return true;
+}
+
+/// @brief Lines over several chunks are visited exactly once, including those across the chunk boundaries
+bool testForEachLineOverChunks() {
+  for (const std::string lineBreak : {"\n", "\r\n"}) {
+    const size_t nLines = 300000;
+
+    std::string content;
+    for (size_t i = 0; i < nLines; ++i) {
+      content += createLine(i) + lineBreak;
+    }
+
+    const std::string filePath = writeTestFile(content);
+
+    bool isPassed = true;
+    {
+      // NOTE: Counted later, like the files with a binary payload
+      const MappedTextFile_t file = MappedTextFile::open(filePath, false);
+      CHECK(file != nullptr);
+      CHECK(file->getFileSize() > 3 * 1024 * 1024);
+      CHECK(file->getNumLines() == 0);
+
+      file->countLines();
+      CHECK(file->getNumLines() == nLines);
+
+      // NOTE: Skip a header, like the readers do
+      const size_t firstLine = 10;
+      std::vector<std::atomic<int>> nVisits(nLines - firstLine);
+
+      isPassed &= file->forEachLine(firstLine, nLines - firstLine, [&](const size_t iLocalLine, const char *begin, const char *end) {
+        ++nVisits[iLocalLine];
+
+        const char *cursor = begin;
+        int64_t index = 0;
+        double value = 0.0;
+        int negative = 0;
+
+        if (!MappedTextFile::parseInteger(cursor, end, index) ||
+            !MappedTextFile::parseFloat(cursor, end, value) ||
+            !MappedTextFile::parseInteger(cursor, end, negative)) {
+          return false;
+        }
+
+        const size_t iLine = firstLine + iLocalLine;
+        return (size_t)index == iLine && value == 0.5 * (double)iLine && negative == -(int)(iLine % 7) &&
+               MappedTextFile::skipSpaces(cursor, end) == end;
+      });
+
+      for (const auto &nVisit : nVisits) {
+        isPassed &= nVisit == 1;
+      }
+
+      // NOTE: Fails past the end of the file
+      isPassed &= !file->forEachLine(nLines - 1, 2, [](const size_t, const char *, const char *) { return true; });
+    }
+
+    removeTestFile(filePath);
+
+    CHECK(isPassed);
+  }
+
+  return true;
+}
+
+/// @brief A failure of the visitor on any line fails the whole visit
+bool testForEachLineReportsFailure() {
+  const std::string filePath = writeTestFile("1\n2\nx\n4\n");
+
+  bool isFailed = false;
+  {
+    const MappedTextFile_t file = MappedTextFile::open(filePath);
+    CHECK(file != nullptr);
+
+    isFailed = !file->forEachLine(0, file->getNumLines(), [](const size_t, const char *begin, const char *end) {
+      int value = 0;
+      return MappedTextFile::parseInteger(begin, end, value);
+    });
+  }
+
+  removeTestFile(filePath);
+
+  CHECK(isFailed);
+
+  return true;
+}
+
+/// @brief The token parsers skip spaces, tabs and '\r', accept a leading '+', and reject garbage
+bool testParseTokens() {
+  const std::string text = " +12\t-3.5e2 0.1234567890123456789 1e-3\r x";
+  const char *cursor = text.data();
+  const char *end = text.data() + text.size();
+
+  int integerValue = 0;
+  CHECK(MappedTextFile::parseInteger(cursor, end, integerValue));
+  CHECK(integerValue == 12);
+
+  float floatValue = 0.0f;
+  CHECK(MappedTextFile::parseFloat(cursor, end, floatValue));
+  CHECK(floatValue == -350.0f);
+
+  // NOTE: Doubles keep the digits lost in floats
+  double doubleValue = 0.0;
+  CHECK(MappedTextFile::parseFloat(cursor, end, doubleValue));
+  CHECK(doubleValue == 0.1234567890123456789);
+  CHECK(doubleValue != (double)0.1234567890123456789f);
+
+  CHECK(MappedTextFile::parseFloat(cursor, end, floatValue));
+  CHECK(floatValue == std::stof("1e-3"));
+
+  CHECK(!MappedTextFile::parseFloat(cursor, end, floatValue));
+  CHECK(MappedTextFile::countTokens(text.data(), end) == 5);
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testGetLineWithLineBreaks();
+  isPassed &= testTrailingLineBreak();
+  isPassed &= testForEachLineOverChunks();
+  isPassed &= testForEachLineReportsFailure();
+  isPassed &= testParseTokens();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+#include <SimView/Util/ObjectLoader.hpp>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simview;
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+// NOTE: Corners of the unit cube, bottom face first, in the node order of hexahedra of '.msh' files
+static const float CUBE_COORDS[8][3] = {
+    {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 1.0f, 1.0f},
+};
+
+static std::string writeTestFile(const std::string &extension, const std::vector<std::string> &lines, const std::string &lineBreak) {
+  const std::string filePath = (std::filesystem::temp_directory_path() / ("SimView_ObjectLoaderTest" + extension)).string();
+
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  for (const auto &line : lines) {
+    file << line << lineBreak;
+  }
+
+  return filePath;
+}
+
+static void removeTestFile(const std::string &filePath) {
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+}
+
+static std::string toLine(const float coords[3]) {
+  return std::to_string(coords[0]) + " " + std::to_string(coords[1]) + " " + std::to_string(coords[2]);
+}
+
+// NOTE: Outward triangles of 'CUBE_COORDS', two per face, in the same order as hexahedra of '.msh' files are split
+static const uint32_t CUBE_TRIANGLES[12][3] = {
+    {0, 1, 5}, {5, 4, 0}, {1, 2, 6}, {6, 5, 1}, {2, 3, 7}, {7, 6, 2},
+    {3, 0, 4}, {4, 7, 3}, {4, 5, 6}, {6, 7, 4}, {1, 0, 3}, {3, 2, 1},
+};
+
+/// @brief Every corner of every triangle has the unit normal of its face, i.e. no normal is smoothed over a crease
+static bool checkFlatNormals(const VertexArray_t &vertices, const IndexArray_t &indices) {
+  CHECK(indices->size() % 3 == 0);
+
+  for (size_t offset = 0; offset < indices->size(); offset += 3) {
+    const Vertex &vertex0 = (*vertices)[(*indices)[offset + 0]];
+    const Vertex &vertex1 = (*vertices)[(*indices)[offset + 1]];
+    const Vertex &vertex2 = (*vertices)[(*indices)[offset + 2]];
+
+    const glm::vec3 faceNormal = glm::normalize(glm::cross(vertex1.position - vertex0.position, vertex2.position - vertex0.position));
+
+    for (const Vertex *vertex : {&vertex0, &vertex1, &vertex2}) {
+      CHECK(glm::dot(vertex->normal, faceNormal) > 0.999f);
+    }
+  }
+
+  return true;
+}
+
+/// @brief A cube read in the indexed mode has one vertex per face corner, since all its edges are creases.
+///        The lines end with CRLF.
+bool testPchCubeSplitsCreases() {
+  std::vector<std::string> lines = {"8"};
+  for (const auto &coords : CUBE_COORDS) {
+    lines.push_back(toLine(coords));
+  }
+  lines.push_back("12");
+  for (const auto &triangle : CUBE_TRIANGLES) {
+    lines.push_back(std::to_string(triangle[0]) + " " + std::to_string(triangle[1]) + " " + std::to_string(triangle[2]));
+  }
+
+  const std::string filePath = writeTestFile(".pch", lines, "\r\n");
+
+  VertexArray_t indexedVertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indexedIndices = std::make_shared<std::vector<uint32_t>>();
+  ObjectLoader::readPchFile(filePath, indexedVertices, indexedIndices, 0.0f, 0.0f, 0.0f, true);
+
+  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+  ObjectLoader::readPchFile(filePath, vertices, indices, 0.0f, 0.0f, 0.0f, false);
+
+  removeTestFile(filePath);
+
+  CHECK(indexedVertices->size() == 24);
+  CHECK(indexedIndices->size() == 36);
+  CHECK(checkFlatNormals(indexedVertices, indexedIndices));
+
+  CHECK(vertices->size() == 36);
+  CHECK(indices->size() == 36);
+  CHECK(checkFlatNormals(vertices, indices));
+
+  return true;
+}
+
+/// @brief Nodes of a gently curved sheet are shared in the indexed mode, since it has no crease
+bool testPchSmoothSheetSharesVertices() {
+  const int nQuads = 4;
+  const int nNodesPerSide = nQuads + 1;
+
+  std::vector<std::string> lines = {std::to_string(nNodesPerSide * nNodesPerSide)};
+  for (int y = 0; y < nNodesPerSide; ++y) {
+    for (int x = 0; x < nNodesPerSide; ++x) {
+      const float coords[3] = {(float)x, (float)y, 0.1f * (float)(x * x)};
+      lines.push_back(toLine(coords));
+    }
+  }
+
+  lines.push_back(std::to_string(2 * nQuads * nQuads));
+  for (int y = 0; y < nQuads; ++y) {
+    for (int x = 0; x < nQuads; ++x) {
+      const int iNode = y * nNodesPerSide + x;
+      lines.push_back(std::to_string(iNode) + " " + std::to_string(iNode + 1) + " " + std::to_string(iNode + nNodesPerSide + 1));
+      lines.push_back(std::to_string(iNode) + " " + std::to_string(iNode + nNodesPerSide + 1) + " " + std::to_string(iNode + nNodesPerSide));
+    }
+  }
+
+  const std::string filePath = writeTestFile(".pch", lines, "\n");
+
+  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+  ObjectLoader::readPchFile(filePath, vertices, indices, 0.0f, 0.0f, 0.0f, true);
+
+  removeTestFile(filePath);
+
+  CHECK(vertices->size() == (size_t)(nNodesPerSide * nNodesPerSide));
+  CHECK(indices->size() == (size_t)(6 * nQuads * nQuads));
+
+  for (const Vertex &vertex : *vertices) {
+    CHECK(std::abs(glm::length(vertex.normal) - 1.0f) < 1e-4f);
+    CHECK(vertex.normal.z > 0.0f);
+  }
+
+  return true;
+}
+
+/// @brief The surface of a hexahedron in a '.msh' file is its 12 triangles, split at the creases in the indexed mode.
+///        Both LF and CRLF line breaks are read.
+bool testMshHexahedron() {
+  for (const std::string lineBreak : {"\n", "\r\n"}) {
+    const std::vector<std::string> lines = {
+        "1",
+        "0 1 2 3 4 5 6 7",
+        "8",
+        toLine(CUBE_COORDS[0]),
+        toLine(CUBE_COORDS[1]),
+        toLine(CUBE_COORDS[2]),
+        toLine(CUBE_COORDS[3]),
+        toLine(CUBE_COORDS[4]),
+        toLine(CUBE_COORDS[5]),
+        toLine(CUBE_COORDS[6]),
+        toLine(CUBE_COORDS[7]),
+    };
+
+    const std::string filePath = writeTestFile(".msh", lines, lineBreak);
+
+    VertexArray_t indexedVertices = std::make_shared<std::vector<Vertex>>();
+    IndexArray_t indexedIndices = std::make_shared<std::vector<uint32_t>>();
+    ObjectLoader::readMshFile(filePath, indexedVertices, indexedIndices, 0.0f, 0.0f, 0.0f, true);
+
+    VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+    IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+    ObjectLoader::readMshFile(filePath, vertices, indices, 0.0f, 0.0f, 0.0f, false);
+
+    removeTestFile(filePath);
+
+    CHECK(indexedVertices->size() == 24);
+    CHECK(indexedIndices->size() == 36);
+    CHECK(checkFlatNormals(indexedVertices, indexedIndices));
+
+    CHECK(vertices->size() == 36);
+    CHECK(checkFlatNormals(vertices, indices));
+  }
+
+  return true;
+}
+
+/// @brief The face shared by two tetrahedra in a '.msh' file is not on the surface
+bool testMshTwoTets() {
+  const std::vector<std::string> lines = {
+      "2",
+      "0 1 2 3",
+      "1 2 3 4",
+      "5",
+      "0 0 0",
+      "1 0 0",
+      "0 1 0",
+      "0 0 1",
+      "1 1 1",
+  };
+
+  const std::string filePath = writeTestFile(".msh", lines, "\r\n");
+
+  VertexArray_t vertices = std::make_shared<std::vector<Vertex>>();
+  IndexArray_t indices = std::make_shared<std::vector<uint32_t>>();
+  ObjectLoader::readMshFile(filePath, vertices, indices, 0.0f, 0.0f, 0.0f, false);
+
+  removeTestFile(filePath);
+
+  CHECK(vertices->size() == 18);
+  CHECK(indices->size() == 18);
+
+  // NOTE: No surface triangle lies on the plane of the shared face, x + y + z = 1
+  for (size_t offset = 0; offset < indices->size(); offset += 3) {
+    int nOnSharedFace = 0;
+    for (int iCorner = 0; iCorner < 3; ++iCorner) {
+      const glm::vec3 &position = (*vertices)[(*indices)[offset + iCorner]].position;
+      nOnSharedFace += std::abs(position.x + position.y + position.z - 1.0f) < 1e-6f ? 1 : 0;
+    }
+    CHECK(nOnSharedFace < 3);
+  }
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testPchCubeSplitsCreases();
+  isPassed &= testPchSmoothSheetSharesVertices();
+  isPassed &= testMshHexahedron();
+  isPassed &= testMshTwoTets();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}
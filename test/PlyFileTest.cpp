@@ -0,0 +1,212 @@
+#include <SimView/Util/PlyFile.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+// NOTE: A triangle, a quad and a pentagon over 6 vertices
+static const std::vector<std::vector<int>> POLYGONS = {{0, 1, 2}, {0, 2, 3, 4}, {0, 1, 2, 3, 5}};
+static const size_t NUM_VERTICES = 6;
+
+// NOTE: Triangle fans of 'POLYGONS'
+static const std::vector<uint32_t> EXPECTED_TRIANGLES = {0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 1, 2, 0, 2, 3, 0, 3, 5};
+
+static float getX(const size_t i) { return (float)i; }
+static float getY(const size_t i) { return 2.0f * (float)i + 0.5f; }
+static double getZ(const size_t i) { return -0.25 * (double)i; }
+static uint8_t getRed(const size_t i) { return (uint8_t)(40 * i); }
+static float getQuality(const size_t i) { return 10.0f + (float)i; }
+
+static std::string createHeader(const std::string &format, const std::string &lineBreak) {
+  std::string header;
+  header += "ply" + lineBreak;
+  header += "format " + format + " 1.0" + lineBreak;
+  header += "comment Written by PlyFileTest" + lineBreak;
+  header += "element vertex " + std::to_string(NUM_VERTICES) + lineBreak;
+  header += "property float x" + lineBreak;
+  header += "property float y" + lineBreak;
+  header += "property double z" + lineBreak;
+  header += "property uchar red" + lineBreak;
+  header += "property uchar green" + lineBreak;
+  header += "property uchar blue" + lineBreak;
+  header += "property float quality" + lineBreak;
+  header += "element face " + std::to_string(POLYGONS.size()) + lineBreak;
+  header += "property uchar flags" + lineBreak;
+  header += "property list uchar int vertex_indices" + lineBreak;
+  header += "end_header" + lineBreak;
+  return header;
+}
+
+static std::string writeTestFile(const std::string &content) {
+  const std::string filePath = (std::filesystem::temp_directory_path() / "SimView_PlyFileTest.ply").string();
+
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), content.size());
+
+  return filePath;
+}
+
+static std::string createAsciiFile(const std::string &lineBreak) {
+  std::string content = createHeader("ascii", lineBreak);
+
+  char line[256];
+  for (size_t i = 0; i < NUM_VERTICES; ++i) {
+    std::snprintf(line, sizeof(line), "%g %g %.17g %d 255 0 %g", getX(i), getY(i), getZ(i), (int)getRed(i), getQuality(i));
+    content += line + lineBreak;
+  }
+
+  for (const auto &polygon : POLYGONS) {
+    content += "1 " + std::to_string(polygon.size());
+    for (const int index : polygon) {
+      content += " " + std::to_string(index);
+    }
+    content += lineBreak;
+  }
+
+  return content;
+}
+
+/// @brief Append a value in the byte order of the file
+template <class T>
+static void put(std::string &content, const T value, const bool isBigEndian) {
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+
+  if (isBigEndian) {
+    std::reverse(bytes, bytes + sizeof(T));
+  }
+
+  content.append(bytes, sizeof(T));
+}
+
+static std::string createBinaryFile(const bool isBigEndian) {
+  std::string content = createHeader(isBigEndian ? "binary_big_endian" : "binary_little_endian", "\n");
+
+  for (size_t i = 0; i < NUM_VERTICES; ++i) {
+    put(content, getX(i), isBigEndian);
+    put(content, getY(i), isBigEndian);
+    put(content, getZ(i), isBigEndian);
+    put(content, getRed(i), isBigEndian);
+    put(content, (uint8_t)255, isBigEndian);
+    put(content, (uint8_t)0, isBigEndian);
+    put(content, getQuality(i), isBigEndian);
+  }
+
+  for (const auto &polygon : POLYGONS) {
+    put(content, (uint8_t)1, isBigEndian);
+    put(content, (uint8_t)polygon.size(), isBigEndian);
+    for (const int index : polygon) {
+      put(content, (int32_t)index, isBigEndian);
+    }
+  }
+
+  return content;
+}
+
+/// @brief Read the file and compare it with the values written
+static bool checkFile(const std::string &content, const PlyFile::Format format) {
+  const std::string filePath = writeTestFile(content);
+
+  bool isPassed = true;
+  {
+    const PlyFile_t file = PlyFile::open(filePath);
+    CHECK(file != nullptr);
+    CHECK(file->getFormat() == format);
+    CHECK(file->getNumVertices() == NUM_VERTICES);
+    CHECK(file->getNumFaces() == POLYGONS.size());
+
+    std::vector<Vertex> vertices;
+    bool hasNormals = true;
+    isPassed &= file->readVertices(vertices, hasNormals);
+    isPassed &= !hasNormals;
+    isPassed &= vertices.size() == NUM_VERTICES;
+
+    for (size_t i = 0; isPassed && i < NUM_VERTICES; ++i) {
+      isPassed &= vertices[i].position.x == getX(i);
+      isPassed &= vertices[i].position.y == getY(i);
+      isPassed &= vertices[i].position.z == (float)getZ(i);
+      isPassed &= vertices[i].color.r == (float)getRed(i) / 255.0f;
+      isPassed &= vertices[i].color.g == 1.0f;
+      isPassed &= vertices[i].color.b == 0.0f;
+      isPassed &= vertices[i].id == getQuality(i);
+    }
+
+    // NOTE: A part of the element, like the streaming readers
+    std::vector<Vertex> someVertices;
+    isPassed &= file->readVertices(2, 3, someVertices, hasNormals);
+    isPassed &= someVertices.size() == 3 && someVertices[0].position.x == getX(2) && someVertices[2].id == getQuality(4);
+    isPassed &= !file->readVertices(4, 3, someVertices, hasNormals);
+
+    std::vector<uint32_t> triangles;
+    isPassed &= file->readTriangles(triangles);
+    isPassed &= triangles == EXPECTED_TRIANGLES;
+  }
+
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+
+  CHECK(isPassed);
+
+  return true;
+}
+
+/// @brief ASCII files with LF or CRLF line breaks, polygons are split into triangle fans
+bool testReadAscii() {
+  CHECK(checkFile(createAsciiFile("\n"), PlyFile::Format::ASCII));
+  CHECK(checkFile(createAsciiFile("\r\n"), PlyFile::Format::ASCII));
+  return true;
+}
+
+/// @brief Binary files in both byte orders give the same vertices and triangles as the ASCII ones
+bool testReadBinary() {
+  CHECK(checkFile(createBinaryFile(false), PlyFile::Format::BINARY_LITTLE_ENDIAN));
+  CHECK(checkFile(createBinaryFile(true), PlyFile::Format::BINARY_BIG_ENDIAN));
+  return true;
+}
+
+/// @brief A face which refers to a missing vertex fails the read
+bool testRejectMissingVertex() {
+  std::string content = createAsciiFile("\n");
+  content.replace(content.rfind(" 5\n"), 3, " 6\n");
+
+  const std::string filePath = writeTestFile(content);
+
+  bool isRejected = false;
+  {
+    const PlyFile_t file = PlyFile::open(filePath);
+    CHECK(file != nullptr);
+
+    std::vector<uint32_t> triangles;
+    isRejected = !file->readTriangles(triangles) && triangles.empty();
+  }
+
+  std::error_code error;
+  std::filesystem::remove(filePath, error);
+
+  CHECK(isRejected);
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testReadAscii();
+  isPassed &= testReadBinary();
+  isPassed &= testRejectMissingVertex();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}
@@ -0,0 +1,174 @@
+#include <SimView/Util/TaskScheduler.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace simview::util;
+
+#define CHECK(condition)                                                      \
+  if (!(condition)) {                                                         \
+    std::fprintf(stderr, "%s:%d: Failed: %s\n", __FILE__, __LINE__, #condition); \
+    return false;                                                             \
+  }
+
+/// @brief A thread which is not a worker must not run a task of someone else while it waits for its own group
+bool testNonWorkerDoesNotRunForeignTask() {
+  TaskScheduler scheduler(1);
+
+  // NOTE: Keep the only worker busy, so that the foreign task stays pending in the pool
+  std::promise<void> isBlocked;
+  std::promise<void> toRelease;
+  std::shared_future<void> isReleased = toRelease.get_future().share();
+
+  scheduler.enqueue([&isBlocked, isReleased]() {
+    isBlocked.set_value();
+    isReleased.wait();
+  });
+  isBlocked.get_future().wait();
+
+  const std::thread::id callerId = std::this_thread::get_id();
+  std::atomic<bool> isForeignRunOnCaller(false);
+  std::promise<void> isForeignDone;
+
+  scheduler.enqueue([&]() {
+    if (std::this_thread::get_id() == callerId) {
+      isForeignRunOnCaller = true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    isForeignDone.set_value();
+  });
+
+  std::atomic<int> sum(0);
+  {
+    TaskGroup group(scheduler);
+    for (int i = 1; i <= 4; ++i) {
+      group.run([&sum, i]() { sum += i; });
+    }
+    group.wait();
+  }
+
+  CHECK(sum == 10);
+  CHECK(!isForeignRunOnCaller);
+
+  toRelease.set_value();
+
+  std::future<void> foreign = isForeignDone.get_future();
+  CHECK(foreign.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  CHECK(!isForeignRunOnCaller);
+
+  return true;
+}
+
+/// @brief A thread which is not a worker blocks until the workers finish the tasks it could not run
+bool testNonWorkerWaitsForWorkers() {
+  TaskScheduler scheduler(4);
+
+  std::atomic<int> nFinished(0);
+  {
+    TaskGroup group(scheduler);
+    for (int i = 0; i < 64; ++i) {
+      group.run([&nFinished]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++nFinished;
+      });
+    }
+    group.wait();
+
+    CHECK(nFinished == 64);
+  }
+
+  return true;
+}
+
+/// @brief Nested loops on the workers do not deadlock
+bool testNestedParallelFor() {
+  TaskScheduler scheduler(4);
+
+  const int64_t nOuter = 64;
+  const int64_t nInner = 1000;
+  std::vector<int64_t> sums(nOuter, 0);
+
+  parallelFor(
+      0,
+      nOuter,
+      [&](const int64_t iOuter) {
+        sums[iOuter] = parallelReduce<int64_t>(
+            0,
+            nInner,
+            0,
+            [](const int64_t i) { return i; },
+            [](const int64_t a, const int64_t b) { return a + b; },
+            0,
+            scheduler);
+      },
+      1,
+      scheduler);
+
+  for (const int64_t sum : sums) {
+    CHECK(sum == nInner * (nInner - 1) / 2);
+  }
+
+  return true;
+}
+
+/// @brief Chunks of 'parallelForRange' cover the range exactly once
+bool testParallelForRangeCoversRange() {
+  TaskScheduler scheduler(4);
+
+  const int64_t first = 3;
+  const int64_t last = 10007;
+  std::vector<std::atomic<int>> counts(last);
+
+  parallelForRange(
+      first,
+      last,
+      [&](const int64_t chunkFirst, const int64_t chunkLast) {
+        for (int64_t i = chunkFirst; i < chunkLast; ++i) {
+          ++counts[i];
+        }
+      },
+      64,
+      scheduler);
+
+  for (int64_t i = 0; i < last; ++i) {
+    CHECK(counts[i] == (i >= first ? 1 : 0));
+  }
+
+  return true;
+}
+
+/// @brief Exceptions of the tasks are rethrown by 'wait'
+bool testExceptionIsRethrown() {
+  TaskScheduler scheduler(2);
+
+  bool isCaught = false;
+  try {
+    TaskGroup group(scheduler);
+    group.run([]() { throw std::runtime_error("error"); });
+    group.wait();
+  } catch (const std::runtime_error&) {
+    isCaught = true;
+  }
+
+  CHECK(isCaught);
+
+  return true;
+}
+
+int main() {
+  bool isPassed = true;
+
+  isPassed &= testNonWorkerDoesNotRunForeignTask();
+  isPassed &= testNonWorkerWaitsForWorkers();
+  isPassed &= testNestedParallelFor();
+  isPassed &= testParallelForRangeCoversRange();
+  isPassed &= testExceptionIsRethrown();
+
+  std::printf(isPassed ? "All tests passed.\n" : "Some tests failed.\n");
+
+  return isPassed ? 0 : 1;
+}